@@ -0,0 +1,583 @@
+#ifndef ARVOREAVL_H
+#define ARVOREAVL_H
+
+#include <cstdio>
+#include <cstdlib>
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+#include "../Comum/ConsultaLote.h" //Consulta em lote com prefetch
+#include "../Comum/ArvoreCongelada.h" //Cpia somente leitura na ordem de Eytzinger
+#include "../Comum/Iterador.h" //Iteradores em ordem e varredura de intervalo
+#include "../Comum/ConsultaVizinho.h" //Consultas pela chave mais prxima
+#include "../Comum/Dica.h" //Dica de insero para chaves em ordem
+
+//Implementao da rvore AVL usada pelos programas de teste (busca, insero e remoo)
+//Usei como referncia as aulas do professor Andr Backes, disponveis em http://www.facom.ufu.br/~backes/
+//Com exceo da "insero" e da "remoo", as demais funes (criar, liberar e busca) da "rvore AVL" so idnticas a de uma rvore Binria.
+//As operaes de busca, insero e remoo de elementos possuem complexidade O(log N), no qual N  o nmero de elementos da rvore), que so aplicados a rvore de busca binria
+
+typedef struct NO* ArvAVL;
+
+//Definio do n do dicionrio
+struct NO{
+    int info; //Informao propriamente dita
+    int chave; //Chave associada  informao
+    int altura; //Armazenar a altura daquela subrvore. Usado para clculo do Fator de Balanceamento sempre que adicionar ou remover algum elemento.
+    union{
+        unsigned int versao; //Usado s no modo com um escritor e vrios leitores (ArvoreAVLConcorrente.h)
+        unsigned int refs; //Usado s no modo persistente (ArvoreAVLPersistente.h): quantos ponteiros apontam para o n
+        unsigned int tam; //Usado s no modo com estatsticas de ordem (ArvoreAVLOrdem.h): quantos ns tem a subrvore
+        int maxFim; //Usado s no modo de intervalos (ArvoreAVLIntervalo.h): maior fim de intervalo da subrvore
+    }; //Ocupa o espao que sobrava antes dos ponteiros
+    struct NO *esq; //Filho esquerdo
+    struct NO *dir; //Filho direito
+};
+
+//Cabealho da rvore: ponteiro para a raiz seguido do alocador dos ns
+//O ArvAVL* devolvido por cria_ArvAVL aponta para o campo raiz, ento as funes continuam recebendo um ponteiro para ponteiro
+struct CabecaArvAVL{
+    struct NO* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns dessa rvore
+};
+
+//Retorna o alocador da rvore a partir do ponteiro para a raiz
+Alocador<struct NO>* alocador_ArvAVL(ArvAVL* raiz){
+    return &((struct CabecaArvAVL*) raiz)->aloc;
+}
+
+//Cria a rvore alocando o n raiz e retornando o ponteiro
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvAVL* cria_ArvAVL(int modo = ALOCA_MALLOC){
+    struct CabecaArvAVL* cab = (struct CabecaArvAVL*) malloc(sizeof(struct CabecaArvAVL));
+    if(cab == NULL) //Erro na alocao de memria
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    return &cab->raiz;
+}
+
+//Liberar um n
+void libera_NO(struct NO* no){
+    if(no == NULL) //Se j est vazia, no tem nada a fazer.
+        return;
+    libera_NO(no->esq); //Caso contrrio libera recursivamente todos os ns.
+    libera_NO(no->dir);
+    free(no); //Como usei malloc, usar o free ao invs de delete.
+    no = NULL;
+}
+
+//Liberar toda a rvore, utilizando a funo libera_NO
+//Na arena no  preciso visitar os ns: os blocos so liberados de uma vez
+void libera_ArvAVL(ArvAVL* raiz){
+    if(raiz == NULL)
+        return;
+    Alocador<struct NO>* aloc = alocador_ArvAVL(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);//libera todos os blocos
+    else
+        libera_NO(*raiz);//libera cada n
+    free(raiz);//libera a raiz (o cabealho comea no campo raiz)
+}
+
+//Funo auxiliar que retorna a altura de um determinado n
+int altura_NO(struct NO* no){
+    if(no == NULL)
+        return -1; //Se o n no existe, definimos que a altura  -1
+    else
+    return no->altura;
+}
+
+//Funo auxiliar para calcular o FB do n
+int fatorBalanceamento_NO(struct NO* no){
+    return labs(altura_NO(no->esq) - altura_NO(no->dir)); //Definio: FB = h(esqu) - h(dir). labs retorna o mdulo.
+}
+
+//Funo auxiliar para calcular a maior altura entre duas subrvores
+int maior(int x, int y){
+    if(x > y)
+        return x;
+    else
+        return y;
+}
+
+//Imprime um percurso pr-ordem para testes
+void preOrdem_ArvAVL(ArvAVL *raiz){
+    if(raiz == NULL)
+        return;
+    if(*raiz != NULL){
+        printf("Chave %d: - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
+        preOrdem_ArvAVL(&((*raiz)->esq));
+        preOrdem_ArvAVL(&((*raiz)->dir));
+    }
+}
+
+//Imprime um percurso em-ordem para testes
+void emOrdem_ArvAVL(ArvAVL *raiz){
+    if(raiz == NULL)
+        return;
+    if(*raiz != NULL){
+        emOrdem_ArvAVL(&((*raiz)->esq));
+        printf("Chave %d: - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
+        emOrdem_ArvAVL(&((*raiz)->dir));
+    }
+}
+
+//Imprime um percurso ps-ordem para testes
+void posOrdem_ArvAVL(ArvAVL *raiz){
+    if(raiz == NULL)
+        return;
+    if(*raiz != NULL){
+        posOrdem_ArvAVL(&((*raiz)->esq));
+        posOrdem_ArvAVL(&((*raiz)->dir));
+        printf("Chave %d:  - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
+    }
+}
+
+//A consulta  idntica a uma rvore Binria
+int consulta_ArvAVL(ArvAVL *raiz, int valor){
+    if(raiz == NULL) //rvopre vazia?
+        return 0; //No encontrou
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor == atual->chave){ //Valor procurado est no n atual
+            return 1; //Encontrou
+        }
+        if(valor > atual->chave) //Se o valor procurado for maior que o n atual, procurar na subvore direita
+            atual = atual->dir;
+        else
+            atual = atual->esq; //Se o valor procurado for menor que o n atual, procurar na subvore esquerda
+    }
+    return 0; //No encontrou
+}
+
+//Consulta vrias chaves de uma vez, avanando as buscas em paralelo e usando prefetch (Comum/ConsultaLote.h)
+//resultados[i] recebe 1 se encontrou valores[i] ou 0 caso contrrio. Retorna quantas chaves foram encontradas
+int consultaLote_ArvAVL(ArvAVL *raiz, const int valores[], int n, int resultados[]){
+    if(raiz == NULL)
+        return 0;
+    return consultaLote_NO(*raiz, valores, n, resultados);
+}
+
+//Cria uma cpia somente leitura da rvore em um vetor na ordem de Eytzinger (Comum/ArvoreCongelada.h)
+//As buscas na cpia (consulta_ArvCongelada) no seguem ponteiros. Alteraes na rvore depois disso no aparecem na cpia
+struct ArvCongelada* congela_ArvAVL(ArvAVL *raiz){
+    if(raiz == NULL)
+        return NULL;
+    return congela_Arvore(*raiz);
+}
+
+//Iterador em ordem sem recurso nem alocao (Comum/Iterador.h). Com reverso = 1 vai da maior para a menor chave
+//Uso: for(struct NO* no = atual_Iterador(&it); no != NULL; avanca_Iterador(&it), no = atual_Iterador(&it))
+void iterador_ArvAVL(ArvAVL *raiz, struct Iterador<struct NO> *it, int reverso = 0){
+    inicia_Iterador(it, (raiz == NULL) ? NULL : *raiz, reverso);
+}
+
+//Iterador que comea na primeira chave >= valor (ou na ltima chave <= valor, se reverso)
+void iteradorEm_ArvAVL(ArvAVL *raiz, struct Iterador<struct NO> *it, int valor, int reverso = 0){
+    iniciaEm_Iterador(it, (raiz == NULL) ? NULL : *raiz, valor, reverso);
+}
+
+//Varredura do intervalo [lo, hi]: chama funcao(chave, info) em ordem crescente. Retorna quantas chaves foram visitadas
+template <class F>
+long long varre_ArvAVL(ArvAVL *raiz, int lo, int hi, F funcao){
+    if(raiz == NULL)
+        return 0;
+    return varre_NO(*raiz, lo, hi, funcao);
+}
+
+//Consultas pela chave mais prxima (Comum/ConsultaVizinho.h), em uma descida s
+//Todas retornam 1 se encontraram uma chave e copiam a chave e a informao dela para *chave e *info (que podem ser NULL)
+//Retornam 0 se no existe chave que atenda  condio
+
+//Chave igual a valor. Diferente de consulta_ArvAVL, devolve tambm a informao guardada
+int busca_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(busca_NO(*raiz, valor), chave, info);
+}
+
+//Troca a informao guardada na chave valor, sem mexer na forma da rvore. Retorna 1 ou 0 (chave no est na rvore)
+int atualiza_ArvAVL(ArvAVL *raiz, int valor, int info){
+    if(raiz == NULL)
+        return 0;
+    struct NO* no = busca_NO(*raiz, valor);
+    if(no == NULL)
+        return 0;
+    no->info = info;
+    return 1;
+}
+
+//Menor chave >= valor (lower_bound)
+int limiteInferior_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(primeiroMaior_NO(*raiz, valor, 1), chave, info);
+}
+
+//Menor chave > valor (upper_bound)
+int limiteSuperior_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(primeiroMaior_NO(*raiz, valor, 0), chave, info);
+}
+
+//Maior chave <= valor (floor)
+int piso_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(ultimoMenor_NO(*raiz, valor, 1), chave, info);
+}
+
+//Menor chave >= valor (ceiling). Mesma resposta de limiteInferior_ArvAVL
+int teto_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    return limiteInferior_ArvAVL(raiz, valor, chave, info);
+}
+
+//Maior chave < valor (predecessor). valor no precisa estar na rvore
+int antecessor_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(ultimoMenor_NO(*raiz, valor, 0), chave, info);
+}
+
+//Menor chave > valor (successor). Mesma resposta de limiteSuperior_ArvAVL
+int sucessor_ArvAVL(ArvAVL *raiz, int valor, int *chave, int *info){
+    return limiteSuperior_ArvAVL(raiz, valor, chave, info);
+}
+
+
+//==================Implementao das rotaes==========================
+
+//Rotao  direita (LL)
+void RotacaoLL(ArvAVL *A){
+    //printf("RotacaoLL\n");
+    struct NO *B; //Nova raiz
+    B = (*A)->esq; //Filho da esquerda vira a nova raiz
+    (*A)->esq = B->dir; //O filho da direita do filho da esquerda vira filho da esquerda do filho da direita
+    B->dir = *A; //Raiz original vira filho da direita da nova raiz
+    (*A)->altura = maior(altura_NO((*A)->esq),altura_NO((*A)->dir)) + 1; //Atualiza a altura da raiz original
+    B->altura = maior(altura_NO(B->esq),(*A)->altura) + 1; //Atualiza a altura da nova raiz
+    *A = B;
+}
+
+//Rotao  esquerda (RR)
+void RotacaoRR(ArvAVL *A){
+    //printf("RotacaoRR\n");
+    struct NO *B; //Nova raiz
+    B = (*A)->dir; //Filho da direita vira a nova raiz
+    (*A)->dir = B->esq; //O filho da esquerda do filho da direita vira filho da direita do filho da esquerda
+    B->esq = (*A); //Raiz original vira filho da esquerda da nova raiz
+    (*A)->altura = maior(altura_NO((*A)->esq),altura_NO((*A)->dir)) + 1; //Atualiza a altura da raiz original
+    B->altura = maior(altura_NO(B->dir),(*A)->altura) + 1; //Atualiza a altura da nova raiz
+    (*A) = B;
+}
+
+//Rotao dupla  direita (LR). So duas rotaes simples.
+void RotacaoLR(ArvAVL *A){
+    RotacaoRR(&(*A)->esq); //Rotao  esquerda na sub-rvore da esquerda
+    RotacaoLL(A); //Rotao  direita na rvore original
+}
+
+//Rotao dupla  esquerda (RL). So duas rotaes simples.
+void RotacaoRL(ArvAVL *A){
+    RotacaoLL(&(*A)->dir); //Rotao  direita na subrvore da direita
+    RotacaoRR(A); //Rotao  esquerda na rvore original
+}
+//==================================================
+
+//Inserir um valor na AVL
+//Se a raiz for vazia ou folha, inserir o n
+//Se o valor a ser inserido for menor que a raiz, v para a subrvore esquerda
+//Se o valor a ser inserido for maior que a raiz, v para a subrvore direita
+//Aplicar o mtodo recursivamente
+//Ao voltar na recurso, recalcular o valor da altura de cada subrvore
+//Aplicar as rotaes necessrias se FB = +2 ou -2
+//Os novos ns so pedidos ao alocador da rvore
+int insere_NO(ArvAVL *raiz, int chave, int valor, Alocador<struct NO>* aloc){
+    int res;
+    if(*raiz == NULL){//Se a raiz for vazia ou for uma folha, inserir o n
+        struct NO *novo;
+        novo = aloca_NO(aloc);
+        if(novo == NULL)
+            return 0; //Alocao de memria falhou
+        novo->info = valor;
+        novo->chave = chave;
+        novo->altura = 0; //Folha ou raiz
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *raiz = novo;
+        return 1; //Insero ocorreu corretamente
+    }
+
+    struct NO *atual = *raiz;
+    if(chave < atual->chave){ //Se o valor a ser inserido for menor que a raiz, v para a subrvore esquerda
+        if((res = insere_NO(&(atual->esq), chave, valor, aloc)) == 1){ //Aplicar o mtodo recursivamente inserindo os valores
+            if(fatorBalanceamento_NO(atual) >= 2){ //Balanceamento. Aplicar as rotaes necessrias se FB = +2 ou -2
+                if(chave < (*raiz)->esq->chave ){
+                    RotacaoLL(raiz); //Valor a ser inserido est na parte "externa" da rvore. Rotao  direita.
+                }else{
+                    RotacaoLR(raiz); //Valor a ser inserido est na parte "interna" da rvore. Rotao dupla  direita
+                }
+            }
+        }
+    }else{
+        if(chave > atual->chave){ //Se o valor a ser inserido for maior que a raiz, v para a subrvore direita
+            if((res = insere_NO(&(atual->dir), chave, valor, aloc)) == 1){ //Aplicar o mtodo recursivamente inserindo os valores
+                if(fatorBalanceamento_NO(atual) >= 2){ //Balanceamento. Aplicar as rotaes necessrias se FB = +2 ou -2
+                    if((*raiz)->dir->chave < chave){
+                        RotacaoRR(raiz); //Valor a ser inserido est na parte "externa" da rvore. Rotao  esquerda.
+                    }else{
+                        RotacaoRL(raiz); //Valor a ser inserido est na parte "interna" da rvore. Rotao dupla  esquerda
+                    }
+                }
+            }
+        }else{
+            return 0; //Valor j encontra-se na rvore e no ser inserido
+        }
+    }
+
+    atual->altura = maior(altura_NO(atual->esq),altura_NO(atual->dir)) + 1; //Ao voltar na recurso, recalcular o valor da altura de cada subrvore
+
+    return res; //Retorna 1 se insero ocorreu corretamente ou 0 (alocao de memria falhou ou chave j se encontra na rvore)
+}
+
+//Funo de gerenciamento da insero
+int insere_ArvAVL(ArvAVL *raiz, int chave, int valor){
+    return insere_NO(raiz, chave, valor, alocador_ArvAVL(raiz));
+}
+
+//Altura mxima de uma AVL com at 2^31 ns  menor que 1.45*log2(N+2), ou seja, menos de 46
+#define ALTURA_MAX_AVL 64
+
+//Volta pelo caminho de uma insero (caminho[0..topo-1] leva da raiz at o pai do novo n), recalculando as alturas
+//Para assim que a altura de uma subrvore no muda ou depois de uma rotao (simples ou dupla)
+//Retorna a posio do caminho em que a rotao foi feita ou -1 se no houve rotao
+int sobeInsercao_NO(ArvAVL* caminho[], int topo, int chave){
+    while(topo > 0){ //Volta pelo caminho
+        ArvAVL* q = caminho[--topo];
+        struct NO *atual = *q;
+        int hEsq = altura_NO(atual->esq), hDir = altura_NO(atual->dir);
+        if(hEsq - hDir == 2){ //FB = +2. Novo n est na subrvore esquerda
+            if(chave < atual->esq->chave)
+                RotacaoLL(q); //Parte "externa" da rvore. Rotao  direita
+            else
+                RotacaoLR(q); //Parte "interna" da rvore. Rotao dupla  direita
+            return topo; //A subrvore voltou  altura original
+        }
+        if(hDir - hEsq == 2){ //FB = -2. Novo n est na subrvore direita
+            if(atual->dir->chave < chave)
+                RotacaoRR(q); //Parte "externa" da rvore. Rotao  esquerda
+            else
+                RotacaoRL(q); //Parte "interna" da rvore. Rotao dupla  esquerda
+            return topo;
+        }
+        int novaAltura = maior(hEsq, hDir) + 1;
+        if(novaAltura == atual->altura)
+            break; //Altura no mudou, nada mais muda acima daqui
+        atual->altura = novaAltura;
+    }
+    return -1;
+}
+
+//Insero sem recurso
+//Na descida guardamos em uma pilha os ponteiros (ArvAVL*) que levam a cada n do caminho
+//Na subida, recalculamos a altura de cada n do caminho, mas paramos assim que:
+//- a altura de uma subrvore no mudou: os ancestrais tambm no mudam
+//- foi feita uma rotao (simples ou dupla): a subrvore volta  altura que tinha antes da insero
+//Assim, no mximo uma rotao  feita por insero e no percorremos o caminho inteiro de volta
+int insereIterativo_ArvAVL(ArvAVL *raiz, int chave, int valor){
+    ArvAVL* caminho[ALTURA_MAX_AVL]; //Pilha com o caminho da raiz at o pai do novo n
+    int topo = 0;
+    ArvAVL* p = raiz;
+    while(*p != NULL){ //Desce at a posio de insero
+        if(chave == (*p)->chave)
+            return 0; //Valor j encontra-se na rvore e no ser inserido
+        caminho[topo++] = p;
+        if(chave < (*p)->chave)
+            p = &((*p)->esq);
+        else
+            p = &((*p)->dir);
+    }
+
+    struct NO *novo = aloca_NO(alocador_ArvAVL(raiz));
+    if(novo == NULL)
+        return 0; //Alocao de memria falhou
+    novo->info = valor;
+    novo->chave = chave;
+    novo->altura = 0; //Folha
+    novo->esq = NULL;
+    novo->dir = NULL;
+    *p = novo;
+
+    sobeInsercao_NO(caminho, topo, chave);
+    return 1; //Insero ocorreu corretamente
+}
+
+//Insero com dica (Comum/Dica.h): desce a partir do ponto do caminho da ltima insero em que a chave cabe,
+//e no a partir da raiz. Com chaves em ordem crescente, a busca custa O(1) amortizado
+//Depois de uma rotao, a parte do caminho abaixo dela deixa de valer e  descartada da dica
+//Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insereDica_ArvAVL(ArvAVL *raiz, struct Dica<struct NO> *dica, int chave, int valor){
+    sobe_Dica(dica, chave);
+    ArvAVL* p = desce_Dica(dica, chave);
+    if(p == NULL)
+        return 0; //Valor j encontra-se na rvore e no ser inserido
+    struct NO *novo = aloca_NO(alocador_ArvAVL(raiz));
+    if(novo == NULL)
+        return 0; //Alocao de memria falhou
+    novo->info = valor;
+    novo->chave = chave;
+    novo->altura = 0; //Folha
+    novo->esq = NULL;
+    novo->dir = NULL;
+    *p = novo;
+
+    int rotacao = sobeInsercao_NO(dica->caminho, dica->topo - 1, chave); //O ltimo nvel da dica  o novo n
+    if(rotacao >= 0)
+        dica->topo = rotacao + 1;
+    return 1; //Insero ocorreu corretamente
+}
+
+//Funo auxiliar da construo a partir de um vetor ordenado
+//Cria a subrvore com os elementos ini..fim: o elemento do meio vira a raiz e cada metade vira uma subrvore
+//As alturas so calculadas na volta da recurso. Cada n  visitado uma vez: O(N)
+//nos  o vetor de ns contguos (arena) ou NULL, quando cada n  pedido ao alocador
+struct NO* constroi_NO(int chaves[], int valores[], int ini, int fim, struct NO* nos, int *usados, Alocador<struct NO>* aloc, int *ok){
+    if(ini > fim)
+        return NULL;
+    int meio = ini + (fim - ini) / 2;
+    struct NO* novo;
+    if(nos != NULL)
+        novo = &nos[(*usados)++]; //Prximo n do vetor, na ordem em que a recurso visita (pr-ordem)
+    else
+        novo = aloca_NO(aloc);
+    if(novo == NULL){ //Alocao de memria falhou
+        *ok = 0;
+        return NULL;
+    }
+    novo->chave = chaves[meio];
+    novo->info = valores[meio];
+    novo->esq = constroi_NO(chaves, valores, ini, meio - 1, nos, usados, aloc, ok);
+    novo->dir = constroi_NO(chaves, valores, meio + 1, fim, nos, usados, aloc, ok);
+    novo->altura = maior(altura_NO(novo->esq), altura_NO(novo->dir)) + 1;
+    return novo;
+}
+
+//Constri a rvore de uma vez a partir de chaves em ordem crescente (sem repetio), em tempo O(N)
+//Inserir N chaves em ordem custa O(N log N) e faz uma rotao atrs da outra; aqui a rvore j nasce perfeitamente balanceada
+//Na arena, todos os ns so alocados em um nico trecho contguo
+//A rvore precisa estar vazia. Retorna 1 se deu certo ou 0 (rvore no vazia, chaves fora de ordem ou falta de memria)
+int carregaOrdenado_ArvAVL(ArvAVL *raiz, int chaves[], int valores[], int n){
+    if(raiz == NULL || *raiz != NULL)
+        return 0;
+    for(int i = 1; i < n; i++)
+        if(chaves[i-1] >= chaves[i])
+            return 0; //Chaves fora de ordem ou repetidas
+    Alocador<struct NO>* aloc = alocador_ArvAVL(raiz);
+    struct NO* nos = alocaContiguo_Alocador(aloc, n); //NULL no modo malloc
+    int usados = 0, ok = 1;
+    *raiz = constroi_NO(chaves, valores, 0, n - 1, nos, &usados, aloc, &ok);
+    if(!ok){ //Desfaz o que foi construdo
+        if(aloc->modo == ALOCA_MALLOC)
+            libera_NO(*raiz);
+        *raiz = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+//Funo auxiliar utilizada na remoo de um n. Trata da remoo de um n com 2 filhos.
+//Procura pelo n mais a esquerda.
+struct NO* procuraMenor(struct NO* atual){
+    struct NO *no1 = atual;
+    struct NO *no2 = atual->esq;
+    while(no2 != NULL){
+        no1 = no2;
+        no2 = no2->esq;
+    }
+    return no1;
+}
+
+//Remove n da rvore. Podemos ter 3 situaes:
+// - n folha (sem filhos)
+// - n com 1 filho
+// - n com 2 filhos
+//Devemos tambm tratar o balanceamento da mesma forma que na insero
+//Remover um n da subrvore da direita equivale a inserir um n na subrvore da esquerda
+//O n removido  devolvido ao alocador da rvore
+int remove_NO(ArvAVL *raiz, int valor, Alocador<struct NO>* aloc){
+	if(*raiz == NULL){// No se pode remover de uma rvore vazia
+	    return 0; //Remoo falhou!
+	}
+
+    int res; //Resposta da remoo, j que  uma funo recursiva
+	if(valor < (*raiz)->chave){ //Se o valor a remover for menor que a raiz, vou para a subrvore da esquerda recursivamente
+	    if((res = remove_NO(&(*raiz)->esq,valor,aloc)) == 1){ //Se conseguir remover, ento calculo o FB para ver se preciso balancear
+            if(fatorBalanceamento_NO(*raiz) >= 2){
+                if(altura_NO((*raiz)->dir->esq) <= altura_NO((*raiz)->dir->dir)) //Diferena de altura dos filhos. Removi da esquerda, rebalancear na direita
+                    RotacaoRR(raiz); //N est na parte "externa" da rvore. Rotao  esquerda.
+                else
+                    RotacaoRL(raiz); //N est na parte "interna" da rvore. Rotao dupla  esquerda
+            }
+	    }
+	}
+
+	if((*raiz)->chave < valor){ //Se o valor a remover for maior que a raiz, vou para a subrvore da direita recursivamente
+	    if((res = remove_NO(&(*raiz)->dir, valor, aloc)) == 1){ //Se conseguir remover, ento calculo o FB para ver se preciso balancear
+            if(fatorBalanceamento_NO(*raiz) >= 2){
+                if(altura_NO((*raiz)->esq->dir) <= altura_NO((*raiz)->esq->esq)) //Diferena de altura dos filhos. Remove da direita, rebalancear na esquerda
+                    RotacaoLL(raiz); //N est na parte "externa" da rvore. Rotao  direita
+                else
+                    RotacaoLR(raiz); //N est na parte "interna" da rvore. Rotao dupla  direita
+            }
+	    }
+	}
+
+	if((*raiz)->chave == valor){
+	    if(((*raiz)->esq == NULL || (*raiz)->dir == NULL)){// N tem 1 filho ou nenhum
+			struct NO *oldNode = (*raiz);
+			if((*raiz)->esq != NULL) //Qual filho  folha?
+                *raiz = (*raiz)->esq;
+            else
+                *raiz = (*raiz)->dir;
+			desaloca_NO(aloc, oldNode);
+		}else { // N tem 2 filhos
+			struct NO* temp = procuraMenor((*raiz)->dir); //Procurar pelo menor valor da subrvore da direita
+			(*raiz)->chave = temp->chave; //Substituir pelo n mais a esquerda da subrvore da direita
+			(*raiz)->info = temp->info; //A informao vai junto com a chave
+			remove_NO(&(*raiz)->dir, (*raiz)->chave, aloc); //Remove recursivamente para tratar os problemas que podemos ter
+            if(fatorBalanceamento_NO(*raiz) >= 2){ //Tratar o balanceamento aps a remoo. Removi da survore da direita, tenho que balancear a subrvore da esquerda
+				if(altura_NO((*raiz)->esq->dir) <= altura_NO((*raiz)->esq->esq))
+					RotacaoLL(raiz); //N est na parte "externa" da rvore. Rotao  direita
+				else
+					RotacaoLR(raiz); //N est na parte "interna" da rvore. Rotao dupla  direita
+			}
+		}
+		if (*raiz != NULL)
+            (*raiz)->altura = maior(altura_NO((*raiz)->esq),altura_NO((*raiz)->dir)) + 1; //Atualiza as alturas
+		return 1;
+	}
+
+	(*raiz)->altura = maior(altura_NO((*raiz)->esq),altura_NO((*raiz)->dir)) + 1;
+
+	return res;
+}
+
+//Funo de gerenciamento da remoo
+int remove_ArvAVL(ArvAVL *raiz, int valor){
+    return remove_NO(raiz, valor, alocador_ArvAVL(raiz));
+}
+
+//Operaes da AVL reunidas em uma struct, para as estruturas que recebem a rvore como parmetro de template (Comum/Particionado.h)
+struct MotorAVL{
+    typedef ArvAVL Arvore;
+    static ArvAVL* cria(int modo){ return cria_ArvAVL(modo); }
+    static void libera(ArvAVL *raiz){ libera_ArvAVL(raiz); }
+    static int insere(ArvAVL *raiz, int chave, int valor){ return insere_ArvAVL(raiz, chave, valor); }
+    static int consulta(ArvAVL *raiz, int valor){ return consulta_ArvAVL(raiz, valor); }
+    static int remove(ArvAVL *raiz, int valor){ return remove_ArvAVL(raiz, valor); }
+    static int atualiza(ArvAVL *raiz, int chave, int valor){ return atualiza_ArvAVL(raiz, chave, valor); }
+    template <class F>
+    static long long varre(ArvAVL *raiz, int lo, int hi, F funcao){ return varre_ArvAVL(raiz, lo, hi, funcao); }
+};
+
+#endif
@@ -0,0 +1,370 @@
+#ifndef ARVOREAVLCOMPACTA_H
+#define ARVOREAVLCOMPACTA_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+//Verso compacta da rvore AVL
+//Na ArvoreAVL.h cada n tem dois ponteiros de 64 bits, info, chave e altura: com o alinhamento so 32 bytes para 8 bytes de dados
+//Aqui todos os ns ficam em um nico vetor contguo e os filhos so ndices de 32 bits dentro desse vetor
+//No lugar da altura guardamos apenas o Fator de Balanceamento (-1, 0 ou +1), usando o bit mais alto de cada ndice:
+//- bit alto de esq ligado: subrvore da esquerda  mais alta (FB = +1)
+//- bit alto de dir ligado: subrvore da direita  mais alta (FB = -1)
+//Assim cada n ocupa 16 bytes e cabem 4 ns em uma linha de cache (contra 2 na verso com ponteiros)
+//O ndice 0 no  usado e faz o papel do NULL
+
+#define NULO_AVLC 0u //ndice 0 equivale ao ponteiro NULL
+#define BIT_FB_AVLC 0x80000000u //Bit usado para guardar o Fator de Balanceamento
+#define INDICE_AVLC 0x7FFFFFFFu //Bits usados para o ndice do filho (at 2^31 - 1 ns)
+
+//Definio do n compacto
+struct NOAVLCompacto{
+    int info; //Informao propriamente dita
+    int chave; //Chave associada  informao
+    uint32_t esq; //ndice do filho esquerdo + bit de "esquerda mais alta"
+    uint32_t dir; //ndice do filho direito + bit de "direita mais alta"
+};
+
+static_assert(sizeof(struct NOAVLCompacto) == 16, "O no compacto deve ter 16 bytes");
+
+//A rvore  o vetor de ns mais o ndice da raiz
+struct ArvAVLCompacta{
+    struct NOAVLCompacto *nos; //Vetor contguo com todos os ns
+    uint32_t raiz; //ndice da raiz
+    uint32_t usados; //Prximo ndice ainda no usado do vetor
+    uint32_t capacidade; //Tamanho do vetor
+    uint32_t livres; //Lista de ns removidos, encadeada pelo campo esq
+};
+
+//Funes auxiliares para ler e escrever os ndices sem perder o bit do Fator de Balanceamento
+inline uint32_t esq_AVLC(struct ArvAVLCompacta *a, uint32_t i){ return a->nos[i].esq & INDICE_AVLC; }
+inline uint32_t dir_AVLC(struct ArvAVLCompacta *a, uint32_t i){ return a->nos[i].dir & INDICE_AVLC; }
+inline void setaEsq_AVLC(struct ArvAVLCompacta *a, uint32_t i, uint32_t filho){ a->nos[i].esq = (a->nos[i].esq & BIT_FB_AVLC) | filho; }
+inline void setaDir_AVLC(struct ArvAVLCompacta *a, uint32_t i, uint32_t filho){ a->nos[i].dir = (a->nos[i].dir & BIT_FB_AVLC) | filho; }
+
+//Retorna o Fator de Balanceamento do n: +1 (esquerda mais alta), 0 ou -1 (direita mais alta)
+inline int fb_AVLC(struct ArvAVLCompacta *a, uint32_t i){
+    if(a->nos[i].esq & BIT_FB_AVLC)
+        return 1;
+    if(a->nos[i].dir & BIT_FB_AVLC)
+        return -1;
+    return 0;
+}
+
+//Grava o Fator de Balanceamento do n
+inline void setaFb_AVLC(struct ArvAVLCompacta *a, uint32_t i, int fb){
+    a->nos[i].esq = (a->nos[i].esq & INDICE_AVLC) | (fb == 1 ? BIT_FB_AVLC : 0u);
+    a->nos[i].dir = (a->nos[i].dir & INDICE_AVLC) | (fb == -1 ? BIT_FB_AVLC : 0u);
+}
+
+//Cria a rvore vazia. capacidade  uma estimativa do nmero de ns (o vetor cresce sozinho se precisar)
+struct ArvAVLCompacta* cria_ArvAVLCompacta(uint32_t capacidade = 1024){
+    struct ArvAVLCompacta *a = (struct ArvAVLCompacta*) malloc(sizeof(struct ArvAVLCompacta));
+    if(a == NULL) //Erro na alocao de memria
+        return NULL;
+    if(capacidade < 2)
+        capacidade = 2;
+    a->nos = (struct NOAVLCompacto*) malloc(capacidade * sizeof(struct NOAVLCompacto));
+    if(a->nos == NULL){
+        free(a);
+        return NULL;
+    }
+    a->nos[0].info = a->nos[0].chave = 0; //N 0 zerado: ler os filhos ou a cor do "NULL" no causa problema
+    a->nos[0].esq = a->nos[0].dir = NULO_AVLC;
+    a->raiz = NULO_AVLC;
+    a->usados = 1; //ndice 0 reservado para o NULL
+    a->capacidade = capacidade;
+    a->livres = NULO_AVLC;
+    return a;
+}
+
+//Liberar toda a rvore: basta liberar o vetor de ns
+void libera_ArvAVLCompacta(struct ArvAVLCompacta *a){
+    if(a == NULL)
+        return;
+    free(a->nos);
+    free(a);
+}
+
+//Memria ocupada pelos ns, em bytes (usado para calcular bytes por n nos testes)
+size_t memoria_ArvAVLCompacta(struct ArvAVLCompacta *a){
+    return (size_t) a->capacidade * sizeof(struct NOAVLCompacto);
+}
+
+//Retorna o ndice de um n novo, ou NULO_AVLC se a alocao falhou
+//Cuidado: o vetor pode mudar de lugar (realloc), ento ningum deve guardar ponteiros para ns durante uma insero
+uint32_t alocaNO_AVLC(struct ArvAVLCompacta *a){
+    if(a->livres != NULO_AVLC){ //Reaproveita um n removido
+        uint32_t i = a->livres;
+        a->livres = a->nos[i].esq;
+        return i;
+    }
+    if(a->usados == a->capacidade){ //Vetor cheio, dobra o tamanho
+        if(a->capacidade > INDICE_AVLC / 2)
+            return NULO_AVLC;
+        struct NOAVLCompacto *novos = (struct NOAVLCompacto*) realloc(a->nos, 2 * (size_t) a->capacidade * sizeof(struct NOAVLCompacto));
+        if(novos == NULL)
+            return NULO_AVLC;
+        a->nos = novos;
+        a->capacidade = 2 * a->capacidade;
+    }
+    return a->usados++;
+}
+
+//A consulta  idntica a uma rvore Binria, trocando os ponteiros por ndices
+int consulta_ArvAVLCompacta(struct ArvAVLCompacta *a, int valor){
+    if(a == NULL)
+        return 0;
+    uint32_t atual = a->raiz;
+    while(atual != NULO_AVLC){
+        if(valor == a->nos[atual].chave) //Valor procurado est no n atual
+            return 1; //Encontrou
+        if(valor > a->nos[atual].chave)
+            atual = dir_AVLC(a, atual);
+        else
+            atual = esq_AVLC(a, atual);
+    }
+    return 0; //No encontrou
+}
+
+//Imprime um percurso em-ordem para testes
+void emOrdem_NOAVLC(struct ArvAVLCompacta *a, uint32_t i){
+    if(i == NULO_AVLC)
+        return;
+    emOrdem_NOAVLC(a, esq_AVLC(a, i));
+    printf("Chave %d: - Valor: %d - FB: %d\n", a->nos[i].chave, a->nos[i].info, fb_AVLC(a, i));
+    emOrdem_NOAVLC(a, dir_AVLC(a, i));
+}
+
+void emOrdem_ArvAVLCompacta(struct ArvAVLCompacta *a){
+    if(a == NULL)
+        return;
+    emOrdem_NOAVLC(a, a->raiz);
+}
+
+//==================Implementao das rotaes==========================
+//S mudam os ndices. Quem chama  responsvel por acertar os Fatores de Balanceamento,
+//j que eles dependem do caso (insero ou remoo)
+
+//Rotao  direita (LL). Retorna a nova raiz da subrvore
+uint32_t RotacaoLL_AVLC(struct ArvAVLCompacta *a, uint32_t A){
+    uint32_t B = esq_AVLC(a, A); //Filho da esquerda vira a nova raiz
+    setaEsq_AVLC(a, A, dir_AVLC(a, B));
+    setaDir_AVLC(a, B, A); //Raiz original vira filho da direita da nova raiz
+    return B;
+}
+
+//Rotao  esquerda (RR). Retorna a nova raiz da subrvore
+uint32_t RotacaoRR_AVLC(struct ArvAVLCompacta *a, uint32_t A){
+    uint32_t B = dir_AVLC(a, A); //Filho da direita vira a nova raiz
+    setaDir_AVLC(a, A, esq_AVLC(a, B));
+    setaEsq_AVLC(a, B, A); //Raiz original vira filho da esquerda da nova raiz
+    return B;
+}
+
+//Rotao dupla  direita (LR). Acerta os Fatores de Balanceamento a partir do FB do neto, que vira a nova raiz
+uint32_t RotacaoLR_AVLC(struct ArvAVLCompacta *a, uint32_t A){
+    uint32_t B = esq_AVLC(a, A);
+    uint32_t C = dir_AVLC(a, B); //Neto que vira a nova raiz
+    int fbC = fb_AVLC(a, C);
+    setaEsq_AVLC(a, A, RotacaoRR_AVLC(a, B));
+    C = RotacaoLL_AVLC(a, A);
+    setaFb_AVLC(a, B, fbC == -1 ? 1 : 0);
+    setaFb_AVLC(a, A, fbC == 1 ? -1 : 0);
+    setaFb_AVLC(a, C, 0);
+    return C;
+}
+
+//Rotao dupla  esquerda (RL). Acerta os Fatores de Balanceamento a partir do FB do neto, que vira a nova raiz
+uint32_t RotacaoRL_AVLC(struct ArvAVLCompacta *a, uint32_t A){
+    uint32_t B = dir_AVLC(a, A);
+    uint32_t C = esq_AVLC(a, B); //Neto que vira a nova raiz
+    int fbC = fb_AVLC(a, C);
+    setaDir_AVLC(a, A, RotacaoLL_AVLC(a, B));
+    C = RotacaoRR_AVLC(a, A);
+    setaFb_AVLC(a, A, fbC == -1 ? 1 : 0);
+    setaFb_AVLC(a, B, fbC == 1 ? -1 : 0);
+    setaFb_AVLC(a, C, 0);
+    return C;
+}
+//==================================================
+
+//Insero recursiva. Como s temos o FB, a recurso devolve em *cresceu se a altura da subrvore aumentou
+//Se a altura no mudou, os ancestrais no precisam ser atualizados
+//Retorna o ndice da nova raiz da subrvore
+uint32_t insereNO_AVLC(struct ArvAVLCompacta *a, uint32_t i, int chave, int valor, int *cresceu, int *res){
+    if(i == NULO_AVLC){ //Se a raiz for vazia ou for uma folha, inserir o n
+        uint32_t novo = alocaNO_AVLC(a);
+        if(novo == NULO_AVLC){ //Alocao de memria falhou
+            *res = 0;
+            *cresceu = 0;
+            return NULO_AVLC;
+        }
+        a->nos[novo].info = valor;
+        a->nos[novo].chave = chave;
+        a->nos[novo].esq = NULO_AVLC; //FB = 0
+        a->nos[novo].dir = NULO_AVLC;
+        *res = 1;
+        *cresceu = 1;
+        return novo;
+    }
+
+    if(chave < a->nos[i].chave){ //Vai para a subrvore esquerda
+        uint32_t filho = insereNO_AVLC(a, esq_AVLC(a, i), chave, valor, cresceu, res);
+        setaEsq_AVLC(a, i, filho); //Depois da chamada, o vetor pode ter mudado de lugar
+        if(*cresceu){
+            int fb = fb_AVLC(a, i);
+            if(fb == -1){ //Estava mais alta  direita, agora equilibrou
+                setaFb_AVLC(a, i, 0);
+                *cresceu = 0;
+            }else if(fb == 0){ //Ficou mais alta  esquerda, e a subrvore cresceu
+                setaFb_AVLC(a, i, 1);
+            }else{ //FB = +2: rebalancear
+                if(fb_AVLC(a, filho) == 1){ //Parte "externa". Rotao  direita
+                    i = RotacaoLL_AVLC(a, i);
+                    setaFb_AVLC(a, i, 0);
+                    setaFb_AVLC(a, dir_AVLC(a, i), 0);
+                }else //Parte "interna". Rotao dupla  direita
+                    i = RotacaoLR_AVLC(a, i);
+                *cresceu = 0;
+            }
+        }
+    }else if(chave > a->nos[i].chave){ //Vai para a subrvore direita
+        uint32_t filho = insereNO_AVLC(a, dir_AVLC(a, i), chave, valor, cresceu, res);
+        setaDir_AVLC(a, i, filho);
+        if(*cresceu){
+            int fb = fb_AVLC(a, i);
+            if(fb == 1){
+                setaFb_AVLC(a, i, 0);
+                *cresceu = 0;
+            }else if(fb == 0){
+                setaFb_AVLC(a, i, -1);
+            }else{ //FB = -2: rebalancear
+                if(fb_AVLC(a, filho) == -1){ //Parte "externa". Rotao  esquerda
+                    i = RotacaoRR_AVLC(a, i);
+                    setaFb_AVLC(a, i, 0);
+                    setaFb_AVLC(a, esq_AVLC(a, i), 0);
+                }else //Parte "interna". Rotao dupla  esquerda
+                    i = RotacaoRL_AVLC(a, i);
+                *cresceu = 0;
+            }
+        }
+    }else{ //Valor j encontra-se na rvore e no ser inserido
+        *res = 0;
+        *cresceu = 0;
+    }
+    return i;
+}
+
+//Funo de gerenciamento da insero
+int insere_ArvAVLCompacta(struct ArvAVLCompacta *a, int chave, int valor){
+    int cresceu, res;
+    a->raiz = insereNO_AVLC(a, a->raiz, chave, valor, &cresceu, &res);
+    return res;
+}
+
+//Rebalanceamento depois que a subrvore da esquerda de i diminuiu. *diminuiu informa se a subrvore de i tambm diminuiu
+uint32_t diminuiuEsq_AVLC(struct ArvAVLCompacta *a, uint32_t i, int *diminuiu){
+    int fb = fb_AVLC(a, i);
+    if(fb == 1){ //Estava mais alta  esquerda, agora equilibrou (e diminuiu)
+        setaFb_AVLC(a, i, 0);
+        return i;
+    }
+    if(fb == 0){ //Ficou mais alta  direita, mas a altura no mudou
+        setaFb_AVLC(a, i, -1);
+        *diminuiu = 0;
+        return i;
+    }
+    //FB = -2. Removi da esquerda, rebalancear na direita
+    uint32_t B = dir_AVLC(a, i);
+    int fbB = fb_AVLC(a, B);
+    if(fbB == 1) //N est na parte "interna" da rvore. Rotao dupla  esquerda
+        return RotacaoRL_AVLC(a, i);
+    i = RotacaoRR_AVLC(a, i); //N est na parte "externa" da rvore. Rotao  esquerda
+    if(fbB == 0){ //A altura da subrvore no muda
+        setaFb_AVLC(a, i, 1);
+        setaFb_AVLC(a, esq_AVLC(a, i), -1);
+        *diminuiu = 0;
+    }else{
+        setaFb_AVLC(a, i, 0);
+        setaFb_AVLC(a, esq_AVLC(a, i), 0);
+    }
+    return i;
+}
+
+//Rebalanceamento depois que a subrvore da direita de i diminuiu
+uint32_t diminuiuDir_AVLC(struct ArvAVLCompacta *a, uint32_t i, int *diminuiu){
+    int fb = fb_AVLC(a, i);
+    if(fb == -1){
+        setaFb_AVLC(a, i, 0);
+        return i;
+    }
+    if(fb == 0){
+        setaFb_AVLC(a, i, 1);
+        *diminuiu = 0;
+        return i;
+    }
+    //FB = +2. Removi da direita, rebalancear na esquerda
+    uint32_t B = esq_AVLC(a, i);
+    int fbB = fb_AVLC(a, B);
+    if(fbB == -1) //Rotao dupla  direita
+        return RotacaoLR_AVLC(a, i);
+    i = RotacaoLL_AVLC(a, i); //Rotao  direita
+    if(fbB == 0){
+        setaFb_AVLC(a, i, -1);
+        setaFb_AVLC(a, dir_AVLC(a, i), 1);
+        *diminuiu = 0;
+    }else{
+        setaFb_AVLC(a, i, 0);
+        setaFb_AVLC(a, dir_AVLC(a, i), 0);
+    }
+    return i;
+}
+
+//Remoo recursiva. Mesmos 3 casos da ArvoreAVL.h (folha, 1 filho, 2 filhos)
+//*diminuiu informa se a altura da subrvore diminuiu. Retorna o ndice da nova raiz da subrvore
+uint32_t removeNO_AVLC(struct ArvAVLCompacta *a, uint32_t i, int valor, int *diminuiu, int *res){
+    if(i == NULO_AVLC){ //No se pode remover de uma rvore vazia
+        *res = 0;
+        *diminuiu = 0;
+        return NULO_AVLC;
+    }
+    if(valor < a->nos[i].chave){
+        setaEsq_AVLC(a, i, removeNO_AVLC(a, esq_AVLC(a, i), valor, diminuiu, res));
+        if(*diminuiu)
+            i = diminuiuEsq_AVLC(a, i, diminuiu);
+    }else if(valor > a->nos[i].chave){
+        setaDir_AVLC(a, i, removeNO_AVLC(a, dir_AVLC(a, i), valor, diminuiu, res));
+        if(*diminuiu)
+            i = diminuiuDir_AVLC(a, i, diminuiu);
+    }else{
+        uint32_t e = esq_AVLC(a, i), d = dir_AVLC(a, i);
+        if(e == NULO_AVLC || d == NULO_AVLC){ //N tem 1 filho ou nenhum
+            a->nos[i].esq = a->livres; //Devolve o n para a lista de livres
+            a->livres = i;
+            *res = 1;
+            *diminuiu = 1;
+            return (e != NULO_AVLC) ? e : d;
+        }
+        //N tem 2 filhos: substituir pelo menor da subrvore da direita
+        uint32_t menor = d;
+        while(esq_AVLC(a, menor) != NULO_AVLC)
+            menor = esq_AVLC(a, menor);
+        a->nos[i].chave = a->nos[menor].chave;
+        a->nos[i].info = a->nos[menor].info;
+        setaDir_AVLC(a, i, removeNO_AVLC(a, d, a->nos[menor].chave, diminuiu, res));
+        if(*diminuiu)
+            i = diminuiuDir_AVLC(a, i, diminuiu);
+    }
+    return i;
+}
+
+//Funo de gerenciamento da remoo
+int remove_ArvAVLCompacta(struct ArvAVLCompacta *a, int valor){
+    int diminuiu, res;
+    a->raiz = removeNO_AVLC(a, a->raiz, valor, &diminuiu, &res);
+    return res;
+}
+
+#endif
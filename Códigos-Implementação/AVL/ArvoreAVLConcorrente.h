@@ -0,0 +1,237 @@
+#ifndef ARVOREAVLCONCORRENTE_H
+#define ARVOREAVLCONCORRENTE_H
+
+#include "ArvoreAVL.h"
+#include "../Comum/Epoca.h" //Recuperao dos ns removidos por pocas
+
+//AVL com um escritor e vrios leitores
+//Os leitores buscam sem trava nenhuma (consultaLeitor_ArvAVL), enquanto uma nica thread insere e remove
+//(insereEscritor_ArvAVL e removeEscritor_ArvAVL). Se houver mais de uma thread alterando, elas precisam de uma trava entre si
+//O escritor no altera ns que j esto na rvore: copia o caminho da raiz at o ponto da alterao
+//(e os ns que as rotaes mexem), monta a nova verso e publica a nova raiz de uma vez.
+//Cada leitor v ou a rvore antiga inteira ou a nova inteira
+//Os ns que saem da rvore s voltam ao alocador quando nenhum leitor pode mais estar neles (Comum/Epoca.h)
+//A rvore s pode ser alterada pelas funes do escritor
+
+//Cabealho: comea igual ao da AVL, ento alocador_ArvAVL continua funcionando
+struct CabecaArvAVLConcorrente{
+    struct NO* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns dessa rvore
+    struct Epoca<struct NO> ep; //pocas dos leitores e ns esperando para ser liberados
+};
+
+struct Epoca<struct NO>* epoca_ArvAVL(ArvAVL* raiz){
+    return &((struct CabecaArvAVLConcorrente*) raiz)->ep;
+}
+
+//Cria a rvore vazia para uso concorrente
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvAVL* criaConcorrente_ArvAVL(int modo = ALOCA_MALLOC){
+    size_t tam = sizeof(struct CabecaArvAVLConcorrente); //Mltiplo de 64 por causa dos lugares dos leitores
+    struct CabecaArvAVLConcorrente* cab = (struct CabecaArvAVLConcorrente*) aligned_alloc(alignof(struct CabecaArvAVLConcorrente), tam);
+    if(cab == NULL)
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    if(!inicia_Epoca(&cab->ep, &cab->aloc)){
+        free(cab);
+        return NULL;
+    }
+    return &cab->raiz;
+}
+
+//Libera a rvore. Nenhum leitor pode estar ativo
+void liberaConcorrente_ArvAVL(ArvAVL* raiz){
+    if(raiz == NULL)
+        return;
+    libera_Epoca(epoca_ArvAVL(raiz));
+    Alocador<struct NO>* aloc = alocador_ArvAVL(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);
+    else
+        libera_NO(*raiz);
+    free(raiz);
+}
+
+//Cada thread leitora pede o seu nmero uma vez e o passa em todas as consultas. Retorna -1 se no h mais lugares
+int registraLeitor_ArvAVL(ArvAVL* raiz){
+    return registraLeitor_Epoca(epoca_ArvAVL(raiz));
+}
+
+//Consulta sem trava, feita por uma thread leitora
+//A poca  anotada antes de ler a raiz e desmarcada no fim: enquanto isso nenhum n que o leitor pode ver  liberado
+int consultaLeitor_ArvAVL(ArvAVL *raiz, int leitor, int valor){
+    struct Epoca<struct NO>* e = epoca_ArvAVL(raiz);
+    entra_Epoca(e, leitor);
+    struct NO* atual = __atomic_load_n(raiz, __ATOMIC_SEQ_CST);
+    int res = 0;
+    while(atual != NULL){
+        if(valor == atual->chave){
+            res = 1; //Encontrou
+            break;
+        }
+        if(valor > atual->chave)
+            atual = atual->dir;
+        else
+            atual = atual->esq;
+    }
+    sai_Epoca(e, leitor);
+    return res;
+}
+
+//Prepara as rotaes: os ns que RotacaoLL/LR (ou RR/RL) alteram alm de atual passam a ser cpias que podem ser alteradas
+//atual j  uma cpia. Retorna 0 se faltou memria
+int preparaEsquerda_NO(struct NO* atual, int dupla, struct Epoca<struct NO>* e){
+    atual->esq = escreve_Epoca(e, atual->esq);
+    if(dupla && !e->falhou)
+        atual->esq->dir = escreve_Epoca(e, atual->esq->dir);
+    return !e->falhou;
+}
+
+int preparaDireita_NO(struct NO* atual, int dupla, struct Epoca<struct NO>* e){
+    atual->dir = escreve_Epoca(e, atual->dir);
+    if(dupla && !e->falhou)
+        atual->dir->esq = escreve_Epoca(e, atual->dir->esq);
+    return !e->falhou;
+}
+
+//Mesma insero de insere_NO, mas copiando cada n do caminho antes de alter-lo
+//Na insero, os ns das rotaes esto todos no caminho, ento j so cpias
+//Retorna 1 (inseriu), 0 (chave repetida) ou -1 (faltou memria)
+int insereEscritor_NO(ArvAVL *raiz, int chave, int valor, struct Epoca<struct NO>* e){
+    if(*raiz == NULL){
+        struct NO* novo = novo_Epoca(e);
+        if(e->falhou)
+            return -1;
+        novo->info = valor;
+        novo->chave = chave;
+        novo->altura = 0;
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *raiz = novo;
+        return 1;
+    }
+    if(chave == (*raiz)->chave)
+        return 0; //Valor j encontra-se na rvore e no ser inserido
+    struct NO* atual = escreve_Epoca(e, *raiz);
+    if(e->falhou)
+        return -1;
+    *raiz = atual;
+    int res;
+    if(chave < atual->chave){
+        res = insereEscritor_NO(&atual->esq, chave, valor, e);
+        if(res != 1)
+            return res;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(chave < atual->esq->chave)
+                RotacaoLL(raiz);
+            else
+                RotacaoLR(raiz);
+        }
+    }else{
+        res = insereEscritor_NO(&atual->dir, chave, valor, e);
+        if(res != 1)
+            return res;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(atual->dir->chave < chave)
+                RotacaoRR(raiz);
+            else
+                RotacaoRL(raiz);
+        }
+    }
+    atual->altura = maior(altura_NO(atual->esq), altura_NO(atual->dir)) + 1;
+    return 1;
+}
+
+//Mesma remoo de remove_NO, copiando os ns do caminho e, antes das rotaes, os ns da subrvore irm que elas alteram
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n
+//Retorna 1 (removeu), 0 (no encontrou) ou -1 (faltou memria)
+int removeEscritor_NO(ArvAVL *raiz, int valor, struct Epoca<struct NO>* e){
+    if(*raiz == NULL)
+        return 0;
+    struct NO* atual = escreve_Epoca(e, *raiz);
+    if(e->falhou)
+        return -1;
+    *raiz = atual;
+    int res;
+    if(valor < atual->chave){
+        if((res = removeEscritor_NO(&atual->esq, valor, e)) != 1)
+            return res;
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da esquerda, rebalancear na direita
+            int dupla = altura_NO(atual->dir->esq) > altura_NO(atual->dir->dir);
+            if(!preparaDireita_NO(atual, dupla, e))
+                return -1;
+            if(dupla)
+                RotacaoRL(raiz);
+            else
+                RotacaoRR(raiz);
+        }
+    }else if(valor > atual->chave){
+        if((res = removeEscritor_NO(&atual->dir, valor, e)) != 1)
+            return res;
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da direita, rebalancear na esquerda
+            int dupla = altura_NO(atual->esq->dir) > altura_NO(atual->esq->esq);
+            if(!preparaEsquerda_NO(atual, dupla, e))
+                return -1;
+            if(dupla)
+                RotacaoLR(raiz);
+            else
+                RotacaoLL(raiz);
+        }
+    }else{
+        if(atual->esq == NULL || atual->dir == NULL){ //N tem 1 filho ou nenhum: o filho ocupa o lugar dele
+            *raiz = (atual->esq != NULL) ? atual->esq : atual->dir;
+            descarta_Epoca(e, atual);
+            return e->falhou ? -1 : 1;
+        }
+        struct NO* temp = procuraMenor(atual->dir); //Sucessor
+        atual->chave = temp->chave;
+        atual->info = temp->info;
+        if(removeEscritor_NO(&atual->dir, atual->chave, e) != 1)
+            return -1;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            int dupla = altura_NO(atual->esq->dir) > altura_NO(atual->esq->esq);
+            if(!preparaEsquerda_NO(atual, dupla, e))
+                return -1;
+            if(dupla)
+                RotacaoLR(raiz);
+            else
+                RotacaoLL(raiz);
+        }
+    }
+    (*raiz)->altura = maior(altura_NO((*raiz)->esq), altura_NO((*raiz)->dir)) + 1;
+    return 1;
+}
+
+//Insere pelo escritor. Monta a nova verso da rvore e publica a nova raiz
+//Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insereEscritor_ArvAVL(ArvAVL *raiz, int chave, int valor){
+    struct Epoca<struct NO>* e = epoca_ArvAVL(raiz);
+    struct NO* nova = *raiz; //S o escritor altera a raiz, ento ele pode l-la sem cuidado
+    inicia_Atualizacao(e, nova);
+    if(insereEscritor_NO(&nova, chave, valor, e) != 1){
+        cancela_Atualizacao(e);
+        return 0;
+    }
+    __atomic_store_n(raiz, nova, __ATOMIC_SEQ_CST); //Publica: daqui em diante os leitores pegam a nova raiz
+    confirma_Atualizacao(e);
+    return 1;
+}
+
+//Remove pelo escritor. Retorna 1 se removeu ou 0 (no encontrou ou falta de memria)
+int removeEscritor_ArvAVL(ArvAVL *raiz, int valor){
+    if(!consulta_ArvAVL(raiz, valor)) //No copia nada se a chave no existe
+        return 0;
+    struct Epoca<struct NO>* e = epoca_ArvAVL(raiz);
+    struct NO* nova = *raiz;
+    inicia_Atualizacao(e, nova);
+    if(removeEscritor_NO(&nova, valor, e) != 1){
+        cancela_Atualizacao(e);
+        return 0;
+    }
+    __atomic_store_n(raiz, nova, __ATOMIC_SEQ_CST);
+    confirma_Atualizacao(e);
+    return 1;
+}
+
+#endif
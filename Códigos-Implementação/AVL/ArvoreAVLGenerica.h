@@ -0,0 +1,299 @@
+#ifndef ARVOREAVLGENERICA_H
+#define ARVOREAVLGENERICA_H
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+#include "../Comum/Chave.h" //Comparao das chaves
+
+//Verso genrica da rvore AVL
+//Mesma rvore de ArvoreAVL.h, mas o tipo da chave, o da informao e a comparao so parmetros de template:
+//ArvAVLGenerica<long long, double>, ArvAVLGenerica<ChaveFixa<16>, int, ComparaChaveFixa<16> >...
+//Com <int, int> as comparaes so as mesmas da AVL com int (Comum/Chave.h), ento o desempenho  o mesmo
+//A informao  movida para dentro do n (std::forward), nunca copiada sem necessidade
+//Os ns vm do alocador da rvore e so construdos e destrudos no lugar, ento chave e informao podem ter
+//construtor e destrutor (std::string, std::vector...)
+//Na remoo de um n com 2 filhos, o sucessor  religado no lugar do n, em vez de ter a chave e a informao copiadas
+
+template <class Chave, class Valor>
+struct NOAVLGenerico{
+    Chave chave; //Chave associada  informao
+    Valor info; //Informao propriamente dita
+    struct NOAVLGenerico *esq; //Filho esquerdo
+    struct NOAVLGenerico *dir; //Filho direito
+    int altura; //Altura da subrvore (folha = 0)
+};
+
+template <class Chave, class Valor, class Compara = std::less<Chave> >
+struct ArvAVLGenerica{
+    typedef Chave TipoChave;
+    typedef Valor TipoValor;
+    typedef struct NOAVLGenerico<Chave, Valor> No;
+    No *raiz;
+    Alocador<No> aloc; //De onde saem os ns dessa rvore
+    Compara comp;
+};
+
+//Cria a rvore vazia
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+template <class Chave, class Valor, class Compara = std::less<Chave> >
+struct ArvAVLGenerica<Chave, Valor, Compara>* cria_ArvAVLGenerica(int modo = ALOCA_MALLOC, const Compara& comp = Compara()){
+    struct ArvAVLGenerica<Chave, Valor, Compara>* arv = (struct ArvAVLGenerica<Chave, Valor, Compara>*) malloc(sizeof(struct ArvAVLGenerica<Chave, Valor, Compara>));
+    if(arv == NULL) //Erro na alocao de memria
+        return NULL;
+    arv->raiz = NULL;
+    inicia_Alocador(&arv->aloc, modo);
+    new (&arv->comp) Compara(comp);
+    return arv;
+}
+
+//Destri a chave e a informao e devolve o n ao alocador
+template <class No>
+void destroi_AVLG(Alocador<No>* aloc, No* no){
+    no->~No();
+    desaloca_NO(aloc, no);
+}
+
+//Destri todos os ns da subrvore
+template <class No>
+void libera_AVLG(Alocador<No>* aloc, No* no){
+    while(no != NULL){
+        libera_AVLG(aloc, no->esq);
+        No* dir = no->dir;
+        destroi_AVLG(aloc, no);
+        no = dir;
+    }
+}
+
+//Libera toda a rvore
+//Na arena, se os ns no tm destrutor, os blocos so liberados de uma vez sem visitar os ns
+template <class Chave, class Valor, class Compara>
+void libera_ArvAVLGenerica(struct ArvAVLGenerica<Chave, Valor, Compara>* arv){
+    typedef typename ArvAVLGenerica<Chave, Valor, Compara>::No No;
+    if(arv == NULL)
+        return;
+    if(arv->aloc.modo == ALOCA_ARENA){
+        if(!std::is_trivially_destructible<No>::value)
+            libera_AVLG(&arv->aloc, arv->raiz); //Chama os destrutores antes de liberar os blocos
+        libera_Alocador(&arv->aloc);
+    }else
+        libera_AVLG(&arv->aloc, arv->raiz);
+    arv->comp.~Compara();
+    free(arv);
+}
+
+//Funes auxiliares da altura e do Fator de Balanceamento, como em ArvoreAVL.h
+template <class No>
+inline int altura_AVLG(No* no){
+    if(no == NULL)
+        return -1;
+    return no->altura;
+}
+
+template <class No>
+inline int fatorBalanceamento_AVLG(No* no){
+    return labs(altura_AVLG(no->esq) - altura_AVLG(no->dir));
+}
+
+template <class No>
+inline void atualizaAltura_AVLG(No* no){
+    int e = altura_AVLG(no->esq), d = altura_AVLG(no->dir);
+    no->altura = (e > d ? e : d) + 1;
+}
+
+//Busca o n com a chave, ou NULL
+template <class Chave, class Valor, class Compara>
+struct NOAVLGenerico<Chave, Valor>* procura_AVLG(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, const Chave& chave){
+    struct NOAVLGenerico<Chave, Valor>* atual = arv->raiz;
+    while(atual != NULL){
+        int c = compara_Chave(arv->comp, chave, atual->chave);
+        if(c == 0)
+            return atual; //Encontrou
+        if(c > 0) //Se a chave procurada for maior que a do n atual, procurar na subvore direita
+            atual = atual->dir;
+        else
+            atual = atual->esq;
+    }
+    return NULL;
+}
+
+//Retorna 1 se encontrou a chave ou 0 caso contrrio
+template <class Chave, class Valor, class Compara>
+int consulta_ArvAVLGenerica(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, const typename ArvAVLGenerica<Chave, Valor, Compara>::TipoChave& chave){
+    if(arv == NULL)
+        return 0;
+    return procura_AVLG(arv, chave) != NULL;
+}
+
+//Retorna um ponteiro para a informao guardada com a chave (pode ser alterada no lugar), ou NULL se no encontrou
+template <class Chave, class Valor, class Compara>
+Valor* busca_ArvAVLGenerica(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, const typename ArvAVLGenerica<Chave, Valor, Compara>::TipoChave& chave){
+    if(arv == NULL)
+        return NULL;
+    struct NOAVLGenerico<Chave, Valor>* no = procura_AVLG(arv, chave);
+    return no != NULL ? &no->info : NULL;
+}
+
+//==================Rotaes==========================
+//As mesmas de ArvoreAVL.h
+
+template <class No>
+void RotacaoLL_AVLG(No **A){
+    No *B = (*A)->esq; //Filho da esquerda vira a nova raiz
+    (*A)->esq = B->dir;
+    B->dir = *A;
+    atualizaAltura_AVLG(*A);
+    atualizaAltura_AVLG(B);
+    *A = B;
+}
+
+template <class No>
+void RotacaoRR_AVLG(No **A){
+    No *B = (*A)->dir; //Filho da direita vira a nova raiz
+    (*A)->dir = B->esq;
+    B->esq = *A;
+    atualizaAltura_AVLG(*A);
+    atualizaAltura_AVLG(B);
+    *A = B;
+}
+
+template <class No>
+void RotacaoLR_AVLG(No **A){
+    RotacaoRR_AVLG(&(*A)->esq);
+    RotacaoLL_AVLG(A);
+}
+
+template <class No>
+void RotacaoRL_AVLG(No **A){
+    RotacaoLL_AVLG(&(*A)->dir);
+    RotacaoRR_AVLG(A);
+}
+
+//Rebalanceia depois de uma remoo na subrvore da esquerda (o lado direito pode ter ficado 2 mais alto)
+template <class No>
+inline void balanceiaDireita_AVLG(No **raiz){
+    if(fatorBalanceamento_AVLG(*raiz) >= 2){
+        if(altura_AVLG((*raiz)->dir->esq) <= altura_AVLG((*raiz)->dir->dir))
+            RotacaoRR_AVLG(raiz);
+        else
+            RotacaoRL_AVLG(raiz);
+    }
+}
+
+//Rebalanceia depois de uma remoo na subrvore da direita
+template <class No>
+inline void balanceiaEsquerda_AVLG(No **raiz){
+    if(fatorBalanceamento_AVLG(*raiz) >= 2){
+        if(altura_AVLG((*raiz)->esq->dir) <= altura_AVLG((*raiz)->esq->esq))
+            RotacaoLL_AVLG(raiz);
+        else
+            RotacaoLR_AVLG(raiz);
+    }
+}
+//==================================================
+
+//Mesma insero de insere_NO. A informao s  construda (movida) se a chave ainda no existe
+template <class Chave, class Valor, class Compara, class V>
+int insere_AVLG(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, struct NOAVLGenerico<Chave, Valor>** raiz, const Chave& chave, V&& valor){
+    typedef struct NOAVLGenerico<Chave, Valor> No;
+    if(*raiz == NULL){
+        No *novo = aloca_NO(&arv->aloc);
+        if(novo == NULL)
+            return 0; //Alocao de memria falhou
+        new (novo) No{chave, Valor(std::forward<V>(valor)), NULL, NULL, 0}; //Folha
+        *raiz = novo;
+        return 1;
+    }
+    No *atual = *raiz;
+    int c = compara_Chave(arv->comp, chave, atual->chave);
+    if(c < 0){
+        if(!insere_AVLG(arv, &atual->esq, chave, std::forward<V>(valor)))
+            return 0;
+        if(fatorBalanceamento_AVLG(atual) >= 2){
+            if(compara_Chave(arv->comp, chave, atual->esq->chave) < 0)
+                RotacaoLL_AVLG(raiz); //Parte "externa" da rvore
+            else
+                RotacaoLR_AVLG(raiz); //Parte "interna" da rvore
+        }
+    }else if(c > 0){
+        if(!insere_AVLG(arv, &atual->dir, chave, std::forward<V>(valor)))
+            return 0;
+        if(fatorBalanceamento_AVLG(atual) >= 2){
+            if(compara_Chave(arv->comp, atual->dir->chave, chave) < 0)
+                RotacaoRR_AVLG(raiz);
+            else
+                RotacaoRL_AVLG(raiz);
+        }
+    }else
+        return 0; //Chave j encontra-se na rvore e no ser inserida
+    atualizaAltura_AVLG(atual);
+    return 1;
+}
+
+//Insere a chave com a informao. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+//Passando a informao com std::move ela  movida para o n. Se no inseriu, ela no  tocada
+template <class Chave, class Valor, class Compara, class V>
+int insere_ArvAVLGenerica(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, const typename ArvAVLGenerica<Chave, Valor, Compara>::TipoChave& chave, V&& valor){
+    if(arv == NULL)
+        return 0;
+    return insere_AVLG(arv, &arv->raiz, chave, std::forward<V>(valor));
+}
+
+//Tira da subrvore o n mais  esquerda e o retorna, rebalanceando o caminho
+template <class No>
+No* removeMenor_AVLG(No **raiz){
+    No *atual = *raiz;
+    if(atual->esq == NULL){
+        *raiz = atual->dir;
+        return atual;
+    }
+    No *menor = removeMenor_AVLG(&atual->esq);
+    balanceiaDireita_AVLG(raiz);
+    atualizaAltura_AVLG(*raiz);
+    return menor;
+}
+
+//Mesma remoo de remove_NO. No caso de 2 filhos, o sucessor sai da subrvore da direita e ocupa o lugar do n
+template <class Chave, class Valor, class Compara>
+int remove_AVLG(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, struct NOAVLGenerico<Chave, Valor>** raiz, const Chave& chave){
+    typedef struct NOAVLGenerico<Chave, Valor> No;
+    No *atual = *raiz;
+    if(atual == NULL)
+        return 0; //No encontrou
+    int c = compara_Chave(arv->comp, chave, atual->chave);
+    if(c < 0){
+        if(!remove_AVLG(arv, &atual->esq, chave))
+            return 0;
+        balanceiaDireita_AVLG(raiz); //Removi da esquerda, rebalancear na direita
+    }else if(c > 0){
+        if(!remove_AVLG(arv, &atual->dir, chave))
+            return 0;
+        balanceiaEsquerda_AVLG(raiz); //Removi da direita, rebalancear na esquerda
+    }else{
+        if(atual->esq == NULL || atual->dir == NULL){ //N tem 1 filho ou nenhum
+            *raiz = (atual->esq != NULL) ? atual->esq : atual->dir;
+            destroi_AVLG(&arv->aloc, atual);
+            return 1;
+        }
+        No *sucessor = removeMenor_AVLG(&atual->dir);
+        sucessor->esq = atual->esq;
+        sucessor->dir = atual->dir;
+        *raiz = sucessor;
+        destroi_AVLG(&arv->aloc, atual);
+        balanceiaEsquerda_AVLG(raiz); //A subrvore da direita perdeu um n
+    }
+    atualizaAltura_AVLG(*raiz);
+    return 1;
+}
+
+//Remove a chave. Retorna 1 se removeu ou 0 se no encontrou
+template <class Chave, class Valor, class Compara>
+int remove_ArvAVLGenerica(struct ArvAVLGenerica<Chave, Valor, Compara>* arv, const typename ArvAVLGenerica<Chave, Valor, Compara>::TipoChave& chave){
+    if(arv == NULL)
+        return 0;
+    return remove_AVLG(arv, &arv->raiz, chave);
+}
+
+#endif
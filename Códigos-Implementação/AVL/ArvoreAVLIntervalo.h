@@ -0,0 +1,234 @@
+#ifndef ARVOREAVLINTERVALO_H
+#define ARVOREAVLINTERVALO_H
+
+#include <climits>
+#include "ArvoreAVL.h"
+
+//AVL de intervalos: cada n guarda um intervalo fechado [inicio, fim] (inicio no campo chave e fim no campo info)
+//e o maior fim da sua subrvore (campo maxFim). A rvore  ordenada por (inicio, fim), ento pode haver vrios
+//intervalos com o mesmo incio. S o mesmo intervalo repetido  recusado
+//Com o maxFim, a busca por intervalos que se sobrepem a um ponto ou a [lo, hi] descarta toda subrvore cujo maior fim
+//fica antes do ponto procurado, em vez de olhar todos os intervalos
+//O maxFim  mantido nas rotaes e na volta da recurso da insero e da remoo (DicAVLxMAP-Intervalo.cpp)
+//maxFim ocupa o mesmo espao de versao/refs/tam, ento este modo no pode ser usado junto com os modos concorrente,
+//persistente e com estatsticas de ordem
+//A rvore  criada com cria_ArvAVL e s pode ser alterada pelas funes daqui. consulta_ArvAVL e as demais consultas
+//pela chave olham s para o incio dos intervalos
+
+//Funo auxiliar que retorna o maior fim da subrvore de um n
+int maxFim_NO(struct NO* no){
+    if(no == NULL)
+        return INT_MIN;
+    return no->maxFim;
+}
+
+//Recalcula o maior fim de um n a partir do prprio intervalo e dos filhos
+void atualizaMax_NO(struct NO* no){
+    int m = no->info;
+    if(maxFim_NO(no->esq) > m)
+        m = no->esq->maxFim;
+    if(maxFim_NO(no->dir) > m)
+        m = no->dir->maxFim;
+    no->maxFim = m;
+}
+
+//Ordem dos intervalos na rvore: primeiro pelo incio, depois pelo fim
+int antes_Intervalo(int inicio, int fim, struct NO* no){
+    return inicio < no->chave || (inicio == no->chave && fim < no->info);
+}
+
+//==================Rotaes com maior fim==========================
+//A subrvore rotacionada continua com os mesmos intervalos: a nova raiz fica com o maior fim da antiga,
+//e s a raiz antiga, que desceu, precisa ser recalculada
+
+void RotacaoLLIntervalo(ArvAVL *A){
+    struct NO *antiga = *A;
+    int m = antiga->maxFim;
+    RotacaoLL(A);
+    atualizaMax_NO(antiga);
+    (*A)->maxFim = m;
+}
+
+void RotacaoRRIntervalo(ArvAVL *A){
+    struct NO *antiga = *A;
+    int m = antiga->maxFim;
+    RotacaoRR(A);
+    atualizaMax_NO(antiga);
+    (*A)->maxFim = m;
+}
+
+void RotacaoLRIntervalo(ArvAVL *A){
+    RotacaoRRIntervalo(&(*A)->esq);
+    RotacaoLLIntervalo(A);
+}
+
+void RotacaoRLIntervalo(ArvAVL *A){
+    RotacaoLLIntervalo(&(*A)->dir);
+    RotacaoRRIntervalo(A);
+}
+//==================================================
+
+//Mesma insero de insere_NO, comparando por (inicio, fim). Quando a insero deu certo, o maior fim do n
+// atualizado antes de ser rotacionado
+int insereIntervalo_NO(ArvAVL *raiz, int inicio, int fim, Alocador<struct NO>* aloc){
+    if(*raiz == NULL){
+        struct NO *novo = aloca_NO(aloc);
+        if(novo == NULL)
+            return 0; //Alocao de memria falhou
+        novo->chave = inicio;
+        novo->info = fim;
+        novo->maxFim = fim;
+        novo->altura = 0;
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *raiz = novo;
+        return 1;
+    }
+    struct NO *atual = *raiz;
+    if(antes_Intervalo(inicio, fim, atual)){
+        if(insereIntervalo_NO(&(atual->esq), inicio, fim, aloc) == 0)
+            return 0; //Nada mudou abaixo daqui
+        if(fim > atual->maxFim)
+            atual->maxFim = fim;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(antes_Intervalo(inicio, fim, atual->esq))
+                RotacaoLLIntervalo(raiz);
+            else
+                RotacaoLRIntervalo(raiz);
+        }
+    }else if(inicio != atual->chave || fim != atual->info){
+        if(insereIntervalo_NO(&(atual->dir), inicio, fim, aloc) == 0)
+            return 0;
+        if(fim > atual->maxFim)
+            atual->maxFim = fim;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(!antes_Intervalo(inicio, fim, atual->dir))
+                RotacaoRRIntervalo(raiz);
+            else
+                RotacaoRLIntervalo(raiz);
+        }
+    }else
+        return 0; //Intervalo j encontra-se na rvore e no ser inserido
+    atual->altura = maior(altura_NO(atual->esq), altura_NO(atual->dir)) + 1;
+    return 1;
+}
+
+//Insere o intervalo [inicio, fim]. Retorna 1 se inseriu ou 0 (inicio > fim, intervalo repetido ou falta de memria)
+int insereIntervalo_ArvAVL(ArvAVL *raiz, int inicio, int fim){
+    if(raiz == NULL || inicio > fim)
+        return 0;
+    return insereIntervalo_NO(raiz, inicio, fim, alocador_ArvAVL(raiz));
+}
+
+//Mesma remoo de remove_NO, comparando por (inicio, fim). Quando a remoo deu certo, o maior fim do n
+// recalculado a partir dos filhos (pode ter diminudo) antes de ser rotacionado
+//No caso de 2 filhos, o intervalo do sucessor  copiado para o n
+int removeIntervalo_NO(ArvAVL *raiz, int inicio, int fim, Alocador<struct NO>* aloc){
+    struct NO *atual = *raiz;
+    if(atual == NULL)
+        return 0; //No encontrou
+    if(antes_Intervalo(inicio, fim, atual)){
+        if(removeIntervalo_NO(&(atual->esq), inicio, fim, aloc) == 0)
+            return 0;
+        atualizaMax_NO(atual);
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da esquerda, rebalancear na direita
+            if(altura_NO(atual->dir->esq) <= altura_NO(atual->dir->dir))
+                RotacaoRRIntervalo(raiz);
+            else
+                RotacaoRLIntervalo(raiz);
+        }
+    }else if(inicio != atual->chave || fim != atual->info){
+        if(removeIntervalo_NO(&(atual->dir), inicio, fim, aloc) == 0)
+            return 0;
+        atualizaMax_NO(atual);
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da direita, rebalancear na esquerda
+            if(altura_NO(atual->esq->dir) <= altura_NO(atual->esq->esq))
+                RotacaoLLIntervalo(raiz);
+            else
+                RotacaoLRIntervalo(raiz);
+        }
+    }else{
+        if(atual->esq == NULL || atual->dir == NULL){ //N tem 1 filho ou nenhum: o filho ocupa o lugar dele
+            *raiz = (atual->esq != NULL) ? atual->esq : atual->dir;
+            desaloca_NO(aloc, atual);
+            return 1;
+        }
+        struct NO* temp = procuraMenor(atual->dir); //Sucessor
+        atual->chave = temp->chave;
+        atual->info = temp->info;
+        removeIntervalo_NO(&(atual->dir), atual->chave, atual->info, aloc);
+        atualizaMax_NO(atual);
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(altura_NO(atual->esq->dir) <= altura_NO(atual->esq->esq))
+                RotacaoLLIntervalo(raiz);
+            else
+                RotacaoLRIntervalo(raiz);
+        }
+    }
+    (*raiz)->altura = maior(altura_NO((*raiz)->esq), altura_NO((*raiz)->dir)) + 1;
+    return 1;
+}
+
+//Remove o intervalo [inicio, fim]. Retorna 1 se removeu ou 0 (no encontrou)
+int removeIntervalo_ArvAVL(ArvAVL *raiz, int inicio, int fim){
+    if(raiz == NULL)
+        return 0;
+    return removeIntervalo_NO(raiz, inicio, fim, alocador_ArvAVL(raiz));
+}
+
+//==================Consultas de sobreposio==========================
+//[inicio, fim] se sobrepe a [lo, hi] quando inicio <= hi e fim >= lo
+//Descemos para a esquerda s se o maior fim da subrvore esquerda chega em lo, e para a direita s se o incio do n
+//no passou de hi (os da direita comeam depois dele). Cada intervalo encontrado custa no pior caso O(log N),
+//ento a consulta custa O(log N + k log N) para k respostas, e fica perto de O(log N + k) quando as respostas esto agrupadas
+
+//Chama funcao(inicio, fim) para cada intervalo da subrvore que se sobrepe a [lo, hi]. Retorna quantos encontrou
+template <class F>
+long long sobrepoe_NO(struct NO* no, int lo, int hi, F &funcao){
+    long long encontrados = 0;
+    while(no != NULL && no->maxFim >= lo){ //Subrvore inteira termina antes de lo: nada aqui
+        if(no->esq != NULL && no->esq->maxFim >= lo)
+            encontrados += sobrepoe_NO(no->esq, lo, hi, funcao);
+        if(no->chave > hi)
+            break; //Este n e toda a subrvore direita comeam depois de hi
+        if(no->info >= lo){
+            funcao(no->chave, no->info);
+            encontrados++;
+        }
+        no = no->dir; //Continua pela direita sem recurso
+    }
+    return encontrados;
+}
+
+//Intervalos que se sobrepem a [lo, hi]. funcao(inicio, fim)  chamada para cada um, em ordem de (inicio, fim)
+//Retorna quantos foram encontrados
+template <class F>
+long long sobrepoe_ArvAVL(ArvAVL *raiz, int lo, int hi, F funcao){
+    if(raiz == NULL || lo > hi)
+        return 0;
+    return sobrepoe_NO(*raiz, lo, hi, funcao);
+}
+
+//Intervalos que contm o ponto (inicio <= ponto <= fim)
+template <class F>
+long long contemPonto_ArvAVL(ArvAVL *raiz, int ponto, F funcao){
+    return sobrepoe_ArvAVL(raiz, ponto, ponto, funcao);
+}
+
+//Procura um intervalo qualquer que se sobreponha a [lo, hi], descendo uma vez da raiz: O(log N)
+//Se a subrvore esquerda chega em lo, ou ela tem uma resposta, ou nenhum intervalo  direita serve (todos comeam depois de hi)
+//Retorna 1 e copia o intervalo para *inicio e *fim (que podem ser NULL), ou 0 se nenhum se sobrepe
+int buscaSobreposicao_ArvAVL(ArvAVL *raiz, int lo, int hi, int *inicio, int *fim){
+    if(raiz == NULL)
+        return 0;
+    struct NO* no = *raiz;
+    while(no != NULL && !(no->chave <= hi && no->info >= lo)){
+        if(no->esq != NULL && no->esq->maxFim >= lo)
+            no = no->esq;
+        else
+            no = no->dir;
+    }
+    return resposta_NO(no, inicio, fim);
+}
+
+#endif
@@ -0,0 +1,375 @@
+#ifndef ARVOREAVLMERKLE_H
+#define ARVOREAVLMERKLE_H
+
+#include <cstdlib>
+#include <cstring>
+#include "ArvoreAVL.h" //Funes auxiliares (maior) e as mesmas regras de balanceamento
+#include "../Comum/SHA256.h" //Resumo dos ns
+
+//AVL autenticada (rvore de Merkle), como nos artigos "An efficient data structure for distributed ledger in blockchain systems"
+//(Artigos com Aplicaes/AVL) e "Integrity Auditing for Multi-Copy in Cloud Storage Based on Red-Black Tree" (Artigos com Aplicaes/Rubro-Negra)
+//Cada n guarda hash = SHA-256(chave, info, hash do filho esquerdo, hash do filho direito), com 32 bytes em zero para a subrvore vazia.
+//O hash da raiz resume a rvore inteira: quem guarda s ele consegue conferir uma prova de que (chave, valor) est na rvore,
+//com os ns do caminho at a chave e o hash do outro filho de cada um (O(log N) passos)
+//Insero e remoo so as mesmas de insere_NO e remove_NO (ArvoreAVL.h), mas no recalculam hash nenhum: s marcam como sujos
+//os ns do caminho e os que mudaram de lugar nas rotaes. Todo n sujo tem o pai sujo, ento os ns sujos formam uma
+//subrvore que comea na raiz. O reclculo fica para quando algum pede o hash da raiz ou uma prova (sela_ArvMerkle), e  feito
+//de baixo para cima s nos ns sujos: com vrias alteraes entre dois pedidos, os ns que os caminhos tm em comum
+//(a parte de cima da rvore) so recalculados uma vez s
+//O hash no cabe na union de struct NO, ento este modo tem o seu prprio n (64 bytes, uma linha de cache)
+
+//Altura mxima da AVL com menos de 2^32 ns (tamanho da prova)
+#define ALTURA_MAX_MERKLE 64
+
+struct NOMerkle{
+    int info; //Informao propriamente dita
+    int chave; //Chave associada  informao
+    int altura; //Altura da subrvore, como em struct NO
+    int sujo; //1 se o hash precisa ser recalculado
+    struct NOMerkle *esq; //Filho esquerdo
+    struct NOMerkle *dir; //Filho direito
+    unsigned char hash[TAM_HASH]; //Resumo da subrvore (vlido s com sujo = 0)
+};
+
+typedef struct NOMerkle* ArvMerkle;
+
+//Cabealho da rvore, como em CabecaArvAVL
+struct CabecaArvMerkle{
+    struct NOMerkle* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NOMerkle> aloc; //De onde saem os ns dessa rvore
+};
+
+//Um passo da prova: um n do caminho da raiz at a chave
+struct PassoProva{
+    int chave; //Chave e informao do n
+    int info;
+    int lado; //0 se o caminho desceu para a esquerda deste n, 1 se desceu para a direita
+    unsigned char irmao[TAM_HASH]; //Hash do filho para onde o caminho no foi
+};
+
+//Prova de que (chave, info) est na rvore
+struct ProvaMerkle{
+    int chave;
+    int info;
+    unsigned char esq[TAM_HASH], dir[TAM_HASH]; //Hashes dos filhos do n da chave
+    int tam; //Quantidade de passos (profundidade do n)
+    struct PassoProva passos[ALTURA_MAX_MERKLE]; //passos[0]  a raiz
+};
+
+//Retorna o alocador da rvore a partir do ponteiro para a raiz
+Alocador<struct NOMerkle>* alocador_ArvMerkle(ArvMerkle* raiz){
+    return &((struct CabecaArvMerkle*) raiz)->aloc;
+}
+
+//Cria a rvore vazia
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvMerkle* cria_ArvMerkle(int modo = ALOCA_MALLOC){
+    struct CabecaArvMerkle* cab = (struct CabecaArvMerkle*) malloc(sizeof(struct CabecaArvMerkle));
+    if(cab == NULL) //Erro na alocao de memria
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    return &cab->raiz;
+}
+
+void libera_NOMerkle(struct NOMerkle* no){
+    if(no == NULL)
+        return;
+    libera_NOMerkle(no->esq);
+    libera_NOMerkle(no->dir);
+    free(no);
+}
+
+//Libera toda a rvore. Na arena os blocos so liberados de uma vez
+void libera_ArvMerkle(ArvMerkle* raiz){
+    if(raiz == NULL)
+        return;
+    Alocador<struct NOMerkle>* aloc = alocador_ArvMerkle(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);
+    else
+        libera_NOMerkle(*raiz);
+    free(raiz);
+}
+
+int consulta_ArvMerkle(ArvMerkle *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    struct NOMerkle* atual = *raiz;
+    while(atual != NULL){
+        if(valor == atual->chave)
+            return 1;
+        atual = (valor > atual->chave) ? atual->dir : atual->esq;
+    }
+    return 0;
+}
+
+//==================Hash dos ns==========================
+
+//Hash de um n a partir da chave, da informao e dos hashes dos filhos (NULL = subrvore vazia)
+//Os inteiros entram em little-endian, para a prova valer em qualquer mquina
+void calculaHash_Merkle(int chave, int info, const unsigned char *esq, const unsigned char *dir, unsigned char saida[TAM_HASH]){
+    unsigned char msg[8 + 2 * TAM_HASH];
+    for(int j=0;j<4;j++){
+        msg[j] = (unsigned char) ((unsigned int) chave >> (8 * j));
+        msg[4 + j] = (unsigned char) ((unsigned int) info >> (8 * j));
+    }
+    if(esq != NULL)
+        memcpy(msg + 8, esq, TAM_HASH);
+    else
+        memset(msg + 8, 0, TAM_HASH);
+    if(dir != NULL)
+        memcpy(msg + 8 + TAM_HASH, dir, TAM_HASH);
+    else
+        memset(msg + 8 + TAM_HASH, 0, TAM_HASH);
+    calcula_SHA256(msg, sizeof(msg), saida);
+}
+
+//Hash de uma subrvore j selada, ou NULL se ela  vazia
+const unsigned char* hash_NOMerkle(struct NOMerkle* no){
+    return (no == NULL) ? NULL : no->hash;
+}
+
+//Recalcula os hashes dos ns sujos da subrvore, filhos antes do pai. Retorna quantos hashes foram calculados
+long long sela_NOMerkle(struct NOMerkle* no){
+    if(no == NULL || !no->sujo)
+        return 0; //Subrvore no mudou: o hash guardado continua valendo
+    long long calculados = sela_NOMerkle(no->esq) + sela_NOMerkle(no->dir);
+    calculaHash_Merkle(no->chave, no->info, hash_NOMerkle(no->esq), hash_NOMerkle(no->dir), no->hash);
+    no->sujo = 0;
+    return calculados + 1;
+}
+
+//Recalcula tudo o que ficou pendente desde o ltimo pedido. Retorna quantos hashes foram calculados
+long long sela_ArvMerkle(ArvMerkle *raiz){
+    if(raiz == NULL)
+        return 0;
+    return sela_NOMerkle(*raiz);
+}
+
+//Copia o hash da raiz para saida (32 bytes em zero para a rvore vazia)
+void hashRaiz_ArvMerkle(ArvMerkle *raiz, unsigned char saida[TAM_HASH]){
+    sela_ArvMerkle(raiz);
+    if(raiz == NULL || *raiz == NULL)
+        memset(saida, 0, TAM_HASH);
+    else
+        memcpy(saida, (*raiz)->hash, TAM_HASH);
+}
+
+//==================Rotaes==========================
+//As mesmas de ArvoreAVL.h. Os dois ns que trocam de lugar ficam sujos (na remoo eles podem estar fora do caminho)
+
+int altura_NOMerkle(struct NOMerkle* no){
+    if(no == NULL)
+        return -1;
+    return no->altura;
+}
+
+int fatorBalanceamento_NOMerkle(struct NOMerkle* no){
+    return labs(altura_NOMerkle(no->esq) - altura_NOMerkle(no->dir));
+}
+
+void RotacaoLLMerkle(ArvMerkle *A){
+    struct NOMerkle *B = (*A)->esq;
+    (*A)->esq = B->dir;
+    B->dir = *A;
+    (*A)->altura = maior(altura_NOMerkle((*A)->esq), altura_NOMerkle((*A)->dir)) + 1;
+    B->altura = maior(altura_NOMerkle(B->esq), (*A)->altura) + 1;
+    (*A)->sujo = 1;
+    B->sujo = 1;
+    *A = B;
+}
+
+void RotacaoRRMerkle(ArvMerkle *A){
+    struct NOMerkle *B = (*A)->dir;
+    (*A)->dir = B->esq;
+    B->esq = *A;
+    (*A)->altura = maior(altura_NOMerkle((*A)->esq), altura_NOMerkle((*A)->dir)) + 1;
+    B->altura = maior(altura_NOMerkle(B->dir), (*A)->altura) + 1;
+    (*A)->sujo = 1;
+    B->sujo = 1;
+    *A = B;
+}
+
+void RotacaoLRMerkle(ArvMerkle *A){
+    RotacaoRRMerkle(&(*A)->esq);
+    RotacaoLLMerkle(A);
+}
+
+void RotacaoRLMerkle(ArvMerkle *A){
+    RotacaoLLMerkle(&(*A)->dir);
+    RotacaoRRMerkle(A);
+}
+//==================================================
+
+//Mesma insero de insere_NO. Quando a insero deu certo, o n fica sujo
+int insere_NOMerkle(ArvMerkle *raiz, int chave, int valor, Alocador<struct NOMerkle>* aloc){
+    if(*raiz == NULL){
+        struct NOMerkle *novo = aloca_NO(aloc);
+        if(novo == NULL)
+            return 0; //Alocao de memria falhou
+        novo->info = valor;
+        novo->chave = chave;
+        novo->altura = 0;
+        novo->sujo = 1;
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *raiz = novo;
+        return 1;
+    }
+    struct NOMerkle *atual = *raiz;
+    if(chave < atual->chave){
+        if(insere_NOMerkle(&(atual->esq), chave, valor, aloc) == 0)
+            return 0; //Nada mudou abaixo daqui
+        atual->sujo = 1;
+        if(fatorBalanceamento_NOMerkle(atual) >= 2){
+            if(chave < atual->esq->chave)
+                RotacaoLLMerkle(raiz);
+            else
+                RotacaoLRMerkle(raiz);
+        }
+    }else if(chave > atual->chave){
+        if(insere_NOMerkle(&(atual->dir), chave, valor, aloc) == 0)
+            return 0;
+        atual->sujo = 1;
+        if(fatorBalanceamento_NOMerkle(atual) >= 2){
+            if(atual->dir->chave < chave)
+                RotacaoRRMerkle(raiz);
+            else
+                RotacaoRLMerkle(raiz);
+        }
+    }else
+        return 0; //Valor j encontra-se na rvore e no ser inserido
+    atual->altura = maior(altura_NOMerkle(atual->esq), altura_NOMerkle(atual->dir)) + 1;
+    return 1;
+}
+
+//Insere (chave, valor). Retorna 1 se inseriu ou 0 (chave j na rvore ou falta de memria)
+//Os hashes s so recalculados no prximo hashRaiz_ArvMerkle, prova_ArvMerkle ou sela_ArvMerkle
+int insere_ArvMerkle(ArvMerkle *raiz, int chave, int valor){
+    if(raiz == NULL)
+        return 0;
+    return insere_NOMerkle(raiz, chave, valor, alocador_ArvMerkle(raiz));
+}
+
+struct NOMerkle* procuraMenor_NOMerkle(struct NOMerkle* atual){
+    while(atual->esq != NULL)
+        atual = atual->esq;
+    return atual;
+}
+
+//Mesma remoo de remove_NO. Quando a remoo deu certo, o n fica sujo
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n
+int remove_NOMerkle(ArvMerkle *raiz, int valor, Alocador<struct NOMerkle>* aloc){
+    struct NOMerkle *atual = *raiz;
+    if(atual == NULL)
+        return 0; //No encontrou
+    if(valor < atual->chave){
+        if(remove_NOMerkle(&(atual->esq), valor, aloc) == 0)
+            return 0;
+        atual->sujo = 1;
+        if(fatorBalanceamento_NOMerkle(atual) >= 2){ //Removi da esquerda, rebalancear na direita
+            if(altura_NOMerkle(atual->dir->esq) <= altura_NOMerkle(atual->dir->dir))
+                RotacaoRRMerkle(raiz);
+            else
+                RotacaoRLMerkle(raiz);
+        }
+    }else if(valor > atual->chave){
+        if(remove_NOMerkle(&(atual->dir), valor, aloc) == 0)
+            return 0;
+        atual->sujo = 1;
+        if(fatorBalanceamento_NOMerkle(atual) >= 2){ //Removi da direita, rebalancear na esquerda
+            if(altura_NOMerkle(atual->esq->dir) <= altura_NOMerkle(atual->esq->esq))
+                RotacaoLLMerkle(raiz);
+            else
+                RotacaoLRMerkle(raiz);
+        }
+    }else{
+        if(atual->esq == NULL || atual->dir == NULL){ //N tem 1 filho ou nenhum: o filho ocupa o lugar dele (e j tem o hash certo)
+            *raiz = (atual->esq != NULL) ? atual->esq : atual->dir;
+            desaloca_NO(aloc, atual);
+            return 1;
+        }
+        struct NOMerkle* temp = procuraMenor_NOMerkle(atual->dir); //Sucessor
+        atual->chave = temp->chave;
+        atual->info = temp->info;
+        remove_NOMerkle(&(atual->dir), atual->chave, aloc);
+        atual->sujo = 1;
+        if(fatorBalanceamento_NOMerkle(atual) >= 2){
+            if(altura_NOMerkle(atual->esq->dir) <= altura_NOMerkle(atual->esq->esq))
+                RotacaoLLMerkle(raiz);
+            else
+                RotacaoLRMerkle(raiz);
+        }
+    }
+    (*raiz)->altura = maior(altura_NOMerkle((*raiz)->esq), altura_NOMerkle((*raiz)->dir)) + 1;
+    return 1;
+}
+
+//Remove a chave. Retorna 1 se removeu ou 0 (no encontrou)
+int remove_ArvMerkle(ArvMerkle *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    return remove_NOMerkle(raiz, valor, alocador_ArvMerkle(raiz));
+}
+
+//==================Provas==========================
+
+//Gera a prova de que a chave est na rvore (sela a rvore antes, se for preciso)
+//Retorna 1 e preenche *prova (a informao da chave vai em prova->info), ou 0 se a chave no est na rvore
+int prova_ArvMerkle(ArvMerkle *raiz, int chave, struct ProvaMerkle *prova){
+    if(raiz == NULL)
+        return 0;
+    sela_ArvMerkle(raiz);
+    struct NOMerkle* no = *raiz;
+    prova->tam = 0;
+    while(no != NULL && no->chave != chave){
+        struct PassoProva *p = &prova->passos[prova->tam++];
+        p->chave = no->chave;
+        p->info = no->info;
+        p->lado = chave > no->chave;
+        struct NOMerkle* irmao = p->lado ? no->esq : no->dir;
+        if(irmao != NULL)
+            memcpy(p->irmao, irmao->hash, TAM_HASH);
+        else
+            memset(p->irmao, 0, TAM_HASH);
+        no = p->lado ? no->dir : no->esq;
+    }
+    if(no == NULL)
+        return 0;
+    prova->chave = no->chave;
+    prova->info = no->info;
+    if(no->esq != NULL)
+        memcpy(prova->esq, no->esq->hash, TAM_HASH);
+    else
+        memset(prova->esq, 0, TAM_HASH);
+    if(no->dir != NULL)
+        memcpy(prova->dir, no->dir->hash, TAM_HASH);
+    else
+        memset(prova->dir, 0, TAM_HASH);
+    return 1;
+}
+
+//Confere, s com o hash da raiz, que a prova mostra (chave, valor) na rvore
+//Refaz os hashes do n da chave at a raiz e confere tambm que cada passo desceu para o lado certo da chave
+//Retorna 1 se a prova vale ou 0
+int verificaProva_ArvMerkle(const unsigned char hashRaiz[TAM_HASH], int chave, int valor, const struct ProvaMerkle *prova){
+    if(prova->chave != chave || prova->info != valor || prova->tam < 0 || prova->tam > ALTURA_MAX_MERKLE)
+        return 0;
+    unsigned char atual[TAM_HASH];
+    calculaHash_Merkle(chave, valor, prova->esq, prova->dir, atual);
+    for(int i=prova->tam-1;i>=0;i--){
+        const struct PassoProva *p = &prova->passos[i];
+        if(p->lado != (chave > p->chave) || chave == p->chave)
+            return 0; //A chave no estaria nesse lado do n
+        unsigned char pai[TAM_HASH];
+        if(p->lado)
+            calculaHash_Merkle(p->chave, p->info, p->irmao, atual, pai);
+        else
+            calculaHash_Merkle(p->chave, p->info, atual, p->irmao, pai);
+        memcpy(atual, pai, TAM_HASH);
+    }
+    return memcmp(atual, hashRaiz, TAM_HASH) == 0;
+}
+
+#endif
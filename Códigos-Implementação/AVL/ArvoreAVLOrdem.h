@@ -0,0 +1,252 @@
+#ifndef ARVOREAVLORDEM_H
+#define ARVOREAVLORDEM_H
+
+#include "ArvoreAVL.h"
+
+//AVL com estatsticas de ordem: cada n guarda quantos ns tem a sua subrvore (campo tam)
+//Com isso, "quantas chaves so menores que k" (posicao_ArvAVL), "qual  a i-sima chave" (seleciona_ArvAVL) e
+//"quantas chaves esto entre lo e hi" (contaIntervalo_ArvAVL) custam O(log N), em vez de percorrer a rvore em ordem
+//O tamanho  mantido nas rotaes e na volta da recurso da insero e da remoo, o que tem um custo (DicAVLxMAP-Ordem.cpp)
+//Por isso o modo  opcional: tam ocupa o mesmo espao de versao/refs, ento no pode ser usado junto com o modo
+//concorrente nem com o persistente, e o n continua com o mesmo tamanho
+//A rvore  criada com cria_ArvAVL e s pode ser alterada pelas funes daqui. Uma rvore montada de outra forma
+//(carregaOrdenado_ArvAVL, por exemplo) passa a valer para este modo depois de ligaOrdem_ArvAVL
+//Consulta, consulta em lote e percursos so os mesmos da AVL
+
+//Funo auxiliar que retorna o tamanho da subrvore de um n
+unsigned int tam_NO(struct NO* no){
+    if(no == NULL)
+        return 0;
+    return no->tam;
+}
+
+//Recalcula o tamanho de um n a partir dos filhos
+void atualizaTam_NO(struct NO* no){
+    no->tam = tam_NO(no->esq) + tam_NO(no->dir) + 1;
+}
+
+//Calcula o tamanho de todos os ns da subrvore, em ps-ordem. Retorna o tamanho da subrvore
+unsigned int calculaTam_NO(struct NO* no){
+    if(no == NULL)
+        return 0;
+    no->tam = calculaTam_NO(no->esq) + calculaTam_NO(no->dir) + 1;
+    return no->tam;
+}
+
+//Liga as estatsticas de ordem em uma rvore j montada, em O(N)
+void ligaOrdem_ArvAVL(ArvAVL *raiz){
+    if(raiz != NULL)
+        calculaTam_NO(*raiz);
+}
+
+//Quantidade de chaves da rvore, em O(1)
+int tamanho_ArvAVL(ArvAVL *raiz){
+    if(raiz == NULL)
+        return 0;
+    return tam_NO(*raiz);
+}
+
+//==================Rotaes com tamanho==========================
+//A subrvore rotacionada continua com os mesmos ns: a nova raiz fica com o tamanho da antiga,
+//e s a raiz antiga, que desceu, precisa ser recalculada
+
+void RotacaoLLOrdem(ArvAVL *A){
+    struct NO *antiga = *A;
+    unsigned int t = antiga->tam;
+    RotacaoLL(A);
+    atualizaTam_NO(antiga);
+    (*A)->tam = t;
+}
+
+void RotacaoRROrdem(ArvAVL *A){
+    struct NO *antiga = *A;
+    unsigned int t = antiga->tam;
+    RotacaoRR(A);
+    atualizaTam_NO(antiga);
+    (*A)->tam = t;
+}
+
+void RotacaoLROrdem(ArvAVL *A){
+    RotacaoRROrdem(&(*A)->esq);
+    RotacaoLLOrdem(A);
+}
+
+void RotacaoRLOrdem(ArvAVL *A){
+    RotacaoLLOrdem(&(*A)->dir);
+    RotacaoRROrdem(A);
+}
+//==================================================
+
+//Mesma insero de insere_NO. Quando a insero deu certo, o n ganha 1 no tamanho antes de ser rotacionado
+int insereOrdem_NO(ArvAVL *raiz, int chave, int valor, Alocador<struct NO>* aloc){
+    if(*raiz == NULL){
+        struct NO *novo = aloca_NO(aloc);
+        if(novo == NULL)
+            return 0; //Alocao de memria falhou
+        novo->info = valor;
+        novo->chave = chave;
+        novo->altura = 0;
+        novo->tam = 1;
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *raiz = novo;
+        return 1;
+    }
+    struct NO *atual = *raiz;
+    if(chave < atual->chave){
+        if(insereOrdem_NO(&(atual->esq), chave, valor, aloc) == 0)
+            return 0; //Nada mudou abaixo daqui
+        atual->tam++;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(chave < atual->esq->chave)
+                RotacaoLLOrdem(raiz);
+            else
+                RotacaoLROrdem(raiz);
+        }
+    }else if(chave > atual->chave){
+        if(insereOrdem_NO(&(atual->dir), chave, valor, aloc) == 0)
+            return 0;
+        atual->tam++;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(atual->dir->chave < chave)
+                RotacaoRROrdem(raiz);
+            else
+                RotacaoRLOrdem(raiz);
+        }
+    }else
+        return 0; //Valor j encontra-se na rvore e no ser inserido
+    atual->altura = maior(altura_NO(atual->esq), altura_NO(atual->dir)) + 1;
+    return 1;
+}
+
+//Insere mantendo os tamanhos. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insereOrdem_ArvAVL(ArvAVL *raiz, int chave, int valor){
+    if(raiz == NULL)
+        return 0;
+    return insereOrdem_NO(raiz, chave, valor, alocador_ArvAVL(raiz));
+}
+
+//Mesma remoo de remove_NO. Quando a remoo deu certo, o n perde 1 no tamanho antes de ser rotacionado
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n
+int removeOrdem_NO(ArvAVL *raiz, int valor, Alocador<struct NO>* aloc){
+    struct NO *atual = *raiz;
+    if(atual == NULL)
+        return 0; //No encontrou
+    if(valor < atual->chave){
+        if(removeOrdem_NO(&(atual->esq), valor, aloc) == 0)
+            return 0;
+        atual->tam--;
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da esquerda, rebalancear na direita
+            if(altura_NO(atual->dir->esq) <= altura_NO(atual->dir->dir))
+                RotacaoRROrdem(raiz);
+            else
+                RotacaoRLOrdem(raiz);
+        }
+    }else if(valor > atual->chave){
+        if(removeOrdem_NO(&(atual->dir), valor, aloc) == 0)
+            return 0;
+        atual->tam--;
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da direita, rebalancear na esquerda
+            if(altura_NO(atual->esq->dir) <= altura_NO(atual->esq->esq))
+                RotacaoLLOrdem(raiz);
+            else
+                RotacaoLROrdem(raiz);
+        }
+    }else{
+        if(atual->esq == NULL || atual->dir == NULL){ //N tem 1 filho ou nenhum: o filho ocupa o lugar dele
+            *raiz = (atual->esq != NULL) ? atual->esq : atual->dir;
+            desaloca_NO(aloc, atual);
+            return 1;
+        }
+        struct NO* temp = procuraMenor(atual->dir); //Sucessor
+        atual->chave = temp->chave;
+        atual->info = temp->info;
+        removeOrdem_NO(&(atual->dir), atual->chave, aloc);
+        atual->tam--;
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(altura_NO(atual->esq->dir) <= altura_NO(atual->esq->esq))
+                RotacaoLLOrdem(raiz);
+            else
+                RotacaoLROrdem(raiz);
+        }
+    }
+    (*raiz)->altura = maior(altura_NO((*raiz)->esq), altura_NO((*raiz)->dir)) + 1;
+    return 1;
+}
+
+//Remove mantendo os tamanhos. Retorna 1 se removeu ou 0 (no encontrou)
+int removeOrdem_ArvAVL(ArvAVL *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    return removeOrdem_NO(raiz, valor, alocador_ArvAVL(raiz));
+}
+
+//==================Consultas de ordem==========================
+//Todas descem uma vez da raiz at uma folha: O(log N)
+
+//Posio (rank): quantas chaves da rvore so menores que valor. valor no precisa estar na rvore
+int posicao_ArvAVL(ArvAVL *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    int menores = 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor <= atual->chave)
+            atual = atual->esq;
+        else{ //O n e toda a subrvore esquerda so menores
+            menores += tam_NO(atual->esq) + 1;
+            atual = atual->dir;
+        }
+    }
+    return menores;
+}
+
+//Quantas chaves da rvore so menores ou iguais a valor
+int posicaoAte_ArvAVL(ArvAVL *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    int menores = 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor < atual->chave)
+            atual = atual->esq;
+        else{
+            menores += tam_NO(atual->esq) + 1;
+            atual = atual->dir;
+        }
+    }
+    return menores;
+}
+
+//Seleo (select): a i-sima menor chave, contando a partir de 0, e a informao guardada com ela
+//Retorna 1 se encontrou ou 0 se i est fora de 0..tamanho-1. chave e valor podem ser NULL
+int seleciona_ArvAVL(ArvAVL *raiz, int i, int *chave, int *valor){
+    if(raiz == NULL || i < 0)
+        return 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        int esq = tam_NO(atual->esq);
+        if(i < esq)
+            atual = atual->esq;
+        else if(i == esq){
+            if(chave != NULL)
+                *chave = atual->chave;
+            if(valor != NULL)
+                *valor = atual->info;
+            return 1;
+        }else{
+            i -= esq + 1; //Pula a subrvore esquerda e o n
+            atual = atual->dir;
+        }
+    }
+    return 0;
+}
+
+//Quantas chaves esto no intervalo [lo, hi]
+int contaIntervalo_ArvAVL(ArvAVL *raiz, int lo, int hi){
+    if(lo > hi)
+        return 0;
+    return posicaoAte_ArvAVL(raiz, hi) - posicao_ArvAVL(raiz, lo);
+}
+
+#endif
@@ -0,0 +1,705 @@
+#ifndef ARVOREAVLOTIMISTA_H
+#define ARVOREAVLOTIMISTA_H
+
+#include <thread>
+#include "ArvoreAVL.h"
+#include "../Comum/Epoca.h" //Recuperao dos ns desligados por pocas
+
+//AVL concorrente otimista: vrias threads inserem, buscam e removem ao mesmo tempo
+//Segue o algoritmo de Bronson, Casper, Chafi e Olukotun ("A Practical Concurrent Binary Search Tree", PPoPP 2010):
+//- Cada n tem uma trava e um nmero de verso. Antes de uma rotao fazer um n descer (encolher), a verso  marcada
+//  com ENCOLHENDO e, no fim, incrementada
+//- As buscas no travam nada: descem de mo em mo, lendo o filho e conferindo em seguida que a verso do pai no mudou.
+//  Se mudou, a busca volta um nvel e tenta de novo
+//- A insero trava s o pai do n novo. A remoo de um n com 2 filhos s marca a chave como ausente (n de roteamento):
+//  o n  desligado mais tarde, quando ficar com menos de 2 filhos. Assim as chaves nunca mudam de n
+//- O balanceamento  relaxado: depois de alterar, a thread sobe corrigindo alturas e fazendo as rotaes de
+//  RotacaoLL/LR/RR/RL, travando s o pai, o n e os filhos que giram. As travas so pegas sempre de cima para baixo
+//Os ns desligados so liberados por pocas (Comum/Epoca.h), com uma lista por thread
+//Os ns vm do malloc (ALOCA_MALLOC), que pode ser chamado por vrias threads
+
+//Verso do n
+#define DESLIGADO 1ULL //O n saiu da rvore
+#define ENCOLHENDO 2ULL //Uma rotao est fazendo o n descer
+#define INC_ENCOLHE 4ULL //Soma na verso a cada rotao que faz o n descer
+
+//Resultados internos
+#define TENTA_DE_NOVO -1 //A estrutura mudou durante a operao
+#define PRECISA_DESLIGAR -1 //Condies do n (condicao_NOOtimista)
+#define PRECISA_BALANCEAR -2
+#define NADA_A_FAZER -3
+
+//Aqui a altura conta os ns: uma folha tem altura 1 e um filho NULL tem altura 0 (na ArvoreAVL.h so 0 e -1)
+struct NOOtimista{
+    int chave; //Nunca muda depois que o n  criado
+    int info;
+    int altura;
+    char presente; //0 se a chave foi removida e o n s serve de caminho (n de roteamento)
+    char trava; //Trava do n (spinlock)
+    unsigned long long versao; //DESLIGADO ou contagem de encolhimentos, com o bit ENCOLHENDO
+    struct NOOtimista *pai;
+    struct NOOtimista *esq;
+    struct NOOtimista *dir;
+};
+
+struct CabecaArvAVLOtimista{
+    struct NOOtimista raizFalsa; //A raiz de verdade  raizFalsa.dir. A raiz falsa nunca  rotacionada nem desligada
+    Alocador<struct NOOtimista> aloc; //Sempre ALOCA_MALLOC
+    struct AposentadosThread<struct NOOtimista> aposentados[MAX_LEITORES]; //Ns desligados por cada thread
+    struct Epoca<struct NOOtimista> ep; //pocas das threads
+};
+
+typedef struct CabecaArvAVLOtimista ArvAVLOtimista;
+
+//Leitura e escrita dos campos que outras threads leem sem trava
+template <class T>
+T le_NOOtimista(T *campo){
+    return __atomic_load_n(campo, __ATOMIC_ACQUIRE);
+}
+
+template <class T>
+void escreve_NOOtimista(T *campo, T valor){
+    __atomic_store_n(campo, valor, __ATOMIC_RELEASE);
+}
+
+//Trava do n. Depois de algumas tentativas cede o processador, para no girar  toa quando h mais threads que ncleos
+void trava_NOOtimista(struct NOOtimista *no){
+    int tentativas = 0;
+    while(__atomic_test_and_set(&no->trava, __ATOMIC_ACQUIRE)){
+        while(__atomic_load_n(&no->trava, __ATOMIC_RELAXED)){
+            if(++tentativas >= 64){
+                std::this_thread::yield();
+                tentativas = 0;
+            }
+        }
+    }
+}
+
+void destrava_NOOtimista(struct NOOtimista *no){
+    __atomic_clear(&no->trava, __ATOMIC_RELEASE);
+}
+
+//Espera a rotao que est fazendo o n descer terminar
+void esperaEncolher_NOOtimista(struct NOOtimista *no, unsigned long long versao){
+    while(le_NOOtimista(&no->versao) == versao)
+        std::this_thread::yield();
+}
+
+//dir < 0  o filho esquerdo e dir > 0 o direito
+struct NOOtimista* filho_NOOtimista(struct NOOtimista *no, int dir){
+    return dir < 0 ? le_NOOtimista(&no->esq) : le_NOOtimista(&no->dir);
+}
+
+int altura_NOOtimista(struct NOOtimista *no){
+    return no == NULL ? 0 : le_NOOtimista(&no->altura);
+}
+
+int compara_NOOtimista(int valor, int chave){
+    return valor < chave ? -1 : (valor > chave ? 1 : 0);
+}
+
+//Cria a rvore vazia. Retorna NULL se faltou memria
+ArvAVLOtimista* cria_ArvAVLOtimista(){
+    ArvAVLOtimista *a = (ArvAVLOtimista*) aligned_alloc(alignof(ArvAVLOtimista), sizeof(ArvAVLOtimista));
+    if(a == NULL)
+        return NULL;
+    memset(&a->raizFalsa, 0, sizeof(struct NOOtimista));
+    a->raizFalsa.presente = 1; //Nunca  tratada como n de roteamento
+    inicia_Alocador(&a->aloc, ALOCA_MALLOC);
+    for(int i = 0; i < MAX_LEITORES; i++)
+        inicia_AposentadosThread(&a->aposentados[i]);
+    if(!inicia_Epoca(&a->ep, &a->aloc)){
+        free(a);
+        return NULL;
+    }
+    return a;
+}
+
+void libera_NOOtimista(struct NOOtimista *no){
+    if(no == NULL)
+        return;
+    libera_NOOtimista(no->esq);
+    libera_NOOtimista(no->dir);
+    free(no);
+}
+
+//Libera a rvore e os ns que esperavam as pocas. Nenhuma thread pode estar usando a rvore
+void libera_ArvAVLOtimista(ArvAVLOtimista *a){
+    if(a == NULL)
+        return;
+    libera_NOOtimista(a->raizFalsa.dir);
+    for(int i = 0; i < MAX_LEITORES; i++)
+        liberaThread_Epoca(&a->ep, &a->aposentados[i]);
+    libera_Epoca(&a->ep);
+    free(a);
+}
+
+//Cada thread pede o seu nmero uma vez e o passa em todas as operaes. Retorna -1 se j h MAX_LEITORES threads
+int registraThread_ArvAVLOtimista(ArvAVLOtimista *a){
+    return registraLeitor_Epoca(&a->ep);
+}
+
+//==================Balanceamento==========================
+//As funes terminadas em "Travado" s so chamadas com as travas dos ns indicados
+//Retornam o prximo n a conferir: o prprio n ou um n de baixo se ainda precisa de conserto, seno o pai
+
+//O que o n precisa: ser desligado, ser rebalanceado, nada, ou ter a altura corrigida (retorna a altura nova)
+int condicao_NOOtimista(struct NOOtimista *no){
+    struct NOOtimista *nE = le_NOOtimista(&no->esq);
+    struct NOOtimista *nD = le_NOOtimista(&no->dir);
+    if((nE == NULL || nD == NULL) && !le_NOOtimista(&no->presente))
+        return PRECISA_DESLIGAR;
+    int hE = altura_NOOtimista(nE);
+    int hD = altura_NOOtimista(nD);
+    int fb = hE - hD;
+    if(fb < -1 || fb > 1)
+        return PRECISA_BALANCEAR;
+    int hNova = 1 + maior(hE, hD);
+    return le_NOOtimista(&no->altura) != hNova ? hNova : NADA_A_FAZER;
+}
+
+//Com a trava de no
+struct NOOtimista* corrigeAlturaTravado_NOOtimista(struct NOOtimista *no){
+    int c = condicao_NOOtimista(no);
+    if(c == PRECISA_BALANCEAR || c == PRECISA_DESLIGAR)
+        return no;
+    if(c != NADA_A_FAZER)
+        escreve_NOOtimista(&no->altura, c);
+    return le_NOOtimista(&no->pai);
+}
+
+//Tira da rvore um n de roteamento com menos de 2 filhos. Com as travas de pai e no
+int desligaTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no){
+    struct NOOtimista *paiE = pai->esq;
+    if(paiE != no && pai->dir != no) //no no  mais filho de pai
+        return 0;
+    struct NOOtimista *nE = no->esq;
+    struct NOOtimista *nD = no->dir;
+    if(nE != NULL && nD != NULL)
+        return 0;
+    struct NOOtimista *filho = nE != NULL ? nE : nD;
+    if(paiE == no)
+        escreve_NOOtimista(&pai->esq, filho);
+    else
+        escreve_NOOtimista(&pai->dir, filho);
+    if(filho != NULL)
+        escreve_NOOtimista(&filho->pai, pai);
+    escreve_NOOtimista(&no->versao, DESLIGADO);
+    return 1;
+}
+
+//Rotao simples  direita (caso LL de RotacaoLL). Com as travas de pai, no e nE. no desce
+struct NOOtimista* RotacaoLLTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, struct NOOtimista *nE,
+                                               int hD, int hEE, struct NOOtimista *nED, int hED){
+    unsigned long long versao = no->versao;
+    struct NOOtimista *paiE = pai->esq;
+    escreve_NOOtimista(&no->versao, versao | ENCOLHENDO);
+    escreve_NOOtimista(&no->esq, nED);
+    if(nED != NULL)
+        escreve_NOOtimista(&nED->pai, no);
+    escreve_NOOtimista(&nE->dir, no);
+    escreve_NOOtimista(&no->pai, nE);
+    if(paiE == no)
+        escreve_NOOtimista(&pai->esq, nE);
+    else
+        escreve_NOOtimista(&pai->dir, nE);
+    escreve_NOOtimista(&nE->pai, pai);
+    int hNova = 1 + maior(hED, hD);
+    escreve_NOOtimista(&no->altura, hNova);
+    escreve_NOOtimista(&nE->altura, 1 + maior(hEE, hNova));
+    escreve_NOOtimista(&no->versao, versao + INC_ENCOLHE);
+
+    //Conserta o que der com as travas que j temos
+    int fb = hED - hD;
+    if(fb < -1 || fb > 1)
+        return no;
+    if((nED == NULL || hD == 0) && !no->presente)
+        return no;
+    fb = hEE - hNova;
+    if(fb < -1 || fb > 1)
+        return nE;
+    if(hEE == 0 && !nE->presente)
+        return nE;
+    return corrigeAlturaTravado_NOOtimista(pai);
+}
+
+//Rotao simples  esquerda (caso RR de RotacaoRR). Com as travas de pai, no e nD
+struct NOOtimista* RotacaoRRTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, int hE,
+                                               struct NOOtimista *nD, struct NOOtimista *nDE, int hDE, int hDD){
+    unsigned long long versao = no->versao;
+    struct NOOtimista *paiE = pai->esq;
+    escreve_NOOtimista(&no->versao, versao | ENCOLHENDO);
+    escreve_NOOtimista(&no->dir, nDE);
+    if(nDE != NULL)
+        escreve_NOOtimista(&nDE->pai, no);
+    escreve_NOOtimista(&nD->esq, no);
+    escreve_NOOtimista(&no->pai, nD);
+    if(paiE == no)
+        escreve_NOOtimista(&pai->esq, nD);
+    else
+        escreve_NOOtimista(&pai->dir, nD);
+    escreve_NOOtimista(&nD->pai, pai);
+    int hNova = 1 + maior(hE, hDE);
+    escreve_NOOtimista(&no->altura, hNova);
+    escreve_NOOtimista(&nD->altura, 1 + maior(hNova, hDD));
+    escreve_NOOtimista(&no->versao, versao + INC_ENCOLHE);
+
+    int fb = hDE - hE;
+    if(fb < -1 || fb > 1)
+        return no;
+    if((nDE == NULL || hE == 0) && !no->presente)
+        return no;
+    fb = hDD - hNova;
+    if(fb < -1 || fb > 1)
+        return nD;
+    if(hDD == 0 && !nD->presente)
+        return nD;
+    return corrigeAlturaTravado_NOOtimista(pai);
+}
+
+//Rotao dupla (caso LR de RotacaoLR). Com as travas de pai, no, nE e nED. no e nE descem
+struct NOOtimista* RotacaoLRTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, struct NOOtimista *nE,
+                                               int hD, int hEE, struct NOOtimista *nED, int hEDE){
+    unsigned long long versao = no->versao;
+    unsigned long long versaoE = nE->versao;
+    struct NOOtimista *paiE = pai->esq;
+    struct NOOtimista *nEDE = nED->esq;
+    struct NOOtimista *nEDD = nED->dir;
+    int hEDD = altura_NOOtimista(nEDD);
+    escreve_NOOtimista(&no->versao, versao | ENCOLHENDO);
+    escreve_NOOtimista(&nE->versao, versaoE | ENCOLHENDO);
+    escreve_NOOtimista(&no->esq, nEDD);
+    if(nEDD != NULL)
+        escreve_NOOtimista(&nEDD->pai, no);
+    escreve_NOOtimista(&nE->dir, nEDE);
+    if(nEDE != NULL)
+        escreve_NOOtimista(&nEDE->pai, nE);
+    escreve_NOOtimista(&nED->esq, nE);
+    escreve_NOOtimista(&nE->pai, nED);
+    escreve_NOOtimista(&nED->dir, no);
+    escreve_NOOtimista(&no->pai, nED);
+    if(paiE == no)
+        escreve_NOOtimista(&pai->esq, nED);
+    else
+        escreve_NOOtimista(&pai->dir, nED);
+    escreve_NOOtimista(&nED->pai, pai);
+    int hNova = 1 + maior(hEDD, hD);
+    escreve_NOOtimista(&no->altura, hNova);
+    int hENova = 1 + maior(hEE, hEDE);
+    escreve_NOOtimista(&nE->altura, hENova);
+    escreve_NOOtimista(&nED->altura, 1 + maior(hENova, hNova));
+    escreve_NOOtimista(&no->versao, versao + INC_ENCOLHE);
+    escreve_NOOtimista(&nE->versao, versaoE + INC_ENCOLHE);
+
+    int fb = hEDD - hD;
+    if(fb < -1 || fb > 1)
+        return no;
+    if((nEDD == NULL || hD == 0) && !no->presente)
+        return no;
+    if((hEE == 0 || hEDE == 0) && !nE->presente) //nE ficou de roteamento com um filho s: desligar
+        return nE;
+    fb = hENova - hNova;
+    if(fb < -1 || fb > 1)
+        return nED;
+    return corrigeAlturaTravado_NOOtimista(pai);
+}
+
+//Rotao dupla (caso RL de RotacaoRL). Com as travas de pai, no, nD e nDE. no e nD descem
+struct NOOtimista* RotacaoRLTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, int hE,
+                                               struct NOOtimista *nD, struct NOOtimista *nDE, int hDD, int hDED){
+    unsigned long long versao = no->versao;
+    unsigned long long versaoD = nD->versao;
+    struct NOOtimista *paiE = pai->esq;
+    struct NOOtimista *nDEE = nDE->esq;
+    struct NOOtimista *nDED = nDE->dir;
+    int hDEE = altura_NOOtimista(nDEE);
+    escreve_NOOtimista(&no->versao, versao | ENCOLHENDO);
+    escreve_NOOtimista(&nD->versao, versaoD | ENCOLHENDO);
+    escreve_NOOtimista(&no->dir, nDEE);
+    if(nDEE != NULL)
+        escreve_NOOtimista(&nDEE->pai, no);
+    escreve_NOOtimista(&nD->esq, nDED);
+    if(nDED != NULL)
+        escreve_NOOtimista(&nDED->pai, nD);
+    escreve_NOOtimista(&nDE->dir, nD);
+    escreve_NOOtimista(&nD->pai, nDE);
+    escreve_NOOtimista(&nDE->esq, no);
+    escreve_NOOtimista(&no->pai, nDE);
+    if(paiE == no)
+        escreve_NOOtimista(&pai->esq, nDE);
+    else
+        escreve_NOOtimista(&pai->dir, nDE);
+    escreve_NOOtimista(&nDE->pai, pai);
+    int hNova = 1 + maior(hE, hDEE);
+    escreve_NOOtimista(&no->altura, hNova);
+    int hDNova = 1 + maior(hDED, hDD);
+    escreve_NOOtimista(&nD->altura, hDNova);
+    escreve_NOOtimista(&nDE->altura, 1 + maior(hNova, hDNova));
+    escreve_NOOtimista(&no->versao, versao + INC_ENCOLHE);
+    escreve_NOOtimista(&nD->versao, versaoD + INC_ENCOLHE);
+
+    int fb = hDEE - hE;
+    if(fb < -1 || fb > 1)
+        return no;
+    if((nDEE == NULL || hE == 0) && !no->presente)
+        return no;
+    if((hDD == 0 || hDED == 0) && !nD->presente)
+        return nD;
+    fb = hDNova - hNova;
+    if(fb < -1 || fb > 1)
+        return nDE;
+    return corrigeAlturaTravado_NOOtimista(pai);
+}
+
+struct NOOtimista* balanceiaDireitaAltaTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, struct NOOtimista *nD, int hE0);
+
+//A subrvore da esquerda de no ficou alta demais (casos LL e LR). Com as travas de pai e no; trava nE
+struct NOOtimista* balanceiaEsquerdaAltaTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, struct NOOtimista *nE, int hD0){
+    struct NOOtimista *res;
+    trava_NOOtimista(nE);
+    if(nE->altura - hD0 <= 1){ //Mudou desde a leitura: tenta de novo
+        destrava_NOOtimista(nE);
+        return no;
+    }
+    struct NOOtimista *nED = nE->dir;
+    int hEE0 = altura_NOOtimista(nE->esq);
+    int hED0 = altura_NOOtimista(nED);
+    if(hEE0 >= hED0){
+        res = RotacaoLLTravado_NOOtimista(pai, no, nE, hD0, hEE0, nED, hED0);
+        destrava_NOOtimista(nE);
+        return res;
+    }
+    trava_NOOtimista(nED);
+    int hED = nED->altura;
+    if(hEE0 >= hED){
+        res = RotacaoLLTravado_NOOtimista(pai, no, nE, hD0, hEE0, nED, hED);
+        destrava_NOOtimista(nED);
+        destrava_NOOtimista(nE);
+        return res;
+    }
+    int hEDE = altura_NOOtimista(nED->esq);
+    int fb = hEE0 - hEDE;
+    if(fb >= -1 && fb <= 1){
+        res = RotacaoLRTravado_NOOtimista(pai, no, nE, hD0, hEE0, nED, hEDE);
+        destrava_NOOtimista(nED);
+        destrava_NOOtimista(nE);
+        return res;
+    }
+    destrava_NOOtimista(nED);
+    //A rotao dupla deixaria nE desbalanceado (alturas lidas antes de outra thread mudar a subrvore):
+    //conserta nE primeiro, no  consertado depois
+    res = balanceiaDireitaAltaTravado_NOOtimista(no, nE, nED, hEE0);
+    destrava_NOOtimista(nE);
+    return res;
+}
+
+//A subrvore da direita de no ficou alta demais (casos RR e RL). Com as travas de pai e no; trava nD
+struct NOOtimista* balanceiaDireitaAltaTravado_NOOtimista(struct NOOtimista *pai, struct NOOtimista *no, struct NOOtimista *nD, int hE0){
+    struct NOOtimista *res;
+    trava_NOOtimista(nD);
+    if(hE0 - nD->altura >= -1){
+        destrava_NOOtimista(nD);
+        return no;
+    }
+    struct NOOtimista *nDE = nD->esq;
+    int hDE0 = altura_NOOtimista(nDE);
+    int hDD0 = altura_NOOtimista(nD->dir);
+    if(hDD0 >= hDE0){
+        res = RotacaoRRTravado_NOOtimista(pai, no, hE0, nD, nDE, hDE0, hDD0);
+        destrava_NOOtimista(nD);
+        return res;
+    }
+    trava_NOOtimista(nDE);
+    int hDE = nDE->altura;
+    if(hDD0 >= hDE){
+        res = RotacaoRRTravado_NOOtimista(pai, no, hE0, nD, nDE, hDE, hDD0);
+        destrava_NOOtimista(nDE);
+        destrava_NOOtimista(nD);
+        return res;
+    }
+    int hDED = altura_NOOtimista(nDE->dir);
+    int fb = hDD0 - hDED;
+    if(fb >= -1 && fb <= 1){
+        res = RotacaoRLTravado_NOOtimista(pai, no, hE0, nD, nDE, hDD0, hDED);
+        destrava_NOOtimista(nDE);
+        destrava_NOOtimista(nD);
+        return res;
+    }
+    destrava_NOOtimista(nDE);
+    res = balanceiaEsquerdaAltaTravado_NOOtimista(no, nD, nDE, hDD0);
+    destrava_NOOtimista(nD);
+    return res;
+}
+
+//Conserta no: desliga, rotaciona ou corrige a altura. Com as travas de pai e no
+struct NOOtimista* balanceiaTravado_NOOtimista(ArvAVLOtimista *a, int id, struct NOOtimista *pai, struct NOOtimista *no){
+    struct NOOtimista *nE = no->esq;
+    struct NOOtimista *nD = no->dir;
+    if((nE == NULL || nD == NULL) && !no->presente){
+        if(desligaTravado_NOOtimista(pai, no)){
+            aposenta_Epoca(&a->ep, &a->aposentados[id], no);
+            return corrigeAlturaTravado_NOOtimista(pai);
+        }
+        return no;
+    }
+    int hE = altura_NOOtimista(nE);
+    int hD = altura_NOOtimista(nD);
+    int hNova = 1 + maior(hE, hD);
+    int fb = hE - hD;
+    if(fb > 1)
+        return balanceiaEsquerdaAltaTravado_NOOtimista(pai, no, nE, hD);
+    if(fb < -1)
+        return balanceiaDireitaAltaTravado_NOOtimista(pai, no, nD, hE);
+    if(hNova != no->altura)
+        escreve_NOOtimista(&no->altura, hNova);
+    return corrigeAlturaTravado_NOOtimista(pai);
+}
+
+//Sobe a partir de no at a raiz consertando alturas e balanceamento
+//No para no primeiro n sem conserto: uma rotao que deixou um n de baixo para consertar pode ter mudado a altura
+//de um n mais acima. Os ns que no precisam de nada so s lidos, sem travas
+void corrigeAlturaEBalanceia_NOOtimista(ArvAVLOtimista *a, int id, struct NOOtimista *no){
+    while(no != NULL && le_NOOtimista(&no->pai) != NULL){ //A raiz falsa no tem pai
+        if(le_NOOtimista(&no->versao) == DESLIGADO)
+            return;
+        int c = condicao_NOOtimista(no);
+        if(c == NADA_A_FAZER)
+            no = le_NOOtimista(&no->pai);
+        else if(c != PRECISA_DESLIGAR && c != PRECISA_BALANCEAR){
+            struct NOOtimista *atual = no;
+            trava_NOOtimista(atual);
+            no = corrigeAlturaTravado_NOOtimista(atual);
+            destrava_NOOtimista(atual);
+        }else{
+            struct NOOtimista *pai = le_NOOtimista(&no->pai);
+            trava_NOOtimista(pai);
+            if(le_NOOtimista(&pai->versao) != DESLIGADO && le_NOOtimista(&no->pai) == pai){
+                struct NOOtimista *atual = no;
+                trava_NOOtimista(atual);
+                no = balanceiaTravado_NOOtimista(a, id, pai, atual);
+                destrava_NOOtimista(atual);
+            } //Seno tenta de novo com o mesmo n
+            destrava_NOOtimista(pai);
+        }
+    }
+}
+
+//==================Busca==========================
+
+//Busca valor na subrvore dir de no, que tinha a verso versaoNo quando a busca passou por ele
+//Retorna 1, 0 ou TENTA_DE_NOVO (no encolheu: a chave pode ter sado da subrvore)
+int tentaConsulta_NOOtimista(struct NOOtimista *no, int dir, unsigned long long versaoNo, int valor){
+    while(1){
+        struct NOOtimista *filho = filho_NOOtimista(no, dir);
+        if(le_NOOtimista(&no->versao) != versaoNo)
+            return TENTA_DE_NOVO;
+        if(filho == NULL)
+            return 0;
+        int proxDir = compara_NOOtimista(valor, filho->chave);
+        if(proxDir == 0)
+            return le_NOOtimista(&filho->presente);
+        unsigned long long versaoFilho = le_NOOtimista(&filho->versao);
+        if(versaoFilho & ENCOLHENDO)
+            esperaEncolher_NOOtimista(filho, versaoFilho);
+        else if(versaoFilho != DESLIGADO && filho == filho_NOOtimista(no, dir)){
+            if(le_NOOtimista(&no->versao) != versaoNo)
+                return TENTA_DE_NOVO;
+            int res = tentaConsulta_NOOtimista(filho, proxDir, versaoFilho, valor);
+            if(res != TENTA_DE_NOVO)
+                return res;
+        } //Seno o filho mudou: l de novo
+    }
+}
+
+//Busca sem travas. id  o nmero da thread (registraThread_ArvAVLOtimista)
+int consulta_ArvAVLOtimista(ArvAVLOtimista *a, int id, int valor){
+    entra_Epoca(&a->ep, id);
+    int res;
+    do{
+        res = tentaConsulta_NOOtimista(&a->raizFalsa, 1, le_NOOtimista(&a->raizFalsa.versao), valor);
+    }while(res == TENTA_DE_NOVO);
+    sai_Epoca(&a->ep, id);
+    return res;
+}
+
+//==================Insero==========================
+
+//Pendura um n novo como filho dir de no. Trava s no
+int tentaNovo_NOOtimista(ArvAVLOtimista *a, int id, struct NOOtimista *no, int dir, unsigned long long versaoNo, int chave, int valor){
+    trava_NOOtimista(no);
+    if(le_NOOtimista(&no->versao) != versaoNo || filho_NOOtimista(no, dir) != NULL){
+        destrava_NOOtimista(no);
+        return TENTA_DE_NOVO;
+    }
+    struct NOOtimista *novo = aloca_NO(&a->aloc);
+    if(novo == NULL){ //Erro na alocao de memria
+        destrava_NOOtimista(no);
+        return 0;
+    }
+    novo->chave = chave;
+    novo->info = valor;
+    novo->altura = 1;
+    novo->presente = 1;
+    novo->trava = 0;
+    novo->versao = 0;
+    novo->pai = no;
+    novo->esq = NULL;
+    novo->dir = NULL;
+    escreve_NOOtimista(dir < 0 ? &no->esq : &no->dir, novo); //Daqui em diante o n  visto pelas outras threads
+    destrava_NOOtimista(no);
+    corrigeAlturaEBalanceia_NOOtimista(a, id, no);
+    return 1;
+}
+
+//A chave j tem um n: se ele  de roteamento, a chave volta a estar presente
+int tentaReativa_NOOtimista(struct NOOtimista *no, int valor){
+    if(le_NOOtimista(&no->presente))
+        return 0; //Valor j encontra-se na rvore e no ser inserido
+    trava_NOOtimista(no);
+    if(le_NOOtimista(&no->versao) == DESLIGADO){
+        destrava_NOOtimista(no);
+        return TENTA_DE_NOVO;
+    }
+    int res = 0;
+    if(!no->presente){
+        no->info = valor;
+        escreve_NOOtimista(&no->presente, (char) 1);
+        res = 1;
+    }
+    destrava_NOOtimista(no);
+    return res;
+}
+
+int tentaInsere_NOOtimista(ArvAVLOtimista *a, int id, struct NOOtimista *no, int dir, unsigned long long versaoNo, int chave, int valor){
+    int res;
+    do{
+        res = TENTA_DE_NOVO;
+        struct NOOtimista *filho = filho_NOOtimista(no, dir);
+        if(le_NOOtimista(&no->versao) != versaoNo)
+            return TENTA_DE_NOVO;
+        if(filho == NULL)
+            res = tentaNovo_NOOtimista(a, id, no, dir, versaoNo, chave, valor);
+        else{
+            int proxDir = compara_NOOtimista(chave, filho->chave);
+            if(proxDir == 0)
+                res = tentaReativa_NOOtimista(filho, valor);
+            else{
+                unsigned long long versaoFilho = le_NOOtimista(&filho->versao);
+                if(versaoFilho & ENCOLHENDO)
+                    esperaEncolher_NOOtimista(filho, versaoFilho);
+                else if(versaoFilho != DESLIGADO && filho == filho_NOOtimista(no, dir)){
+                    if(le_NOOtimista(&no->versao) != versaoNo)
+                        return TENTA_DE_NOVO;
+                    res = tentaInsere_NOOtimista(a, id, filho, proxDir, versaoFilho, chave, valor);
+                }
+            }
+        }
+    }while(res == TENTA_DE_NOVO);
+    return res;
+}
+
+//Insere a chave. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insere_ArvAVLOtimista(ArvAVLOtimista *a, int id, int chave, int valor){
+    entra_Epoca(&a->ep, id);
+    int res;
+    do{
+        res = tentaInsere_NOOtimista(a, id, &a->raizFalsa, 1, le_NOOtimista(&a->raizFalsa.versao), chave, valor);
+    }while(res == TENTA_DE_NOVO);
+    sai_Epoca(&a->ep, id);
+    if(a->aposentados[id].quant >= a->aposentados[id].limite) //O balanceamento pode ter desligado ns de roteamento
+        recuperaThread_Epoca(&a->ep, &a->aposentados[id]);
+    return res;
+}
+
+//==================Remoo==========================
+
+//Remove a chave do n no, filho de pai
+//Com 2 filhos o n vira de roteamento; seno  desligado na hora, travando pai e no
+int tentaRemoveNo_NOOtimista(ArvAVLOtimista *a, int id, struct NOOtimista *pai, struct NOOtimista *no){
+    if(!le_NOOtimista(&no->presente))
+        return 0;
+    if(le_NOOtimista(&no->esq) != NULL && le_NOOtimista(&no->dir) != NULL){
+        trava_NOOtimista(no);
+        if(no->versao == DESLIGADO || no->esq == NULL || no->dir == NULL){
+            destrava_NOOtimista(no);
+            return TENTA_DE_NOVO;
+        }
+        int res = no->presente;
+        escreve_NOOtimista(&no->presente, (char) 0);
+        destrava_NOOtimista(no);
+        return res;
+    }
+    trava_NOOtimista(pai);
+    if(pai->versao == DESLIGADO || le_NOOtimista(&no->pai) != pai || le_NOOtimista(&no->versao) == DESLIGADO){
+        destrava_NOOtimista(pai);
+        return TENTA_DE_NOVO;
+    }
+    trava_NOOtimista(no);
+    int res = TENTA_DE_NOVO;
+    if(!no->presente)
+        res = 0;
+    else if(no->esq == NULL || no->dir == NULL){
+        escreve_NOOtimista(&no->presente, (char) 0);
+        desligaTravado_NOOtimista(pai, no);
+        res = 1;
+    }
+    destrava_NOOtimista(no);
+    destrava_NOOtimista(pai);
+    if(res == 1){
+        aposenta_Epoca(&a->ep, &a->aposentados[id], no);
+        corrigeAlturaEBalanceia_NOOtimista(a, id, pai);
+    }
+    return res;
+}
+
+int tentaRemove_NOOtimista(ArvAVLOtimista *a, int id, struct NOOtimista *no, int dir, unsigned long long versaoNo, int valor){
+    int res;
+    do{
+        res = TENTA_DE_NOVO;
+        struct NOOtimista *filho = filho_NOOtimista(no, dir);
+        if(le_NOOtimista(&no->versao) != versaoNo)
+            return TENTA_DE_NOVO;
+        if(filho == NULL)
+            return 0;
+        int proxDir = compara_NOOtimista(valor, filho->chave);
+        if(proxDir == 0)
+            res = tentaRemoveNo_NOOtimista(a, id, no, filho);
+        else{
+            unsigned long long versaoFilho = le_NOOtimista(&filho->versao);
+            if(versaoFilho & ENCOLHENDO)
+                esperaEncolher_NOOtimista(filho, versaoFilho);
+            else if(versaoFilho != DESLIGADO && filho == filho_NOOtimista(no, dir)){
+                if(le_NOOtimista(&no->versao) != versaoNo)
+                    return TENTA_DE_NOVO;
+                res = tentaRemove_NOOtimista(a, id, filho, proxDir, versaoFilho, valor);
+            }
+        }
+    }while(res == TENTA_DE_NOVO);
+    return res;
+}
+
+//Remove a chave. Retorna 1 se removeu ou 0 se no encontrou
+int remove_ArvAVLOtimista(ArvAVLOtimista *a, int id, int valor){
+    entra_Epoca(&a->ep, id);
+    int res;
+    do{
+        res = tentaRemove_NOOtimista(a, id, &a->raizFalsa, 1, le_NOOtimista(&a->raizFalsa.versao), valor);
+    }while(res == TENTA_DE_NOVO);
+    sai_Epoca(&a->ep, id);
+    if(a->aposentados[id].quant >= a->aposentados[id].limite)
+        recuperaThread_Epoca(&a->ep, &a->aposentados[id]);
+    return res;
+}
+
+//Quantidade de chaves presentes. S com a rvore parada (usado para conferir os testes)
+int total_NOOtimista(struct NOOtimista *no){
+    if(no == NULL)
+        return 0;
+    return no->presente + total_NOOtimista(no->esq) + total_NOOtimista(no->dir);
+}
+
+int total_ArvAVLOtimista(ArvAVLOtimista *a){
+    return total_NOOtimista(a->raizFalsa.dir);
+}
+
+#endif
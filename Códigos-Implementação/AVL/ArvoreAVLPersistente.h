@@ -0,0 +1,208 @@
+#ifndef ARVOREAVLPERSISTENTE_H
+#define ARVOREAVLPERSISTENTE_H
+
+#include "ArvoreAVL.h"
+#include "../Comum/Persistente.h" //Contagem de referncias e cpia dos ns compartilhados
+
+//AVL persistente: cada alterao gera uma nova verso e as verses antigas continuam valendo
+//S os ns do caminho da raiz at o ponto alterado (e os que as rotaes mexem) so copiados, e s se forem compartilhados
+//com alguma verso guardada (Comum/Persistente.h)
+//A rvore tem uma verso atual, alterada por inserePersistente_ArvAVL e removePersistente_ArvAVL.
+//guardaVersao_ArvAVL tira uma foto dela em O(1): a foto pode ser percorrida ou consultada (consulta_ArvAVL(&versao, ...))
+//enquanto a verso atual continua mudando, inclusive por outras threads, sem trava nenhuma
+//insereVersao_ArvAVL e removeVersao_ArvAVL criam uma verso nova a partir de qualquer verso guardada
+//Toda verso guardada deve ser solta (soltaVersao_ArvAVL) pela thread dona da rvore
+//A rvore s pode ser alterada pelas funes daqui
+
+//Cabealho: comea igual ao da AVL, ento alocador_ArvAVL continua funcionando
+struct CabecaArvAVLPersistente{
+    struct NO* raiz; //Verso atual. Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns de todas as verses
+    struct Versoes<struct NO> ver; //Reserva de ns e contagem dos ns vivos
+};
+
+struct Versoes<struct NO>* versoes_ArvAVL(ArvAVL* raiz){
+    return &((struct CabecaArvAVLPersistente*) raiz)->ver;
+}
+
+//Cria a rvore vazia no modo persistente
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvAVL* criaPersistente_ArvAVL(int modo = ALOCA_MALLOC){
+    struct CabecaArvAVLPersistente* cab = (struct CabecaArvAVLPersistente*) malloc(sizeof(struct CabecaArvAVLPersistente));
+    if(cab == NULL)
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    inicia_Versoes(&cab->ver, &cab->aloc);
+    return &cab->raiz;
+}
+
+//Libera a verso atual e o cabealho. As verses guardadas devem ter sido soltas antes
+//(na arena, as que sobrarem so liberadas junto com os blocos)
+void liberaPersistente_ArvAVL(ArvAVL* raiz){
+    if(raiz == NULL)
+        return;
+    struct Versoes<struct NO>* v = versoes_ArvAVL(raiz);
+    Alocador<struct NO>* aloc = alocador_ArvAVL(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);
+    else{
+        solta_Versoes(v, *raiz);
+        libera_Versoes(v);
+    }
+    free(raiz);
+}
+
+//Ns vivos, somando a verso atual e todas as guardadas
+size_t nosPersistente_ArvAVL(ArvAVL* raiz){
+    return versoes_ArvAVL(raiz)->nos;
+}
+
+//Prepara as rotaes: os ns que RotacaoLL/LR (ou RR/RL) alteram alm de atual passam a poder ser alterados
+//atual j pode ser alterado
+void preparaEsquerdaPersistente_NO(struct NO* atual, int dupla, struct Versoes<struct NO>* v){
+    atual->esq = escreve_Versoes(v, atual->esq);
+    if(dupla)
+        atual->esq->dir = escreve_Versoes(v, atual->esq->dir);
+}
+
+void preparaDireitaPersistente_NO(struct NO* atual, int dupla, struct Versoes<struct NO>* v){
+    atual->dir = escreve_Versoes(v, atual->dir);
+    if(dupla)
+        atual->dir->esq = escreve_Versoes(v, atual->dir->esq);
+}
+
+//Mesma insero de insere_NO, mas tornando cada n do caminho altervel antes de mexer nele
+//Na insero, os ns das rotaes esto todos no caminho. A chave no pode estar na rvore
+void inserePersistente_NO(ArvAVL *raiz, int chave, int valor, struct Versoes<struct NO>* v){
+    if(*raiz == NULL){
+        struct NO* novo = novo_Versoes(v);
+        novo->info = valor;
+        novo->chave = chave;
+        novo->altura = 0;
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *raiz = novo;
+        return;
+    }
+    struct NO* atual = escreve_Versoes(v, *raiz);
+    *raiz = atual;
+    if(chave < atual->chave){
+        inserePersistente_NO(&atual->esq, chave, valor, v);
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(chave < atual->esq->chave)
+                RotacaoLL(raiz);
+            else
+                RotacaoLR(raiz);
+        }
+    }else{
+        inserePersistente_NO(&atual->dir, chave, valor, v);
+        if(fatorBalanceamento_NO(atual) >= 2){
+            if(atual->dir->chave < chave)
+                RotacaoRR(raiz);
+            else
+                RotacaoRL(raiz);
+        }
+    }
+    atual->altura = maior(altura_NO(atual->esq), altura_NO(atual->dir)) + 1;
+}
+
+//Mesma remoo de remove_NO, tornando alterveis os ns do caminho e, antes das rotaes, os da subrvore irm
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n. A chave tem que estar na rvore
+void removePersistente_NO(ArvAVL *raiz, int valor, struct Versoes<struct NO>* v){
+    struct NO* atual = escreve_Versoes(v, *raiz);
+    *raiz = atual;
+    if(valor < atual->chave){
+        removePersistente_NO(&atual->esq, valor, v);
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da esquerda, rebalancear na direita
+            int dupla = altura_NO(atual->dir->esq) > altura_NO(atual->dir->dir);
+            preparaDireitaPersistente_NO(atual, dupla, v);
+            if(dupla)
+                RotacaoRL(raiz);
+            else
+                RotacaoRR(raiz);
+        }
+    }else if(valor > atual->chave){
+        removePersistente_NO(&atual->dir, valor, v);
+        if(fatorBalanceamento_NO(atual) >= 2){ //Removi da direita, rebalancear na esquerda
+            int dupla = altura_NO(atual->esq->dir) > altura_NO(atual->esq->esq);
+            preparaEsquerdaPersistente_NO(atual, dupla, v);
+            if(dupla)
+                RotacaoLR(raiz);
+            else
+                RotacaoLL(raiz);
+        }
+    }else{
+        if(atual->esq == NULL || atual->dir == NULL){ //N tem 1 filho ou nenhum: o filho ocupa o lugar dele
+            *raiz = guarda_Versoes((atual->esq != NULL) ? atual->esq : atual->dir);
+            solta_Versoes(v, atual); //Como atual tinha s essa referncia, volta para o alocador e o filho perde a dele
+            return;
+        }
+        struct NO* temp = procuraMenor(atual->dir); //Sucessor
+        atual->chave = temp->chave;
+        atual->info = temp->info;
+        removePersistente_NO(&atual->dir, atual->chave, v);
+        if(fatorBalanceamento_NO(atual) >= 2){
+            int dupla = altura_NO(atual->esq->dir) > altura_NO(atual->esq->esq);
+            preparaEsquerdaPersistente_NO(atual, dupla, v);
+            if(dupla)
+                RotacaoLR(raiz);
+            else
+                RotacaoLL(raiz);
+        }
+    }
+    (*raiz)->altura = maior(altura_NO((*raiz)->esq), altura_NO((*raiz)->dir)) + 1;
+}
+
+//Insere na verso atual. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int inserePersistente_ArvAVL(ArvAVL *raiz, int chave, int valor){
+    if(raiz == NULL)
+        return 0;
+    struct Versoes<struct NO>* v = versoes_ArvAVL(raiz);
+    if(consulta_ArvAVL(raiz, chave) || !reserva_Versoes(v)) //No copia nada se a chave j existe
+        return 0;
+    inserePersistente_NO(raiz, chave, valor, v);
+    return 1;
+}
+
+//Remove da verso atual. Retorna 1 se removeu ou 0 (no encontrou ou falta de memria)
+int removePersistente_ArvAVL(ArvAVL *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    struct Versoes<struct NO>* v = versoes_ArvAVL(raiz);
+    if(!consulta_ArvAVL(raiz, valor) || !reserva_Versoes(v))
+        return 0;
+    removePersistente_NO(raiz, valor, v);
+    return 1;
+}
+
+//Guarda a verso atual em O(1). A verso devolvida no muda mais, e deve ser solta com soltaVersao_ArvAVL
+ArvAVL guardaVersao_ArvAVL(ArvAVL *raiz){
+    return guarda_Versoes(*raiz);
+}
+
+//Solta uma verso guardada. Os ns que s ela usava voltam para o alocador
+void soltaVersao_ArvAVL(ArvAVL *raiz, ArvAVL versao){
+    solta_Versoes(versoes_ArvAVL(raiz), versao);
+}
+
+//Retorna uma nova verso: versao com a chave inserida. versao continua valendo
+//Se a chave j existe ou faltou memria, a nova verso tem o mesmo contedo. As duas devem ser soltas
+ArvAVL insereVersao_ArvAVL(ArvAVL *raiz, ArvAVL versao, int chave, int valor){
+    struct Versoes<struct NO>* v = versoes_ArvAVL(raiz);
+    ArvAVL nova = guarda_Versoes(versao);
+    if(!consulta_ArvAVL(&nova, chave) && reserva_Versoes(v))
+        inserePersistente_NO(&nova, chave, valor, v);
+    return nova;
+}
+
+//Retorna uma nova verso: versao sem a chave. versao continua valendo
+ArvAVL removeVersao_ArvAVL(ArvAVL *raiz, ArvAVL versao, int valor){
+    struct Versoes<struct NO>* v = versoes_ArvAVL(raiz);
+    ArvAVL nova = guarda_Versoes(versao);
+    if(consulta_ArvAVL(&nova, valor) && reserva_Versoes(v))
+        removePersistente_NO(&nova, valor, v);
+    return nova;
+}
+
+#endif
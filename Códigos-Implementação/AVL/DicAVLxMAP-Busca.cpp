@@ -24,283 +24,9 @@ private:
 };
 
 
-typedef struct NO* ArvAVL;
-
-//Definio do n do dicionrio
-struct NO{
-    int info; //Informao propriamente dita
-    int chave; //Chave associada  informao
-    int altura; //Armazenar a altura daquela subrvore. Usado para clculo do Fator de Balanceamento sempre que adicionar ou remover algum elemento.
-    struct NO *esq; //Filho esquerdo
-    struct NO *dir; //Filho direito
-};
-
-//Cria a rvore alocando o n raiz e retornando o ponteiro
-ArvAVL* cria_ArvAVL(){
-    ArvAVL* raiz = (ArvAVL*) malloc(sizeof(ArvAVL));
-    if(raiz != NULL) //Erro na alocao de memria
-        *raiz = NULL;
-    return raiz;
-}
-
-//Liberar um n
-void libera_NO(struct NO* no){
-    if(no == NULL) //Se j est vazia, no tem nada a fazer.
-        return;
-    libera_NO(no->esq); //Caso contrrio libera recursivamente todos os ns.
-    libera_NO(no->dir);
-    free(no); //Como usei malloc, usar o free ao invs de delete.
-    no = NULL;
-}
-
-//Liberar toda a rvore, utilizando a funo libera_NO
-void libera_ArvAVL(ArvAVL* raiz){
-    if(raiz == NULL)
-        return;
-    libera_NO(*raiz);//libera cada n
-    free(raiz);//libera a raiz
-}
-
-//Funo auxiliar que retorna a altura de um determinado n
-int altura_NO(struct NO* no){
-    if(no == NULL)
-        return -1; //Se o n no existe, definimos que a altura  -1
-    else
-    return no->altura;
-}
-
-//Funo auxiliar para calcular o FB do n
-int fatorBalanceamento_NO(struct NO* no){
-    return labs(altura_NO(no->esq) - altura_NO(no->dir)); //Definio: FB = h(esqu) - h(dir). labs retorna o mdulo.
-}
-
-//Funo auxiliar para calcular a maior altura entre duas subrvores
-int maior(int x, int y){
-    if(x > y)
-        return x;
-    else
-        return y;
-}
-
-//Imprime um percurso pr-ordem para testes
-void preOrdem_ArvAVL(ArvAVL *raiz){
-    if(raiz == NULL)
-        return;
-    if(*raiz != NULL){
-        printf("Chave %d: - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
-        preOrdem_ArvAVL(&((*raiz)->esq));
-        preOrdem_ArvAVL(&((*raiz)->dir));
-    }
-}
-
-//Imprime um percurso em-ordem para testes
-void emOrdem_ArvAVL(ArvAVL *raiz){
-    if(raiz == NULL)
-        return;
-    if(*raiz != NULL){
-        emOrdem_ArvAVL(&((*raiz)->esq));
-        printf("Chave %d: - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
-        emOrdem_ArvAVL(&((*raiz)->dir));
-    }
-}
-
-//Imprime um percurso ps-ordem para testes
-void posOrdem_ArvAVL(ArvAVL *raiz){
-    if(raiz == NULL)
-        return;
-    if(*raiz != NULL){
-        posOrdem_ArvAVL(&((*raiz)->esq));
-        posOrdem_ArvAVL(&((*raiz)->dir));
-        printf("Chave %d:  - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
-    }
-}
-
-//A consulta  idntica a uma rvore Binria
-int consulta_ArvAVL(ArvAVL *raiz, int valor){
-    if(raiz == NULL) //rvopre vazia?
-        return 0; //No encontrou
-    struct NO* atual = *raiz;
-    while(atual != NULL){
-        if(valor == atual->chave){ //Valor procurado est no n atual
-            return 1; //Encontrou
-        }
-        if(valor > atual->chave) //Se o valor procurado for maior que o n atual, procurar na subvore direita
-            atual = atual->dir;
-        else
-            atual = atual->esq; //Se o valor procurado for menor que o n atual, procurar na subvore esquerda
-    }
-    return 0; //No encontrou
-}
-
-
-//==================Implementao das rotaes==========================
-
-//Rotao  direita (LL)
-void RotacaoLL(ArvAVL *A){
-    //printf("RotacaoLL\n");
-    struct NO *B; //Nova raiz
-    B = (*A)->esq; //Filho da esquerda vira a nova raiz
-    (*A)->esq = B->dir; //O filho da direita do filho da esquerda vira filho da esquerda do filho da direita
-    B->dir = *A; //Raiz original vira filho da direita da nova raiz
-    (*A)->altura = maior(altura_NO((*A)->esq),altura_NO((*A)->dir)) + 1; //Atualiza a altura da raiz original
-    B->altura = maior(altura_NO(B->esq),(*A)->altura) + 1; //Atualiza a altura da nova raiz
-    *A = B;
-}
-
-//Rotao  esquerda (RR)
-void RotacaoRR(ArvAVL *A){
-    //printf("RotacaoRR\n");
-    struct NO *B; //Nova raiz
-    B = (*A)->dir; //Filho da direita vira a nova raiz
-    (*A)->dir = B->esq; //O filho da esquerda do filho da direita vira filho da direita do filho da esquerda
-    B->esq = (*A); //Raiz original vira filho da esquerda da nova raiz
-    (*A)->altura = maior(altura_NO((*A)->esq),altura_NO((*A)->dir)) + 1; //Atualiza a altura da raiz original
-    B->altura = maior(altura_NO(B->dir),(*A)->altura) + 1; //Atualiza a altura da nova raiz
-    (*A) = B;
-}
-
-//Rotao dupla  direita (LR). So duas rotaes simples.
-void RotacaoLR(ArvAVL *A){
-    RotacaoRR(&(*A)->esq); //Rotao  esquerda na sub-rvore da esquerda
-    RotacaoLL(A); //Rotao  direita na rvore original
-}
-
-//Rotao dupla  esquerda (RL). So duas rotaes simples.
-void RotacaoRL(ArvAVL *A){
-    RotacaoLL(&(*A)->dir); //Rotao  direita na subrvore da direita
-    RotacaoRR(A); //Rotao  esquerda na rvore original
-}
-//==================================================
-
-//Inserir um valor na AVL
-//Se a raiz for vazia ou folha, inserir o n
-//Se o valor a ser inserido for menor que a raiz, v para a subrvore esquerda
-//Se o valor a ser inserido for maior que a raiz, v para a subrvore direita
-//Aplicar o mtodo recursivamente
-//Ao voltar na recurso, recalcular o valor da altura de cada subrvore
-//Aplicar as rotaes necessrias se FB = +2 ou -2
-int insere_ArvAVL(ArvAVL *raiz, int chave, int valor){
-    int res;
-    if(*raiz == NULL){//Se a raiz for vazia ou for uma folha, inserir o n
-        struct NO *novo;
-        novo = (struct NO*)malloc(sizeof(struct NO));
-        if(novo == NULL)
-            return 0; //Alocao de memria falhou
-        novo->info = valor;
-        novo->chave = chave;
-        novo->altura = 0; //Folha ou raiz
-        novo->esq = NULL;
-        novo->dir = NULL;
-        *raiz = novo;
-        return 1; //Insero ocorreu corretamente
-    }
-
-    struct NO *atual = *raiz;
-    if(chave < atual->chave){ //Se o valor a ser inserido for menor que a raiz, v para a subrvore esquerda
-        if((res = insere_ArvAVL(&(atual->esq), chave, valor)) == 1){ //Aplicar o mtodo recursivamente inserindo os valores
-            if(fatorBalanceamento_NO(atual) >= 2){ //Balanceamento. Aplicar as rotaes necessrias se FB = +2 ou -2
-                if(chave < (*raiz)->esq->chave ){
-                    RotacaoLL(raiz); //Valor a ser inserido est na parte "externa" da rvore. Rotao  direita.
-                }else{
-                    RotacaoLR(raiz); //Valor a ser inserido est na parte "interna" da rvore. Rotao dupla  direita
-                }
-            }
-        }
-    }else{
-        if(chave > atual->chave){ //Se o valor a ser inserido for maior que a raiz, v para a subrvore direita
-            if((res = insere_ArvAVL(&(atual->dir), chave, valor)) == 1){ //Aplicar o mtodo recursivamente inserindo os valores
-                if(fatorBalanceamento_NO(atual) >= 2){ //Balanceamento. Aplicar as rotaes necessrias se FB = +2 ou -2
-                    if((*raiz)->dir->chave < chave){
-                        RotacaoRR(raiz); //Valor a ser inserido est na parte "externa" da rvore. Rotao  esquerda.
-                    }else{
-                        RotacaoRL(raiz); //Valor a ser inserido est na parte "interna" da rvore. Rotao dupla  esquerda
-                    }
-                }
-            }
-        }else{
-            return 0; //Valor j encontra-se na rvore e no ser inserido
-        }
-    }
-
-    atual->altura = maior(altura_NO(atual->esq),altura_NO(atual->dir)) + 1; //Ao voltar na recurso, recalcular o valor da altura de cada subrvore
-
-    return res; //Retorna 1 se insero ocorreu corretamente ou 0 (alocao de memria falhou ou chave j se encontra na rvore)
-}
-
-//Funo auxiliar utilizada na remoo de um n. Trata da remoo de um n com 2 filhos.
-//Procura pelo n mais a esquerda.
-struct NO* procuraMenor(struct NO* atual){
-    struct NO *no1 = atual;
-    struct NO *no2 = atual->esq;
-    while(no2 != NULL){
-        no1 = no2;
-        no2 = no2->esq;
-    }
-    return no1;
-}
-
-//Remove n da rvore. Podemos ter 3 situaes:
-// - n folha (sem filhos)
-// - n com 1 filho
-// - n com 2 filhos
-//Devemos tambm tratar o balanceamento da mesma forma que na insero
-//Remover um n da subrvore da direita equivale a inserir um n na subrvore da esquerda
-int remove_ArvAVL(ArvAVL *raiz, int valor){
-	if(*raiz == NULL){// No se pode remover de uma rvore vazia
-	    return 0; //Remoo falhou!
-	}
-
-    int res; //Resposta da remoo, j que  uma funo recursiva
-	if(valor < (*raiz)->chave){ //Se o valor a remover for menor que a raiz, vou para a subrvore da esquerda recursivamente
-	    if((res = remove_ArvAVL(&(*raiz)->esq,valor)) == 1){ //Se conseguir remover, ento calculo o FB para ver se preciso balancear
-            if(fatorBalanceamento_NO(*raiz) >= 2){
-                if(altura_NO((*raiz)->dir->esq) <= altura_NO((*raiz)->dir->dir)) //Diferena de altura dos filhos. Removi da esquerda, rebalancear na direita
-                    RotacaoRR(raiz); //N est na parte "externa" da rvore. Rotao  esquerda.
-                else
-                    RotacaoRL(raiz); //N est na parte "interna" da rvore. Rotao dupla  esquerda
-            }
-	    }
-	}
-
-	if((*raiz)->chave < valor){ //Se o valor a remover for maior que a raiz, vou para a subrvore da direita recursivamente
-	    if((res = remove_ArvAVL(&(*raiz)->dir, valor)) == 1){ //Se conseguir remover, ento calculo o FB para ver se preciso balancear
-            if(fatorBalanceamento_NO(*raiz) >= 2){
-                if(altura_NO((*raiz)->esq->dir) <= altura_NO((*raiz)->esq->esq)) //Diferena de altura dos filhos. Remove da direita, rebalancear na esquerda
-                    RotacaoLL(raiz); //N est na parte "externa" da rvore. Rotao  direita
-                else
-                    RotacaoLR(raiz); //N est na parte "interna" da rvore. Rotao dupla  direita
-            }
-	    }
-	}
-
-	if((*raiz)->chave == valor){
-	    if(((*raiz)->esq == NULL || (*raiz)->dir == NULL)){// N tem 1 filho ou nenhum
-			struct NO *oldNode = (*raiz);
-			if((*raiz)->esq != NULL) //Qual filho  folha?
-                *raiz = (*raiz)->esq;
-            else
-                *raiz = (*raiz)->dir;
-			free(oldNode);
-		}else { // N tem 2 filhos
-			struct NO* temp = procuraMenor((*raiz)->dir); //Procurar pelo menor valor da subrvore da direita
-			(*raiz)->chave = temp->chave; //Substituir pelo n mais a esquerda da subrvore da direita
-			remove_ArvAVL(&(*raiz)->dir, (*raiz)->chave); //Remove recursivamente para tratar os problemas que podemos ter
-            if(fatorBalanceamento_NO(*raiz) >= 2){ //Tratar o balanceamento aps a remoo. Removi da survore da direita, tenho que balancear a subrvore da esquerda
-				if(altura_NO((*raiz)->esq->dir) <= altura_NO((*raiz)->esq->esq))
-					RotacaoLL(raiz); //N est na parte "externa" da rvore. Rotao  direita
-				else
-					RotacaoLR(raiz); //N est na parte "interna" da rvore. Rotao dupla  direita
-			}
-		}
-		if (*raiz != NULL)
-            (*raiz)->altura = maior(altura_NO((*raiz)->esq),altura_NO((*raiz)->dir)) + 1; //Atualiza as alturas
-		return 1;
-	}
-
-	(*raiz)->altura = maior(altura_NO((*raiz)->esq),altura_NO((*raiz)->dir)) + 1;
-
-	return res;
-}
+#include "ArvoreAVL.h" //Implementao da rvore AVL (compartilhada pelos programas de teste)
+#include "ArvoreAVLGenerica.h" //Verso genrica (tipos da chave e da informao como parmetros de template)
+#include "../Comum/GeraChaves.h" //Permutao que sorteia as chaves das consultas
 
 //Exemplo de uso
 int main(){
@@ -309,6 +35,8 @@ int main(){
     double t = tmr.elapsed(); //Tempo de execuo do trecho de cdigo em segundos (s)
     int N = 15000000; //Nmero de ns da rvore/Mapa. Range 500.000-15.000.000
     int num_rodadas = 500000; //Nmero de rodadas para pegar a mdia de tempos e evitar distores
+    int modo_alocacao = ALOCA_MALLOC; //Alocao dos ns da rvore: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int carga_ordenada = 0; //1: monta a rvore de uma vez a partir do vetor ordenado 0..N-1 (carregaOrdenado_ArvAVL) em vez de N inseres
     double somaMAPA = 0.0, somaAVL = 0.0; //Tempos para cada implementao
     double *tempo_AVL, *tempo_MAPA;
     tempo_AVL = (double *)malloc(N * sizeof(double)); //Vetores para armazenar os tempos de insero de cada valor
@@ -317,7 +45,13 @@ int main(){
     int res; //Resposta se a insero ocorreu corretamente (1) ou no (0)
     std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
     std::cout<<std::endl;
-    //GeraAleatorios(numeros,num_rodadas,N);// Vetor com valores aleatrios para buscar
+    //Chaves das consultas: num_rodadas chaves distintas de 0..N-1 em ordem aleatria, as mesmas para todas as implementaes
+    //Em sequncia (0, 1, 2...), chaves vizinhas dividem linhas de cache e o caminho na rvore, o que favorece principalmente os lotes
+    int *consultas = (int *)malloc(num_rodadas * sizeof(int));
+    struct Permutacao permutacao;
+    inicia_Permutacao(&permutacao, N, 42);
+    for(int j=0;j<num_rodadas;j++)
+        consultas[j] = (int) aplica_Permutacao(&permutacao, j);
 
     //=============================Mapa============================================
     std::map<int, int> Mapa; //Para comparar com a implementao de rvore AVL
@@ -334,7 +68,7 @@ int main(){
     {
         tmr.reset();
         //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
-        if(Mapa.find(j)!= Mapa.end())
+        if(Mapa.find(consultas[j])!= Mapa.end())
         {
         //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
             t = tmr.elapsed();
@@ -351,12 +85,20 @@ int main(){
     std::cout << "Tempo medio para encontrar elemento no Mapa com " << N << " nos = " << somaMAPA/num_rodadas << " segundos" << std::endl; //Exibe na tela os valores
     std::cout<<std::endl;
     //=============================AVL============================================
-    avl = cria_ArvAVL(); //Cria rvore AVL
+    avl = cria_ArvAVL(modo_alocacao); //Cria rvore AVL
     std::cout<<"Inserindo elementos na AVL..."<<std::endl;
     std::cout<<std::endl;
-    for(int i=0;i<N;i++) //Insere elementos na rvore
-    {
-        res = insere_ArvAVL(avl,i,i);
+    if(carga_ordenada){ //Construo em O(N), sem rotaes
+        int *chaves = (int *)malloc(N * sizeof(int));
+        for(int i=0;i<N;i++)
+            chaves[i] = i;
+        res = carregaOrdenado_ArvAVL(avl,chaves,chaves,N); //Chave e informao iguais, como nas inseres
+        free(chaves);
+    }else{
+        for(int i=0;i<N;i++) //Insere elementos na rvore
+        {
+            res = insere_ArvAVL(avl,i,i);
+        }
     }
 
     std::cout<<"Buscando elementos e calculando tempo..."<<std::endl;
@@ -365,7 +107,7 @@ int main(){
     {
         tmr.reset();
         //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
-        if(consulta_ArvAVL(avl,j)== 1) //Zero no encontrou, 1 encontrou
+        if(consulta_ArvAVL(avl,consultas[j])== 1) //Zero no encontrou, 1 encontrou
         {
         //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
             t = tmr.elapsed();
@@ -374,6 +116,26 @@ int main(){
         tempo_AVL[j] = t;
     }
 
+    //Mesmas chaves, mas consultadas em lotes de TAM_LOTE com consultaLote_ArvAVL (buscas intercaladas com prefetch)
+    //Mede o tempo de cada lote e divide pelo total de chaves no final
+    const int TAM_LOTE = 256; //Nosso caminho de leitura recebe as consultas em lotes de centenas
+    int chaves_lote[TAM_LOTE], resultados_lote[TAM_LOTE];
+    double somaLote = 0.0;
+    int encontrouLote = 1;
+    for(int j=0;j<num_rodadas;j+=TAM_LOTE)
+    {
+        int n = (num_rodadas - j < TAM_LOTE) ? num_rodadas - j : TAM_LOTE;
+        for(int i=0;i<n;i++)
+            chaves_lote[i] = consultas[j + i];
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = consultaLote_ArvAVL(avl,chaves_lote,n,resultados_lote);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        somaLote = somaLote + tmr.elapsed();
+        if(res != n)
+            encontrouLote = 0; //Alguma chave do lote no foi encontrada
+    }
+
     libera_ArvAVL(avl);
 
     for(int j=0;j<num_rodadas;j++) //Calcula o tempo total para encontrar o elemento em num_rodadas rodadas
@@ -381,10 +143,77 @@ int main(){
         somaAVL = somaAVL + tempo_AVL[j];
     }
     std::cout << "Tempo medio para encontrar elemento na AVL com " << N << " nos = " << somaAVL/num_rodadas << " segundos" << std::endl; //Exibe na tela
+    std::cout << "Tempo medio para encontrar elemento na AVL (lotes de " << TAM_LOTE << ") com " << N << " nos = " << somaLote/num_rodadas << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================AVL genrica=================================
+    //Mesmas buscas na verso genrica com <int, int>: o tempo deve ser o mesmo da AVL com int
+    struct ArvAVLGenerica<int, int> *generica = cria_ArvAVLGenerica<int, int>(modo_alocacao);
+    for(int i=0;i<N;i++)
+        insere_ArvAVLGenerica(generica,i,i);
+    double somaGenerica = 0.0;
+    int encontrouGenerica = 1;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = consulta_ArvAVLGenerica(generica,consultas[j]);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        somaGenerica = somaGenerica + tmr.elapsed();
+        if(res != 1)
+            encontrouGenerica = 0;
+    }
+    libera_ArvAVLGenerica(generica);
+    std::cout << "Tempo medio para encontrar elemento na AVL generica <int, int> com " << N << " nos = " << somaGenerica/num_rodadas << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================AVL congelada=================================
+    //Cpia congelada (vetor na ordem de Eytzinger, sem ponteiros) em vrios tamanhos, comparada com a prpria AVL
+    //Para cada N a AVL  montada e congelada, e as duas recebem as mesmas num_rodadas consultas, sorteadas em 0..N-1
+    int tamanhos[] = {500000, 1000000, 2000000, 5000000, 10000000, 15000000};
+    int num_tamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    int encontrouCongelada = 1;
+    std::cout<<"Buscando elementos na AVL e na AVL congelada para cada N..."<<std::endl;
+    for(int k=0;k<num_tamanhos;k++)
+    {
+        int n = tamanhos[k];
+        ArvAVL *arv = cria_ArvAVL(modo_alocacao);
+        for(int i=0;i<n;i++)
+            insere_ArvAVL(arv,i,i);
+        inicia_Permutacao(&permutacao, n, 42);
+        for(int j=0;j<num_rodadas;j++)
+            consultas[j] = (int) aplica_Permutacao(&permutacao, j);
+        double somaArvore = 0.0, somaCongelada = 0.0;
+        for(int j=0;j<num_rodadas;j++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = consulta_ArvAVL(arv,consultas[j]);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            somaArvore = somaArvore + tmr.elapsed();
+            if(res != 1)
+                encontrouCongelada = 0;
+        }
+        tmr.reset();
+        struct ArvCongelada *congelada = congela_ArvAVL(arv);
+        double tempo_congela = tmr.elapsed(); //Tempo para criar a cpia
+        for(int j=0;j<num_rodadas;j++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = consulta_ArvCongelada(congelada,consultas[j]);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            somaCongelada = somaCongelada + tmr.elapsed();
+            if(res != 1)
+                encontrouCongelada = 0;
+        }
+        libera_ArvCongelada(congelada);
+        libera_ArvAVL(arv);
+        std::cout << "N = " << n << ": AVL = " << somaArvore/num_rodadas << " s, AVL congelada = " << somaCongelada/num_rodadas << " s (congelar: " << tempo_congela << " s)" << std::endl;
+    }
     std::cout<<std::endl;
     free(tempo_AVL); //Libera o vetor
+    free(consultas);
 
-    if((encontrouAVL==0)||(encontrouMapa==0))
+    if((encontrouAVL==0)||(encontrouMapa==0)||(encontrouLote==0)||(encontrouCongelada==0)||(encontrouGenerica==0))
         std::cout << "Elemento nao encontrado. Desconsiderar dados!!!" << std::endl;
 
     return 0;
@@ -24,284 +24,10 @@ private:
 };
 
 
-typedef struct NO* ArvAVL;
-
-//Definio do n do dicionrio
-struct NO{
-    int info;
-    int chave; //Chave associada  informao
-    int altura; //Armazenar a altura daquela subrvore. Usado para clculo do Fator de Balanceamento sempre que adicionar ou remover algum elemento.
-    struct NO *esq; //Filho esquerdo
-    struct NO *dir; //Filho direito
-};
-
-//Cria a rvore alocando o n raiz e retornando o ponteiro
-
-ArvAVL* cria_ArvAVL(){
-    ArvAVL* raiz = (ArvAVL*) malloc(sizeof(ArvAVL));
-    if(raiz != NULL) //Erro na alocao de memria
-        *raiz = NULL;
-    return raiz;
-}
-
-//Liberar um n
-void libera_NO(struct NO* no){
-    if(no == NULL) //Se j est vazia, no tem nada a fazer.
-        return;
-    libera_NO(no->esq); //Caso contrrio libera recursivamente todos os ns.
-    libera_NO(no->dir);
-    free(no); //Como usei malloc, usar o free ao invs de delete.
-    no = NULL;
-}
-
-//Liberar toda a rvore, utilizando a funo libera_NO
-void libera_ArvAVL(ArvAVL* raiz){
-    if(raiz == NULL)
-        return;
-    libera_NO(*raiz);//libera cada n
-    free(raiz);//libera a raiz
-}
-
-//Funo auxiliar que retorna a altura de um determinado n
-int altura_NO(struct NO* no){
-    if(no == NULL)
-        return -1; //Se o n no existe, definimos que a altura  -1
-    else
-    return no->altura;
-}
-
-//Funo auxiliar para calcular o FB do n
-int fatorBalanceamento_NO(struct NO* no){
-    return labs(altura_NO(no->esq) - altura_NO(no->dir)); //Definio: FB = h(esqu) - h(dir). labs retorna o mdulo.
-}
-
-//Funo auxiliar para calcular a maior altura entre duas subrvores
-int maior(int x, int y){
-    if(x > y)
-        return x;
-    else
-        return y;
-}
-
-//Imprime um percurso pr-ordem para testes
-void preOrdem_ArvAVL(ArvAVL *raiz){
-    if(raiz == NULL)
-        return;
-    if(*raiz != NULL){
-        printf("Chave %d: - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
-        preOrdem_ArvAVL(&((*raiz)->esq));
-        preOrdem_ArvAVL(&((*raiz)->dir));
-    }
-}
-
-//Imprime um percurso em-ordem para testes
-void emOrdem_ArvAVL(ArvAVL *raiz){
-    if(raiz == NULL)
-        return;
-    if(*raiz != NULL){
-        emOrdem_ArvAVL(&((*raiz)->esq));
-        printf("Chave %d: - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
-        emOrdem_ArvAVL(&((*raiz)->dir));
-    }
-}
-
-//Imprime um percurso ps-ordem para testes
-void posOrdem_ArvAVL(ArvAVL *raiz){
-    if(raiz == NULL)
-        return;
-    if(*raiz != NULL){
-        posOrdem_ArvAVL(&((*raiz)->esq));
-        posOrdem_ArvAVL(&((*raiz)->dir));
-        printf("Chave %d:  - Valor: %d\n",(*raiz)->chave,(*raiz)->info);
-    }
-}
-
-//A consulta  idntica a uma rvore Binria
-int consulta_ArvAVL(ArvAVL *raiz, int valor){
-    if(raiz == NULL) //rvore vazia?
-        return 0; //No encontrou
-    struct NO* atual = *raiz;
-    while(atual != NULL){
-        if(valor == atual->chave){ //Valor procurado est no n atual
-            return 1; //Encontrou
-        }
-        if(valor > atual->chave) //Se o valor procurado for maior que o n atual, procurar na subvore direita
-            atual = atual->dir;
-        else
-            atual = atual->esq; //Se o valor procurado for menor que o n atual, procurar na subvore esquerda
-    }
-    return 0; //No encontrou
-}
-
-
-//==================Implementao das rotaes==========================
-
-//Rotao  direita (LL)
-void RotacaoLL(ArvAVL *A){
-    //printf("RotacaoLL\n");
-    struct NO *B; //Nova raiz
-    B = (*A)->esq; //Filho da esquerda vira a nova raiz
-    (*A)->esq = B->dir; //O filho da direita do filho da esquerda vira filho da esquerda do filho da direita
-    B->dir = *A; //Raiz original vira filho da direita da nova raiz
-    (*A)->altura = maior(altura_NO((*A)->esq),altura_NO((*A)->dir)) + 1; //Atualiza a altura da raiz original
-    B->altura = maior(altura_NO(B->esq),(*A)->altura) + 1; //Atualiza a altura da nova raiz
-    *A = B;
-}
-
-//Rotao  esquerda (RR)
-void RotacaoRR(ArvAVL *A){
-    //printf("RotacaoRR\n");
-    struct NO *B; //Nova raiz
-    B = (*A)->dir; //Filho da direita vira a nova raiz
-    (*A)->dir = B->esq; //O filho da esquerda do filho da direita vira filho da direita do filho da esquerda
-    B->esq = (*A); //Raiz original vira filho da esquerda da nova raiz
-    (*A)->altura = maior(altura_NO((*A)->esq),altura_NO((*A)->dir)) + 1; //Atualiza a altura da raiz original
-    B->altura = maior(altura_NO(B->dir),(*A)->altura) + 1; //Atualiza a altura da nova raiz
-    (*A) = B;
-}
-
-//Rotao dupla  direita (LR). So duas rotaes simples.
-void RotacaoLR(ArvAVL *A){
-    RotacaoRR(&(*A)->esq); //Rotao  esquerda na sub-rvore da esquerda
-    RotacaoLL(A); //Rotao  direita na rvore original
-}
-
-//Rotao dupla  esquerda (RL). So duas rotaes simples.
-void RotacaoRL(ArvAVL *A){
-    RotacaoLL(&(*A)->dir); //Rotao  direita na subrvore da direita
-    RotacaoRR(A); //Rotao  esquerda na rvore original
-}
-//==================================================
-
-//Inserir um valor na AVL
-//Se a raiz for vazia ou folha, inserir o n
-//Se o valor a ser inserido for menor que a raiz, v para a subrvore esquerda
-//Se o valor a ser inserido for maior que a raiz, v para a subrvore direita
-//Aplicar o mtodo recursivamente
-//Ao voltar na recurso, recalcular o valor da altura de cada subrvore
-//Aplicar as rotaes necessrias se FB = +2 ou -2
-int insere_ArvAVL(ArvAVL *raiz, int chave, int valor){
-    int res;
-    if(*raiz == NULL){//Se a raiz for vazia ou for uma folha, inserir o n
-        struct NO *novo;
-        novo = (struct NO*)malloc(sizeof(struct NO));
-        if(novo == NULL)
-            return 0; //Alocao de memria falhou
-        novo->info = valor;
-        novo->chave = chave;
-        novo->altura = 0; //Folha ou raiz
-        novo->esq = NULL;
-        novo->dir = NULL;
-        *raiz = novo;
-        return 1; //Insero ocorreu corretamente
-    }
-
-    struct NO *atual = *raiz;
-    if(chave < atual->chave){ //Se o valor a ser inserido for menor que a raiz, v para a subrvore esquerda
-        if((res = insere_ArvAVL(&(atual->esq), chave, valor)) == 1){ //Aplicar o mtodo recursivamente inserindo os valores
-            if(fatorBalanceamento_NO(atual) >= 2){ //Balanceamento. Aplicar as rotaes necessrias se FB = +2 ou -2
-                if(chave < (*raiz)->esq->chave ){
-                    RotacaoLL(raiz); //Valor a ser inserido est na parte "externa" da rvore. Rotao  direita.
-                }else{
-                    RotacaoLR(raiz); //Valor a ser inserido est na parte "interna" da rvore. Rotao dupla  direita
-                }
-            }
-        }
-    }else{
-        if(chave > atual->chave){ //Se o valor a ser inserido for maior que a raiz, v para a subrvore direita
-            if((res = insere_ArvAVL(&(atual->dir), chave, valor)) == 1){ //Aplicar o mtodo recursivamente inserindo os valores
-                if(fatorBalanceamento_NO(atual) >= 2){ //Balanceamento. Aplicar as rotaes necessrias se FB = +2 ou -2
-                    if((*raiz)->dir->chave < chave){
-                        RotacaoRR(raiz); //Valor a ser inserido est na parte "externa" da rvore. Rotao  esquerda.
-                    }else{
-                        RotacaoRL(raiz); //Valor a ser inserido est na parte "interna" da rvore. Rotao dupla  esquerda
-                    }
-                }
-            }
-        }else{
-            return 0; //Valor j encontra-se na rvore e no ser inserido
-        }
-    }
-
-    atual->altura = maior(altura_NO(atual->esq),altura_NO(atual->dir)) + 1; //Ao voltar na recurso, recalcular o valor da altura de cada subrvore
-
-    return res; //Retorna 1 se insero ocorreu corretamente ou 0 (alocao de memria falhou ou chave j se encontra na rvore)
-}
-
-//Funo auxiliar utilizada na remoo de um n. Trata da remoo de um n com 2 filhos
-//Procura pelo n mais a esquerda
-struct NO* procuraMenor(struct NO* atual){
-    struct NO *no1 = atual;
-    struct NO *no2 = atual->esq;
-    while(no2 != NULL){
-        no1 = no2;
-        no2 = no2->esq;
-    }
-    return no1;
-}
-
-//Remove n da rvore. Podemos ter 3 situaes:
-// - n folha (sem filhos)
-// - n com 1 filho
-// - n com 2 filhos
-//Devemos tambm tratar o balanceamento da mesma forma que na insero
-//Remover um n da subrvore da direita equivale a inserir um n na subrvore da esquerda
-int remove_ArvAVL(ArvAVL *raiz, int valor){
-	if(*raiz == NULL){// No se pode remover de uma rvore vazia
-	    return 0; //Remoo falhou!
-	}
-
-    int res; //Resposta da remoo, j que  uma funo recursiva
-	if(valor < (*raiz)->chave){ //Se o valor a remover for menor que a raiz, vou para a subrvore da esquerda recursivamente
-	    if((res = remove_ArvAVL(&(*raiz)->esq,valor)) == 1){ //Se conseguir remover, ento calculo o FB para ver se preciso balancear
-            if(fatorBalanceamento_NO(*raiz) >= 2){
-                if(altura_NO((*raiz)->dir->esq) <= altura_NO((*raiz)->dir->dir)) //Diferena de altura dos filhos. Removi da esquerda, rebalancear na direita
-                    RotacaoRR(raiz); //N est na parte "externa" da rvore. Rotao  esquerda.
-                else
-                    RotacaoRL(raiz); //N est na parte "interna" da rvore. Rotao dupla  esquerda
-            }
-	    }
-	}
-
-	if((*raiz)->chave < valor){ //Se o valor a remover for maior que a raiz, vou para a subrvore da direita recursivamente
-	    if((res = remove_ArvAVL(&(*raiz)->dir, valor)) == 1){ //Se conseguir remover, ento calculo o FB para ver se preciso balancear
-            if(fatorBalanceamento_NO(*raiz) >= 2){
-                if(altura_NO((*raiz)->esq->dir) <= altura_NO((*raiz)->esq->esq)) //Diferena de altura dos filhos. Remove da direita, rebalancear na esquerda
-                    RotacaoLL(raiz); //N est na parte "externa" da rvore. Rotao  direita
-                else
-                    RotacaoLR(raiz); //N est na parte "interna" da rvore. Rotao dupla  direita
-            }
-	    }
-	}
-
-	if((*raiz)->chave == valor){
-	    if(((*raiz)->esq == NULL || (*raiz)->dir == NULL)){// N tem 1 filho ou nenhum
-			struct NO *oldNode = (*raiz);
-			if((*raiz)->esq != NULL) //Qual filho  folha?
-                *raiz = (*raiz)->esq;
-            else
-                *raiz = (*raiz)->dir;
-			free(oldNode);
-		}else { // N tem 2 filhos
-			struct NO* temp = procuraMenor((*raiz)->dir); //Procurar pelo menor valor da subrvore da direita
-			(*raiz)->chave = temp->chave; //Substituir pelo n mais a esquerda da subrvore da direita
-			remove_ArvAVL(&(*raiz)->dir, (*raiz)->chave); //Remove recursivamente para tratar os problemas que podemos ter
-            if(fatorBalanceamento_NO(*raiz) >= 2){ //Tratar o balanceamento aps a remoo. Removi da survore da direita, tenho que balancear a subrvore da esquerda
-				if(altura_NO((*raiz)->esq->dir) <= altura_NO((*raiz)->esq->esq))
-					RotacaoLL(raiz); //N est na parte "externa" da rvore. Rotao  direita
-				else
-					RotacaoLR(raiz); //N est na parte "interna" da rvore. Rotao dupla  direita
-			}
-		}
-		if (*raiz != NULL)
-            (*raiz)->altura = maior(altura_NO((*raiz)->esq),altura_NO((*raiz)->dir)) + 1; //Atualiza as alturas
-		return 1;
-	}
-
-	(*raiz)->altura = maior(altura_NO((*raiz)->esq),altura_NO((*raiz)->dir)) + 1;
-
-	return res;
-}
+#include "ArvoreAVL.h" //Implementao da rvore AVL (compartilhada pelos programas de teste)
+#include "ArvoreAVLGenerica.h" //Verso genrica (tipos da chave e da informao como parmetros de template)
+#include "ArvoreAVLCompacta.h" //Verso compacta (ndices de 32 bits, 16 bytes por n)
+#include "../Comum/Memoria.h" //Conta os bytes usados pelo Mapa
 
 //Exemplo de uso
 int main(){
@@ -309,7 +35,9 @@ int main(){
     double t = tmr.elapsed(); //Tempo de execuo do trecho de cdigo em segundos (s)
     int N = 8500000; //Nmero de ns da rvore/Mapa. Range 500.000-15.000.000
     int num_rodadas = 1; //Nmero de rodadas para pegar a mdia de tempos e evitar distores
-    double somaMAPA = 0.0, somaAVL = 0.0; //Tempos para cada implementao
+    double somaMAPA = 0.0; //Tempo do Mapa. O da rvore  calculado para cada modo de alocao
+    double tempo_libera_MAPA = 0.0; //Tempo para liberar o Mapa
+    size_t bytes_MAPA = 0, bytes_malloc = 0, bytes_arena = 0, bytes_compacta = 0; //Memria usada pelos ns de cada implementao
     double *tempo_AVL, *tempo_MAPA;
     tempo_AVL = (double *)malloc(N * sizeof(double)); //Vetores para armazenar os tempos de insero de cada valor
     tempo_MAPA = (double *)malloc(N * sizeof(double));
@@ -333,6 +61,15 @@ int main(){
             t = tmr.elapsed();
             tempo_MAPA[i] = t;
         }
+        tmr.reset();
+        Mapa.clear(); //Tempo para liberar o Mapa, para comparar com a liberao das rvores
+        tempo_libera_MAPA = tmr.elapsed();
+    }
+    { //Memria ocupada pelo Mapa cheio: preenchido de novo fora da medida, com o alocador que conta os bytes
+        std::map<int, int, std::less<int>, ContaAlocador<std::pair<const int, int> > > MapaConta;
+        for(int i=0;i<N;i++)
+            MapaConta.insert(std::pair<int, int>(i, i));
+        bytes_MAPA = bytes_ContaAlocador;
     }
     std::cout<<"Calculando o tempo medio de insercao..."<<std::endl;
     std::cout<<std::endl;
@@ -341,35 +78,207 @@ int main(){
         somaMAPA = somaMAPA + tempo_MAPA[j];
     }
     std::cout << "Tempo medio para preencher Mapa com " << N << " nos = " << somaMAPA << " segundos" << std::endl; //Exibe na tela os valores
+    std::cout << "Tempo para liberar Mapa com " << N << " nos = " << tempo_libera_MAPA << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================Mapa com dica====================================
+    //Como as chaves chegam em ordem crescente, a posio certa  sempre o fim do Mapa: emplace_hint(end()) no precisa descer da raiz
+    std::cout<<"Inserindo elementos no Mapa com dica e calculando o tempo..."<<std::endl;
+    std::cout<<std::endl;
+    double soma_dica_MAPA = 0.0;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        std::map<int, int> Mapa;
+        for(int i=0;i<N;i++){
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            Mapa.emplace_hint(Mapa.end(), i, i);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            tempo_MAPA[i] = t;
+        }
+    }
+    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores no Mapa com dica
+    {
+        soma_dica_MAPA = soma_dica_MAPA + tempo_MAPA[j];
+    }
+    std::cout << "Tempo medio para preencher Mapa com dica com " << N << " nos = " << soma_dica_MAPA << " segundos" << std::endl;
     std::cout<<std::endl;
     free(tempo_MAPA);
     //=============================AVL============================================
-    std::cout<<"Inserindo elementos na AVL e calculando o tempo..."<<std::endl;
+    //A AVL  medida duas vezes: com um malloc por n e com a arena (Comum/Alocador.h)
+    int modos[2] = {ALOCA_MALLOC, ALOCA_ARENA};
+    const char *nome_modos[2] = {"malloc", "arena"};
+    for(int m=0;m<2;m++)
+    {
+        std::cout<<"Inserindo elementos na AVL ("<<nome_modos[m]<<") e calculando o tempo..."<<std::endl;
+        std::cout<<std::endl;
+        double tempo_libera = 0.0; //Tempo para liberar a rvore inteira
+        for(int j=0;j<num_rodadas;j++)
+        {
+            avl = cria_ArvAVL(modos[m]); //Cria rvore AVL
+            for(int i=0;i<N;i++)
+            {
+                tmr.reset();
+                //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+                res = insere_ArvAVL(avl,i,i);
+                //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+                t = tmr.elapsed();
+                tempo_AVL[i] = t;
+            }
+            if(modos[m] == ALOCA_ARENA) //Memria ocupada pelos ns
+                bytes_arena = alocador_ArvAVL(avl)->memoria;
+            else
+                bytes_malloc = (size_t) N * sizeof(struct NO); //Sem contar o cabealho que o malloc coloca em cada n
+            tmr.reset();
+            libera_ArvAVL(avl);
+            tempo_libera = tmr.elapsed();
+        }
+
+        std::cout<<"Calculando o tempo medio de insercao..."<<std::endl;
+        std::cout<<std::endl;
+        double somaAVL = 0.0;
+        for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na AVL
+        {
+            somaAVL = somaAVL + tempo_AVL[j];
+        }
+        std::cout << "Tempo medio para preencher AVL ("<<nome_modos[m]<<") com " << N << " nos = " << somaAVL << " segundos" << std::endl; //Exibe na tela
+        std::cout << "Tempo para liberar AVL ("<<nome_modos[m]<<") com " << N << " nos = " << tempo_libera << " segundos" << std::endl;
+        std::cout<<std::endl;
+    }
+    //=============================AVL iterativa===================================
+    //Mesma rvore (malloc), mas usando a insero sem recurso, para comparar com insere_ArvAVL
+    std::cout<<"Inserindo elementos na AVL (iterativa) e calculando o tempo..."<<std::endl;
     std::cout<<std::endl;
+    double soma_iterativa = 0.0;
     for(int j=0;j<num_rodadas;j++)
     {
-        avl = cria_ArvAVL(); //Cria rvore AVL
+        avl = cria_ArvAVL(ALOCA_MALLOC); //Cria rvore AVL
         for(int i=0;i<N;i++)
         {
             tmr.reset();
             //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
-            res = insere_ArvAVL(avl,i,i);
+            res = insereIterativo_ArvAVL(avl,i,i);
             //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
             t = tmr.elapsed();
             tempo_AVL[i] = t;
         }
         libera_ArvAVL(avl);
     }
+    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na AVL
+    {
+        soma_iterativa = soma_iterativa + tempo_AVL[j];
+    }
+    std::cout << "Tempo medio para preencher AVL (iterativa) com " << N << " nos = " << soma_iterativa << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================AVL com dica====================================
+    //Mesma rvore (malloc), mas cada insero comea do caminho da insero anterior (Comum/Dica.h), para comparar com insere_ArvAVL
+    std::cout<<"Inserindo elementos na AVL com dica e calculando o tempo..."<<std::endl;
+    std::cout<<std::endl;
+    double soma_dica = 0.0;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        avl = cria_ArvAVL(ALOCA_MALLOC);
+        struct Dica<struct NO> dica;
+        inicia_Dica(&dica, avl);
+        for(int i=0;i<N;i++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = insereDica_ArvAVL(avl,&dica,i,i);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            tempo_AVL[i] = t;
+        }
+        libera_ArvAVL(avl);
+    }
+    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na AVL com dica
+    {
+        soma_dica = soma_dica + tempo_AVL[j];
+    }
+    std::cout << "Tempo medio para preencher AVL com dica com " << N << " nos = " << soma_dica << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================AVL carga ordenada===============================
+    //As chaves 0..N-1 j esto ordenadas, ento a rvore pode ser montada de uma vez em O(N), sem rotaes
+    //Os ns saem de um nico trecho contguo da arena, na ordem em que a busca os visita
+    std::cout<<"Montando a AVL a partir do vetor ordenado e calculando o tempo..."<<std::endl;
+    std::cout<<std::endl;
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chave e informao iguais, como nas inseres
+    for(int i=0;i<N;i++)
+        chaves[i] = i;
+    double tempo_carga = 0.0;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        ArvAVL *arv = cria_ArvAVL(ALOCA_ARENA);
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = carregaOrdenado_ArvAVL(arv,chaves,chaves,N);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        tempo_carga = tmr.elapsed();
+        libera_ArvAVL(arv);
+    }
+    free(chaves);
+    std::cout << "Tempo para montar AVL (carga ordenada) com " << N << " nos = " << tempo_carga << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================AVL compacta===================================
+    std::cout<<"Inserindo elementos na AVL compacta e calculando o tempo..."<<std::endl;
+    std::cout<<std::endl;
+    double tempo_libera_compacta = 0.0, soma_compacta = 0.0;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        struct ArvAVLCompacta *compacta = cria_ArvAVLCompacta(); //O vetor de ns cresce dobrando de tamanho
+        for(int i=0;i<N;i++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = insere_ArvAVLCompacta(compacta,i,i);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            tempo_AVL[i] = t;
+        }
+        bytes_compacta = memoria_ArvAVLCompacta(compacta);
+        tmr.reset();
+        libera_ArvAVLCompacta(compacta);
+        tempo_libera_compacta = tmr.elapsed();
+    }
+    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na AVL compacta
+    {
+        soma_compacta = soma_compacta + tempo_AVL[j];
+    }
+    std::cout << "Tempo medio para preencher AVL compacta com " << N << " nos = " << soma_compacta << " segundos" << std::endl;
+    std::cout << "Tempo para liberar AVL compacta com " << N << " nos = " << tempo_libera_compacta << " segundos" << std::endl;
+    std::cout<<std::endl;
 
-
-
-    std::cout<<"Calculando o tempo medio de insercao..."<<std::endl;
+    //=============================AVL genrica=================================
+    //Mesmas inseres na verso genrica com <int, int> (malloc): o tempo deve ser o mesmo da AVL (malloc)
+    std::cout<<"Inserindo elementos na AVL generica <int, int> e calculando o tempo..."<<std::endl;
     std::cout<<std::endl;
-    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na AVL
+    double soma_generica = 0.0;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        struct ArvAVLGenerica<int, int> *generica = cria_ArvAVLGenerica<int, int>(ALOCA_MALLOC);
+        for(int i=0;i<N;i++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = insere_ArvAVLGenerica(generica,i,i);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            tempo_AVL[i] = t;
+        }
+        libera_ArvAVLGenerica(generica);
+    }
+    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na AVL genrica
     {
-        somaAVL = somaAVL + tempo_AVL[j];
+        soma_generica = soma_generica + tempo_AVL[j];
     }
-    std::cout << "Tempo medio para preencher AVL com " << N << " nos = " << somaAVL << " segundos" << std::endl; //Exibe na tela
+    std::cout << "Tempo medio para preencher AVL generica <int, int> com " << N << " nos = " << soma_generica << " segundos" << std::endl;
+    std::cout<<std::endl;
+
+    //Bytes por n de cada implementao
+    std::cout << "Bytes por no - Mapa: " << (double) bytes_MAPA / N << std::endl;
+    std::cout << "Bytes por no - AVL (malloc): " << (double) bytes_malloc / N << std::endl;
+    std::cout << "Bytes por no - AVL (arena): " << (double) bytes_arena / N << std::endl;
+    std::cout << "Bytes por no - AVL compacta: " << (double) bytes_compacta / N << std::endl;
     std::cout<<std::endl;
     free(tempo_AVL); //Libera o vetor
 
@@ -0,0 +1,167 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore AVL
+
+//Teste da AVL de intervalos (AVL/ArvoreAVLIntervalo.h)
+//So inseridos N intervalos com incio sorteado em [0, ESPACO) e comprimento sorteado, para trs densidades:
+//em mdia 1, 10 e 100 intervalos contendo cada ponto
+//Para cada densidade medimos a insero, as consultas por ponto e por intervalo [lo, lo + largura] e a remoo de metade dos intervalos
+//O std::multimap (incio -> fim) s consegue responder percorrendo todos os intervalos que comeam antes de hi,
+//que  o que fazemos hoje: O(N) por consulta. Ele tambm confere as respostas da rvore
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreAVL.h" //Implementao da rvore AVL (compartilhada pelos programas de teste)
+#include "ArvoreAVLIntervalo.h" //AVL de intervalos
+
+#define ESPACO 1000000000 //Pontos possveis: 0..ESPACO-1
+
+//Quantos intervalos do Mapa se sobrepem a [lo, hi]: percorre todos os que comeam at hi
+long long sobrepoeMapa(std::multimap<int, int> &Mapa, int lo, int hi){
+    long long encontrados = 0;
+    std::multimap<int, int>::iterator fim = Mapa.upper_bound(hi);
+    for(std::multimap<int, int>::iterator m = Mapa.begin(); m != fim; ++m)
+        if(m->second >= lo)
+            encontrados++;
+    return encontrados;
+}
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int N = 2000000; //Nmero de intervalos. Range 500.000-15.000.000
+    int num_rodadas = 100000; //Nmero de consultas de cada tipo na AVL
+    int num_rodadas_mapa = 20; //Nmero de consultas de cada tipo no Mapa (cada uma custa O(N)). Tambm conferem a AVL
+    int largura = 1000; //Largura das consultas por intervalo
+    int densidades[3] = {1, 10, 100}; //Mdia de intervalos que contm cada ponto
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
+    std::cout<<std::endl;
+
+    int *inicios = (int *)malloc(N * sizeof(int));
+    int *fins = (int *)malloc(N * sizeof(int));
+    int *consultas = (int *)malloc(num_rodadas * sizeof(int));
+    std::mt19937 gerador(42);
+    std::uniform_int_distribution<int> sorteio(0, ESPACO - 1);
+    for(int j=0;j<num_rodadas;j++)
+        consultas[j] = sorteio(gerador);
+
+    for(int d=0;d<3;d++){
+        //Comprimento mdio para que cada ponto fique, em mdia, dentro de "densidade" intervalos
+        long long medio = (long long) densidades[d] * ESPACO / N;
+        std::uniform_int_distribution<long long> comprimento(0, 2 * medio);
+        for(int i=0;i<N;i++){
+            inicios[i] = sorteio(gerador);
+            fins[i] = (int) std::min((long long) inicios[i] + comprimento(gerador), (long long) ESPACO - 1);
+        }
+        std::cout<<"Densidade "<<densidades[d]<<" (comprimento medio "<<medio<<")"<<std::endl;
+
+        //=============================Insero=======================================
+        ArvAVL* avl = cria_ArvAVL(modo_alocacao);
+        long long inseridos = 0;
+        tmr.reset();
+        for(int i=0;i<N;i++)
+            inseridos += insereIntervalo_ArvAVL(avl, inicios[i], fins[i]);
+        double avl_insere = tmr.elapsed();
+        std::multimap<int, int> Mapa;
+        tmr.reset();
+        for(int i=0;i<N;i++)
+            Mapa.insert(std::pair<int, int>(inicios[i], fins[i]));
+        double mapa_insere = tmr.elapsed();
+        if(inseridos != N) //Intervalos repetidos so muito raros; se aparecerem, o Mapa fica com uma cpia a mais
+            std::cout << "Intervalos repetidos: " << N - inseridos << std::endl;
+        std::cout << "Tempo de insercao: AVL = " << avl_insere << " s, Mapa = " << mapa_insere << " s" << std::endl;
+
+        //=============================Consultas======================================
+        long long total = 0;
+        tmr.reset();
+        for(int j=0;j<num_rodadas;j++)
+            total += contemPonto_ArvAVL(avl, consultas[j], [](int, int){});
+        double avl_ponto = tmr.elapsed() / num_rodadas;
+        long long total_intervalo = 0;
+        tmr.reset();
+        for(int j=0;j<num_rodadas;j++)
+            total_intervalo += sobrepoe_ArvAVL(avl, consultas[j], consultas[j] + largura, [](int, int){});
+        double avl_intervalo = tmr.elapsed() / num_rodadas;
+        int achou = 0, ini, fim;
+        tmr.reset();
+        for(int j=0;j<num_rodadas;j++)
+            achou += buscaSobreposicao_ArvAVL(avl, consultas[j], consultas[j], &ini, &fim);
+        double avl_algum = tmr.elapsed() / num_rodadas;
+        std::cout << "AVL - tempo medio: ponto = " << avl_ponto << " s (" << (double) total / num_rodadas << " respostas), intervalo = "
+                  << avl_intervalo << " s (" << (double) total_intervalo / num_rodadas << " respostas), algum = " << avl_algum
+                  << " s (" << 100.0 * achou / num_rodadas << "% com resposta)" << std::endl;
+
+        long long total_mapa = 0;
+        tmr.reset();
+        for(int j=0;j<num_rodadas_mapa;j++)
+            total_mapa += sobrepoeMapa(Mapa, consultas[j], consultas[j]);
+        double mapa_ponto = tmr.elapsed() / num_rodadas_mapa;
+        for(int j=0;j<num_rodadas_mapa;j++){ //Confere as respostas da AVL
+            long long contagem = contemPonto_ArvAVL(avl, consultas[j], [&](int inicio, int fim){
+                if(inicio > consultas[j] || fim < consultas[j]) erro = 1; //Intervalo errado
+            });
+            total_mapa -= contagem;
+            if((contagem > 0) != (buscaSobreposicao_ArvAVL(avl, consultas[j], consultas[j], NULL, NULL) == 1)) erro = 1;
+        }
+        if(total_mapa != 0 && inseridos == N) erro = 1;
+        total_mapa = 0;
+        tmr.reset();
+        for(int j=0;j<num_rodadas_mapa;j++)
+            total_mapa += sobrepoeMapa(Mapa, consultas[j], consultas[j] + largura);
+        double mapa_intervalo = tmr.elapsed() / num_rodadas_mapa;
+        for(int j=0;j<num_rodadas_mapa;j++)
+            total_mapa -= sobrepoe_ArvAVL(avl, consultas[j], consultas[j] + largura, [](int, int){});
+        if(total_mapa != 0 && inseridos == N) erro = 1;
+        std::cout << "Mapa - tempo medio: ponto = " << mapa_ponto << " s, intervalo = " << mapa_intervalo << " s" << std::endl;
+
+        //=============================Remoo========================================
+        long long removidos = 0;
+        tmr.reset();
+        for(int i=0;i<N;i+=2)
+            removidos += removeIntervalo_ArvAVL(avl, inicios[i], fins[i]);
+        double avl_remove = tmr.elapsed();
+        if(removidos != (N + 1) / 2 && inseridos == N) erro = 1;
+        for(int i=0;i<N;i+=2){ //Mesmos intervalos saem do Mapa
+            std::multimap<int, int>::iterator m = Mapa.lower_bound(inicios[i]);
+            while(m != Mapa.end() && m->first == inicios[i] && m->second != fins[i])
+                ++m;
+            if(m != Mapa.end() && m->first == inicios[i])
+                Mapa.erase(m);
+        }
+        for(int j=0;j<num_rodadas_mapa;j++) //Depois da remoo as respostas continuam certas
+            if(sobrepoeMapa(Mapa, consultas[j], consultas[j] + largura) != sobrepoe_ArvAVL(avl, consultas[j], consultas[j] + largura, [](int, int){}) && inseridos == N)
+                erro = 1;
+        std::cout << "Tempo de remocao de metade dos intervalos: AVL = " << avl_remove << " s" << std::endl;
+        std::cout<<std::endl;
+
+        libera_ArvAVL(avl);
+    }
+
+    free(inicios);
+    free(fins);
+    free(consultas);
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <algorithm>
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore AVL
+
+//Teste da AVL autenticada (AVL/ArvoreAVLMerkle.h)
+//A rvore recebe as chaves 0, 2, 4...2(N-1) em ordem aleatria. Depois medimos:
+//  o custo de cada atualizao (remover uma chave par e inserir uma mpar) pedindo o hash da raiz a cada "lote" atualizaes.
+//  Com lote 1 cada atualizao paga os hashes do seu caminho; com lotes maiores a parte de cima dos caminhos  recalculada uma vez por lote
+//  o custo de gerar e de conferir provas de que uma chave est na rvore
+//A AVL comum e o std::map fazem as mesmas atualizaes sem hash, para mostrar quanto custa a autenticao
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreAVL.h" //Implementao da rvore AVL (compartilhada pelos programas de teste)
+#include "ArvoreAVLMerkle.h" //AVL autenticada
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int N = 1000000; //Nmero de chaves. Range 500.000-15.000.000
+    int num_atualizacoes = 100000; //Nmero de atualizaes para cada tamanho de lote
+    int lotes[5] = {1, 10, 100, 1000, 10000}; //Atualizaes entre dois pedidos do hash da raiz
+    int num_provas = 20000; //Nmero de provas geradas e conferidas (cada prova tem uns 3 KB)
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    std::cout<<"N = "<<N<<" - Atualizacoes por lote = "<<num_atualizacoes<<std::endl;
+    std::cout<<std::endl;
+
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chaves 0, 2, 4...2(N-1) embaralhadas
+    for(int i=0;i<N;i++)
+        chaves[i] = 2 * i;
+    std::mt19937 gerador(42);
+    std::shuffle(chaves, chaves + N, gerador);
+
+    //=============================Construo=====================================
+    ArvMerkle* merkle = cria_ArvMerkle(modo_alocacao);
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        if(!insere_ArvMerkle(merkle, chaves[i], chaves[i] + 1)) erro = 1;
+    double merkle_insere = tmr.elapsed();
+    tmr.reset();
+    long long calculados = sela_ArvMerkle(merkle);
+    double merkle_sela = tmr.elapsed();
+    if(calculados != N) erro = 1; //Cada n  calculado uma vez s
+
+    ArvAVL* avl = cria_ArvAVL(modo_alocacao);
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        insere_ArvAVL(avl, chaves[i], chaves[i] + 1);
+    double avl_insere = tmr.elapsed();
+    std::map<int, int> Mapa;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        Mapa.insert(std::pair<int, int>(chaves[i], chaves[i] + 1));
+    double mapa_insere = tmr.elapsed();
+    std::cout << "Construcao: AVL autenticada = " << merkle_insere << " s + " << merkle_sela << " s para os " << calculados
+              << " hashes, AVL = " << avl_insere << " s, Mapa = " << mapa_insere << " s" << std::endl;
+    std::cout<<std::endl;
+
+    //=============================Atualizaes===================================
+    //A atualizao j do lote l remove a chave chaves[c] e insere chaves[c] + 1, com c diferente para cada uma
+    int c = 0;
+    unsigned char hash[TAM_HASH];
+    for(int l=0;l<5;l++){
+        int ini = c;
+        calculados = 0;
+        tmr.reset();
+        for(int j=0;j<num_atualizacoes;j++,c++){
+            if(!remove_ArvMerkle(merkle, chaves[c])) erro = 1;
+            if(!insere_ArvMerkle(merkle, chaves[c] + 1, chaves[c] + 2)) erro = 1;
+            if((j + 1) % lotes[l] == 0){ //Fim do lote: o hash da raiz  pedido
+                calculados += sela_ArvMerkle(merkle);
+                hashRaiz_ArvMerkle(merkle, hash);
+            }
+        }
+        double merkle_atualiza = tmr.elapsed() / num_atualizacoes;
+
+        tmr.reset();
+        for(int j=0,k=ini;j<num_atualizacoes;j++,k++){
+            remove_ArvAVL(avl, chaves[k]);
+            insere_ArvAVL(avl, chaves[k] + 1, chaves[k] + 2);
+        }
+        double avl_atualiza = tmr.elapsed() / num_atualizacoes;
+        tmr.reset();
+        for(int j=0,k=ini;j<num_atualizacoes;j++,k++){
+            Mapa.erase(chaves[k]);
+            Mapa.insert(std::pair<int, int>(chaves[k] + 1, chaves[k] + 2));
+        }
+        double mapa_atualiza = tmr.elapsed() / num_atualizacoes;
+        std::cout << "Lote de " << lotes[l] << ": tempo medio por atualizacao: AVL autenticada = " << merkle_atualiza << " s ("
+                  << (double) calculados / num_atualizacoes << " hashes), AVL = " << avl_atualiza << " s, Mapa = " << mapa_atualiza << " s" << std::endl;
+    }
+    std::cout<<std::endl;
+
+    //=============================Provas=========================================
+    //As chaves j atualizadas (mpares) e as que no mudaram (pares) tm informao chave + 1
+    int *consultas = (int *)malloc(num_provas * sizeof(int));
+    std::uniform_int_distribution<int> sorteio(0, N - 1);
+    for(int j=0;j<num_provas;j++){
+        int i = sorteio(gerador);
+        consultas[j] = (i < c) ? chaves[i] + 1 : chaves[i];
+    }
+    struct ProvaMerkle *provas = (struct ProvaMerkle *)malloc(num_provas * sizeof(struct ProvaMerkle));
+    hashRaiz_ArvMerkle(merkle, hash);
+    long long passos = 0;
+    tmr.reset();
+    for(int j=0;j<num_provas;j++)
+        if(prova_ArvMerkle(merkle, consultas[j], &provas[j]))
+            passos += provas[j].tam;
+        else
+            erro = 1;
+    double merkle_prova = tmr.elapsed() / num_provas;
+    int validas = 0;
+    tmr.reset();
+    for(int j=0;j<num_provas;j++)
+        validas += verificaProva_ArvMerkle(hash, consultas[j], consultas[j] + 1, &provas[j]);
+    double merkle_verifica = tmr.elapsed() / num_provas;
+    if(validas != num_provas) erro = 1;
+    for(int j=0;j<num_provas;j++) //Com outra informao a prova no pode valer
+        if(verificaProva_ArvMerkle(hash, consultas[j], consultas[j], &provas[j])) erro = 1;
+    std::cout << "Provas: tempo medio para gerar = " << merkle_prova << " s, para conferir = " << merkle_verifica << " s, "
+              << (double) passos / num_provas << " passos (" << sizeof(struct PassoProva) * passos / num_provas << " bytes) por prova" << std::endl;
+    std::cout<<std::endl;
+
+    libera_ArvMerkle(merkle);
+    libera_ArvAVL(avl);
+    free(provas);
+    free(consultas);
+    free(chaves);
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore AVL
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <random>
+#include <algorithm>
+
+//Teste de estresse com vrias threads e operaes misturadas: a AVL otimista (ArvoreAVLOtimista.h), em que as threads
+//s travam os ns que alteram, contra o dicionrio particionado em 64 AVLs (Comum/Particionado.h) e um Mapa com uma trava s
+//Cada estrutura comea com N chaves e recebe num_operacoes operaes (insero, busca ou remoo de chaves aleatrias
+//entre 0 e 2N-1), divididas entre 1, 2, 4... max_threads threads
+//Mede quantas operaes por segundo cada estrutura faz, somando todas as threads
+//No fim, confere se a quantidade de chaves de cada estrutura bate com as inseres e remoes que deram certo
+//Importante utilizar as flags -O3 e -pthread
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreAVL.h" //Implementao da rvore AVL (compartilhada pelos programas de teste)
+#include "ArvoreAVLOtimista.h" //AVL concorrente otimista
+#include "../Comum/Particionado.h" //Dicionrio particionado com uma trava por parte
+
+//Tipos de operao
+#define OP_INSERE 0
+#define OP_CONSULTA 1
+#define OP_REMOVE 2
+
+//Divide as operaes 0..M-1 entre num_threads threads e executa op(ini, fim) em cada uma
+//Retorna o tempo at a ltima thread terminar
+template <class F>
+double executa(int num_threads, int M, F op){
+    Timer tmr;
+    std::vector<std::thread> threads;
+    for(int t=0;t<num_threads;t++)
+        threads.push_back(std::thread(op, (int)((long long)M * t / num_threads), (int)((long long)M * (t + 1) / num_threads)));
+    for(size_t t=0;t<threads.size();t++)
+        threads[t].join();
+    return tmr.elapsed();
+}
+
+//Exemplo de uso
+int main(){
+    int N = 1000000; //Chaves iniciais. As operaes usam chaves de 0 a 2N-1, ento metade das buscas encontra a chave
+    int num_operacoes = 4000000; //Operaes em cada teste, divididas entre as threads
+    int pct_insere = 20, pct_remove = 20; //Porcentagem de inseres e remoes. O resto so buscas
+    int max_threads = 64; //Nmero mximo de threads. O teste  feito com 1, 2, 4... max_threads
+    int num_particoes = 64; //Nmero de partes do dicionrio particionado
+    int erro = 0; //Vira 1 se alguma estrutura terminar com a quantidade errada de chaves
+    std::cout<<"N = "<<N<<" - Operacoes = "<<num_operacoes<<" ("<<pct_insere<<"% insercao, "<<100-pct_insere-pct_remove<<"% busca, "<<pct_remove<<"% remocao)"<<" - Nucleos = "<<std::thread::hardware_concurrency()<<std::endl;
+    std::cout<<std::endl;
+
+    //Chaves iniciais: N chaves distintas sorteadas entre 0 e 2N-1
+    int *iniciais = (int *)malloc(2 * N * sizeof(int));
+    for(int i=0;i<2*N;i++)
+        iniciais[i] = i;
+    std::mt19937 gerador(42);
+    std::shuffle(iniciais, iniciais + 2 * N, gerador);
+
+    //Operaes sorteadas antes, para que o sorteio no entre no tempo
+    int *chaves = (int *)malloc(num_operacoes * sizeof(int));
+    char *tipos = (char *)malloc(num_operacoes * sizeof(char));
+    for(int i=0;i<num_operacoes;i++){
+        chaves[i] = gerador() % (2 * N);
+        int p = gerador() % 100;
+        tipos[i] = p < pct_insere ? OP_INSERE : (p < pct_insere + pct_remove ? OP_REMOVE : OP_CONSULTA);
+    }
+
+    for(int T=1;T<=max_threads;T*=2)
+    {
+        std::cout<<"Threads = "<<T<<std::endl;
+        std::atomic<long long> saldo(0); //Inseres menos remoes que deram certo
+        //=============================Mapa============================================
+        std::map<int, int> Mapa;
+        std::mutex trava_mapa;
+        for(int i=0;i<N;i++)
+            Mapa.insert(std::pair<int, int>(iniciais[i], iniciais[i]));
+        saldo = 0;
+        double tempo = executa(T, num_operacoes, [&](int ini, int fim){
+            long long s = 0;
+            for(int i=ini;i<fim;i++){
+                std::lock_guard<std::mutex> trava(trava_mapa);
+                if(tipos[i] == OP_INSERE)
+                    s += Mapa.insert(std::pair<int, int>(chaves[i], chaves[i])).second;
+                else if(tipos[i] == OP_REMOVE)
+                    s -= Mapa.erase(chaves[i]);
+                else
+                    Mapa.find(chaves[i]);
+            }
+            saldo += s;
+        });
+        if((long long)Mapa.size() != N + saldo) erro = 1;
+        std::cout << "Mapa (1 trava) - operacoes por segundo = " << num_operacoes/tempo << std::endl;
+
+        //=============================AVL particionada================================
+        struct DicParticionado<MotorAVL> *dic = cria_DicParticionado<MotorAVL>(num_particoes, 0, 2 * N - 1);
+        for(int i=0;i<N;i++)
+            insere_DicParticionado(dic, iniciais[i], iniciais[i]);
+        saldo = 0;
+        tempo = executa(T, num_operacoes, [&](int ini, int fim){
+            long long s = 0;
+            for(int i=ini;i<fim;i++){
+                if(tipos[i] == OP_INSERE)
+                    s += insere_DicParticionado(dic, chaves[i], chaves[i]);
+                else if(tipos[i] == OP_REMOVE)
+                    s -= remove_DicParticionado(dic, chaves[i]);
+                else
+                    consulta_DicParticionado(dic, chaves[i]);
+            }
+            saldo += s;
+        });
+        long long total = 0;
+        for(int i=0;i<2*N;i++)
+            total += consulta_DicParticionado(dic, i);
+        if(total != N + saldo) erro = 1;
+        libera_DicParticionado(dic);
+        std::cout << "AVL (" << num_particoes << " partes) - operacoes por segundo = " << num_operacoes/tempo << std::endl;
+
+        //=============================AVL otimista====================================
+        ArvAVLOtimista *arv = cria_ArvAVLOtimista();
+        int id = registraThread_ArvAVLOtimista(arv);
+        for(int i=0;i<N;i++)
+            insere_ArvAVLOtimista(arv, id, iniciais[i], iniciais[i]);
+        saldo = 0;
+        tempo = executa(T, num_operacoes, [&](int ini, int fim){
+            int id = registraThread_ArvAVLOtimista(arv); //Cada thread tem o seu nmero
+            long long s = 0;
+            for(int i=ini;i<fim;i++){
+                if(tipos[i] == OP_INSERE)
+                    s += insere_ArvAVLOtimista(arv, id, chaves[i], chaves[i]);
+                else if(tipos[i] == OP_REMOVE)
+                    s -= remove_ArvAVLOtimista(arv, id, chaves[i]);
+                else
+                    consulta_ArvAVLOtimista(arv, id, chaves[i]);
+            }
+            saldo += s;
+        });
+        if(total_ArvAVLOtimista(arv) != N + saldo) erro = 1;
+        libera_ArvAVLOtimista(arv);
+        std::cout << "AVL otimista - operacoes por segundo = " << num_operacoes/tempo << std::endl;
+        std::cout<<std::endl;
+    }
+    free(iniciais);
+    free(chaves);
+    free(tipos);
+
+    if(erro)
+        std::cout << "Alguma estrutura terminou com a quantidade errada de chaves. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
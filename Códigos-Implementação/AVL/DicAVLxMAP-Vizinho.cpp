@@ -0,0 +1,166 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <algorithm>
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore AVL
+
+//Teste das consultas pela chave mais prxima da AVL (Comum/ConsultaVizinho.h)
+//A rvore e o std::map recebem as chaves 0, 2, 4...2(N-1) em ordem aleatria, e as consultas so valores sorteados
+//entre 0 e 2N, ento metade delas no est na rvore e a resposta  a chave vizinha
+//Comparamos limiteInferior (lower_bound), piso (floor) e antecessor (predecessor) com o std::map,
+//que faz piso e antecessor com upper_bound/lower_bound seguido de --
+//Antes das consultas as chaves mpares entram (com info -1) e saem de novo. Muitas delas ficam em ns com dois filhos, que a
+//remoo preenche com o sucessor (uma chave par): se a informao do sucessor no for junto, as consultas a encontram errada
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreAVL.h" //Implementao da rvore AVL (compartilhada pelos programas de teste)
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int N = 1000000; //Nmero de chaves. Range 500.000-15.000.000
+    int num_rodadas = 1000000; //Nmero de consultas de cada tipo
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
+    std::cout<<std::endl;
+
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chaves 0, 2, 4...2(N-1) embaralhadas
+    for(int i=0;i<N;i++)
+        chaves[i] = 2 * i;
+    std::mt19937 gerador(42);
+    std::shuffle(chaves, chaves + N, gerador);
+
+    ArvAVL* avl = cria_ArvAVL(modo_alocacao);
+    std::map<int, int> Mapa;
+    for(int i=0;i<N;i++){
+        insere_ArvAVL(avl, chaves[i], chaves[i] + 1); //info = chave + 1, para conferir que a informao veio junto
+        Mapa.insert(std::pair<int, int>(chaves[i], chaves[i] + 1));
+    }
+    for(int i=0;i<N;i++){ //Chaves mpares, na mesma ordem aleatria
+        insere_ArvAVL(avl, chaves[i] + 1, -1);
+        Mapa.insert(std::pair<int, int>(chaves[i] + 1, -1));
+    }
+    for(int i=0;i<N;i++){
+        if(remove_ArvAVL(avl, chaves[i] + 1) != 1) erro = 1;
+        Mapa.erase(chaves[i] + 1);
+    }
+    int *consultas = (int *)malloc(num_rodadas * sizeof(int));
+    std::uniform_int_distribution<int> sorteio(0, 2 * N);
+    for(int j=0;j<num_rodadas;j++)
+        consultas[j] = sorteio(gerador);
+
+    //Respostas esperadas: soma das chaves encontradas (quem no tem resposta no soma)
+    long long esperado_inferior = 0, esperado_piso = 0, esperado_antecessor = 0;
+    for(int j=0;j<num_rodadas;j++){
+        int v = consultas[j];
+        int inferior = (v % 2 == 0) ? v : v + 1; //Menor chave par >= v
+        if(inferior <= 2 * (N - 1))
+            esperado_inferior += inferior;
+        int piso = std::min((v % 2 == 0) ? v : v - 1, 2 * (N - 1)); //Maior chave par <= v
+        esperado_piso += piso;
+        int antecessor = std::min((v % 2 == 0) ? v - 2 : v - 1, 2 * (N - 1)); //Maior chave par < v
+        if(antecessor >= 0)
+            esperado_antecessor += antecessor;
+    }
+
+    //=============================AVL=============================================
+    int chave, info;
+    long long soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++)
+        if(limiteInferior_ArvAVL(avl, consultas[j], &chave, &info)){
+            soma += chave;
+            if(info != chave + 1) erro = 1;
+        }
+    double avl_inferior = tmr.elapsed() / num_rodadas;
+    if(soma != esperado_inferior) erro = 1;
+
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++)
+        if(piso_ArvAVL(avl, consultas[j], &chave, &info)){
+            soma += chave;
+            if(info != chave + 1) erro = 1;
+        }
+    double avl_piso = tmr.elapsed() / num_rodadas;
+    if(soma != esperado_piso) erro = 1;
+
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++)
+        if(antecessor_ArvAVL(avl, consultas[j], &chave, &info)){
+            soma += chave;
+            if(info != chave + 1) erro = 1;
+        }
+    double avl_antecessor = tmr.elapsed() / num_rodadas;
+    if(soma != esperado_antecessor) erro = 1;
+    std::cout << "AVL - tempo medio: limiteInferior = " << avl_inferior << " s, piso = " << avl_piso << " s, antecessor = " << avl_antecessor << " s" << std::endl;
+
+    //=============================Mapa============================================
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++){
+        std::map<int, int>::iterator m = Mapa.lower_bound(consultas[j]);
+        if(m != Mapa.end()){
+            soma += m->first;
+            if(m->second != m->first + 1) erro = 1;
+        }
+    }
+    double mapa_inferior = tmr.elapsed() / num_rodadas;
+    if(soma != esperado_inferior) erro = 1;
+
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++){
+        std::map<int, int>::iterator m = Mapa.upper_bound(consultas[j]);
+        if(m != Mapa.begin()){
+            --m;
+            soma += m->first;
+            if(m->second != m->first + 1) erro = 1;
+        }
+    }
+    double mapa_piso = tmr.elapsed() / num_rodadas;
+    if(soma != esperado_piso) erro = 1;
+
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++){
+        std::map<int, int>::iterator m = Mapa.lower_bound(consultas[j]);
+        if(m != Mapa.begin()){
+            --m;
+            soma += m->first;
+            if(m->second != m->first + 1) erro = 1;
+        }
+    }
+    double mapa_antecessor = tmr.elapsed() / num_rodadas;
+    if(soma != esperado_antecessor) erro = 1;
+    std::cout << "Mapa - tempo medio: limiteInferior = " << mapa_inferior << " s, piso = " << mapa_piso << " s, antecessor = " << mapa_antecessor << " s" << std::endl;
+    std::cout<<std::endl;
+
+    libera_ArvAVL(avl);
+    free(consultas);
+    free(chaves);
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
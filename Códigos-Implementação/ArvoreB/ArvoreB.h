@@ -0,0 +1,441 @@
+#ifndef ARVOREB_H
+#define ARVOREB_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#ifdef __SSE2__
+#include <emmintrin.h> //Comparaes de 4 inteiros de uma vez (SSE2, presente em todo processador x86-64)
+#endif
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+
+//rvore B (Bayer e McCreight, 1972; implementao como em Cormen et al., "Algoritmos: Teoria e Prtica", captulo 18)
+//A AVL, a LLRB e o std::map so rvores binrias: cada nvel da busca  um n diferente e, em uma rvore grande,
+//quase todo nvel  uma falta de cache (cerca de 24 para 15.000.000 de elementos)
+//Aqui cada n guarda at 15 chaves ordenadas e as chaves ocupam exatamente uma linha de cache (64 bytes),
+//ento a rvore tem uns 7 nveis para 15.000.000 de elementos e cada nvel custa uma falta de cache s
+//Dentro do n a posio da chave  encontrada comparando o valor com as 16 posies de uma vez (SSE2)
+//Propriedades da rvore B de grau mnimo t (ORDEM_B):
+//- Todo n, menos a raiz, tem entre t-1 e 2t-1 chaves
+//- Um n interno com n chaves tem n+1 filhos: as chaves do filho i esto entre a chave i-1 e a chave i
+//- Todas as folhas esto na mesma altura
+//Insero e remoo so feitas em uma nica descida, sem recurso:
+//- na insero, todo n cheio encontrado no caminho  dividido antes de descer nele
+//- na remoo, todo n com o mnimo de chaves encontrado no caminho recebe uma chave de um irmo (ou  juntado a ele) antes de descer nele
+
+#define ORDEM_B 8 //Grau mnimo t
+#define MAX_CHAVES_B (2 * ORDEM_B - 1) //15 chaves
+#define MIN_CHAVES_B (ORDEM_B - 1) //7 chaves
+
+typedef struct NO* ArvB;
+
+//Definio do n do dicionrio
+//As chaves vm primeiro e ocupam uma linha de cache inteira:  s isso que a busca l em cada nvel
+struct alignas(64) NO{
+    int chaves[MAX_CHAVES_B + 1]; //Chaves ordenadas. A ltima posio nunca  usada, s completa os 64 bytes
+    int infos[MAX_CHAVES_B + 1]; //Informao associada a cada chave
+    struct NO *filhos[MAX_CHAVES_B + 1]; //Filhos (no usados nas folhas)
+    int n; //Quantidade de chaves no n
+    int folha; //1 se o n  folha
+};
+
+//Cabealho da rvore: ponteiro para a raiz seguido do alocador dos ns
+//O ArvB* devolvido por cria_ArvB aponta para o campo raiz, como nas outras rvores
+struct CabecaArvB{
+    struct NO* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns dessa rvore
+};
+
+//Retorna o alocador da rvore a partir do ponteiro para a raiz
+Alocador<struct NO>* alocador_ArvB(ArvB* raiz){
+    return &((struct CabecaArvB*) raiz)->aloc;
+}
+
+//Cria a rvore vazia
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvB* cria_ArvB(int modo = ALOCA_MALLOC){
+    struct CabecaArvB* cab = (struct CabecaArvB*) malloc(sizeof(struct CabecaArvB));
+    if(cab == NULL)//Erro na alocao de memria
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    return &cab->raiz;
+}
+
+//Liberar um n e todos os seus filhos
+void libera_NO(struct NO* no){
+    if(no == NULL)
+        return;
+    if(!no->folha)
+        for(int i = 0; i <= no->n; i++)
+            libera_NO(no->filhos[i]);
+    free(no);
+}
+
+//Liberar toda a rvore. Na arena no  preciso visitar os ns: os blocos so liberados de uma vez
+void libera_ArvB(ArvB* raiz){
+    if(raiz == NULL)
+        return;
+    Alocador<struct NO>* aloc = alocador_ArvB(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);//libera todos os blocos
+    else
+        libera_NO(*raiz);//libera cada n
+    free(raiz);//libera a raiz (o cabealho comea no campo raiz)
+}
+
+//Conta os ns da rvore (para calcular a memria usada nos testes)
+int totalNO_ArvB(struct NO* no){
+    if(no == NULL)
+        return 0;
+    int total = 1;
+    if(!no->folha)
+        for(int i = 0; i <= no->n; i++)
+            total += totalNO_ArvB(no->filhos[i]);
+    return total;
+}
+
+//Cria um n vazio. As chaves no usadas recebem INT_MAX para que a comparao em bloco nunca leia lixo
+struct NO* novo_NO(Alocador<struct NO>* aloc, int folha){
+    struct NO* no = aloca_NO(aloc);
+    if(no == NULL)
+        return NULL; //Alocao de memria falhou
+    for(int i = 0; i <= MAX_CHAVES_B; i++)
+        no->chaves[i] = INT_MAX;
+    no->n = 0;
+    no->folha = folha;
+    return no;
+}
+
+//Posio da primeira chave do n que  >= valor (ou n se todas so menores)
+//Como as chaves esto ordenadas,  o mesmo que contar quantas chaves so menores que valor
+//Com SSE2 so 4 comparaes de 4 chaves, sem desvio condicional; as posies >= n so descartadas pela mscara
+int posicao_NO(struct NO* no, int valor){
+#ifdef __SSE2__
+    __m128i v = _mm_set1_epi32(valor);
+    const __m128i* c = (const __m128i*) no->chaves;
+    int m0 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_load_si128(c), v)));
+    int m1 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_load_si128(c + 1), v)));
+    int m2 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_load_si128(c + 2), v)));
+    int m3 = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_load_si128(c + 3), v)));
+    unsigned int m = (unsigned int)(m0 | (m1 << 4) | (m2 << 8) | (m3 << 12));
+    return __builtin_popcount(m & ((1u << no->n) - 1));
+#else
+    int i = 0;
+    while(i < no->n && no->chaves[i] < valor)
+        i++;
+    return i;
+#endif
+}
+
+//A consulta desce um n por nvel, procurando a posio dentro de cada n
+int consulta_ArvB(ArvB *raiz, int valor){
+    if(raiz == NULL)
+        return 0;//No encontrou
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        int i = posicao_NO(atual, valor);
+        if(i < atual->n && atual->chaves[i] == valor)
+            return 1; //Encontrou
+        if(atual->folha)
+            return 0; //No encontrou
+        atual = atual->filhos[i]; //Filho com as chaves entre chaves[i-1] e chaves[i]
+    }
+    return 0; //No encontrou
+}
+
+//Troca a informao guardada na chave valor, sem mexer na forma da rvore. Retorna 1 ou 0 (chave no est na rvore)
+int atualiza_ArvB(ArvB *raiz, int valor, int info){
+    if(raiz == NULL)
+        return 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        int i = posicao_NO(atual, valor);
+        if(i < atual->n && atual->chaves[i] == valor){
+            atual->infos[i] = info;
+            return 1;
+        }
+        if(atual->folha)
+            return 0;
+        atual = atual->filhos[i];
+    }
+    return 0;
+}
+
+//Varredura do intervalo [lo, hi] a partir do n: o filho i tem as chaves entre chaves[i-1] e chaves[i], ento comeamos na
+//primeira chave >= lo (os filhos antes dela s tm chaves menores) e paramos na primeira chave > hi
+template <class F>
+long long varreIntervalo_NO(struct NO* no, int lo, int hi, F &funcao){
+    long long visitados = 0;
+    for(int i = posicao_NO(no, lo); i <= no->n; i++){
+        if(!no->folha)
+            visitados += varreIntervalo_NO(no->filhos[i], lo, hi, funcao);
+        if(i == no->n || no->chaves[i] > hi)
+            break;
+        funcao(no->chaves[i], no->infos[i]);
+        visitados++;
+    }
+    return visitados;
+}
+
+//Varredura do intervalo [lo, hi]: chama funcao(chave, info) em ordem crescente. Retorna quantas chaves foram visitadas
+//Mesma interface de varre_ArvAVL; a rvore tem altura de uns 7 nveis, ento a recurso no pesa
+template <class F>
+long long varre_ArvB(ArvB *raiz, int lo, int hi, F funcao){
+    if(raiz == NULL || *raiz == NULL || lo > hi)
+        return 0;
+    return varreIntervalo_NO(*raiz, lo, hi, funcao);
+}
+
+//==================Funes auxiliares para mover chaves e filhos==========================
+
+//Abre espao na posio i, deslocando as chaves i..n-1 (e os filhos i+1..n) uma posio para a direita
+void abreEspaco_NO(struct NO* no, int i){
+    memmove(&no->chaves[i + 1], &no->chaves[i], (no->n - i) * sizeof(int));
+    memmove(&no->infos[i + 1], &no->infos[i], (no->n - i) * sizeof(int));
+    if(!no->folha)
+        memmove(&no->filhos[i + 2], &no->filhos[i + 1], (no->n - i) * sizeof(struct NO*));
+}
+
+//Fecha o espao da chave i (e do filho i+1), deslocando o resto uma posio para a esquerda
+void fechaEspaco_NO(struct NO* no, int i){
+    memmove(&no->chaves[i], &no->chaves[i + 1], (no->n - i - 1) * sizeof(int));
+    memmove(&no->infos[i], &no->infos[i + 1], (no->n - i - 1) * sizeof(int));
+    if(!no->folha)
+        memmove(&no->filhos[i + 1], &no->filhos[i + 2], (no->n - i - 1) * sizeof(struct NO*));
+    no->chaves[no->n - 1] = INT_MAX;
+    no->n--;
+}
+
+//Divide o filho i de pai, que est cheio (2t-1 chaves), em dois ns de t-1 chaves
+//A chave do meio sobe para pai, na posio i. pai no pode estar cheio
+int divideFilho_NO(struct NO* pai, int i, Alocador<struct NO>* aloc){
+    struct NO* y = pai->filhos[i];
+    struct NO* z = novo_NO(aloc, y->folha); //Fica com a metade da direita
+    if(z == NULL)
+        return 0; //Alocao de memria falhou
+    memcpy(z->chaves, &y->chaves[ORDEM_B], MIN_CHAVES_B * sizeof(int));
+    memcpy(z->infos, &y->infos[ORDEM_B], MIN_CHAVES_B * sizeof(int));
+    if(!y->folha)
+        memcpy(z->filhos, &y->filhos[ORDEM_B], ORDEM_B * sizeof(struct NO*));
+    z->n = MIN_CHAVES_B;
+
+    abreEspaco_NO(pai, i); //Sobe a chave do meio
+    pai->chaves[i] = y->chaves[MIN_CHAVES_B];
+    pai->infos[i] = y->infos[MIN_CHAVES_B];
+    pai->filhos[i + 1] = z;
+    pai->n++;
+
+    for(int j = MIN_CHAVES_B; j < MAX_CHAVES_B; j++)
+        y->chaves[j] = INT_MAX;
+    y->n = MIN_CHAVES_B;
+    return 1;
+}
+
+//Junta o filho i de pai, a chave i de pai e o filho i+1 em um s n (o filho i). O filho i+1  devolvido ao alocador
+//Os dois filhos tm t-1 chaves, ento o resultado tem 2t-1
+void juntaFilhos_NO(struct NO* pai, int i, Alocador<struct NO>* aloc){
+    struct NO* y = pai->filhos[i];
+    struct NO* z = pai->filhos[i + 1];
+    y->chaves[y->n] = pai->chaves[i];
+    y->infos[y->n] = pai->infos[i];
+    memcpy(&y->chaves[y->n + 1], z->chaves, z->n * sizeof(int));
+    memcpy(&y->infos[y->n + 1], z->infos, z->n * sizeof(int));
+    if(!y->folha)
+        memcpy(&y->filhos[y->n + 1], z->filhos, (z->n + 1) * sizeof(struct NO*));
+    y->n += z->n + 1;
+    fechaEspaco_NO(pai, i); //Remove a chave i e o ponteiro para z
+    desaloca_NO(aloc, z);
+}
+
+//O filho i de pai tem t-1 chaves e o irmo da esquerda tem pelo menos t: passa uma chave da esquerda pelo pai
+void emprestaEsquerda_NO(struct NO* pai, int i){
+    struct NO* c = pai->filhos[i];
+    struct NO* e = pai->filhos[i - 1];
+    memmove(&c->chaves[1], c->chaves, c->n * sizeof(int));
+    memmove(&c->infos[1], c->infos, c->n * sizeof(int));
+    if(!c->folha)
+        memmove(&c->filhos[1], c->filhos, (c->n + 1) * sizeof(struct NO*));
+    c->chaves[0] = pai->chaves[i - 1];
+    c->infos[0] = pai->infos[i - 1];
+    if(!c->folha)
+        c->filhos[0] = e->filhos[e->n];
+    c->n++;
+    pai->chaves[i - 1] = e->chaves[e->n - 1];
+    pai->infos[i - 1] = e->infos[e->n - 1];
+    e->chaves[e->n - 1] = INT_MAX;
+    e->n--;
+}
+
+//O filho i de pai tem t-1 chaves e o irmo da direita tem pelo menos t: passa uma chave da direita pelo pai
+void emprestaDireita_NO(struct NO* pai, int i){
+    struct NO* c = pai->filhos[i];
+    struct NO* d = pai->filhos[i + 1];
+    c->chaves[c->n] = pai->chaves[i];
+    c->infos[c->n] = pai->infos[i];
+    if(!c->folha)
+        c->filhos[c->n + 1] = d->filhos[0];
+    c->n++;
+    pai->chaves[i] = d->chaves[0];
+    pai->infos[i] = d->infos[0];
+    if(!d->folha)
+        memmove(d->filhos, &d->filhos[1], d->n * sizeof(struct NO*));
+    memmove(d->chaves, &d->chaves[1], (d->n - 1) * sizeof(int));
+    memmove(d->infos, &d->infos[1], (d->n - 1) * sizeof(int));
+    d->chaves[d->n - 1] = INT_MAX;
+    d->n--;
+}
+
+//==================Insero==========================
+//Desce da raiz at a folha dividindo todo n cheio antes de entrar nele. Assim, ao chegar na folha, ela tem espao
+//e a diviso de um filho sempre encontra espao no pai. A rvore s cresce em altura quando a raiz est cheia
+int insere_ArvB(ArvB* raiz, int chave, int valor){
+    if(raiz == NULL)
+        return 0;
+    Alocador<struct NO>* aloc = alocador_ArvB(raiz);
+    if(*raiz == NULL){ //rvore vazia: a raiz  uma folha com uma chave
+        struct NO* r = novo_NO(aloc, 1);
+        if(r == NULL)
+            return 0; //Alocao de memria falhou
+        r->chaves[0] = chave;
+        r->infos[0] = valor;
+        r->n = 1;
+        *raiz = r;
+        return 1;
+    }
+    if((*raiz)->n == MAX_CHAVES_B){ //Raiz cheia: nova raiz com a antiga como nico filho, e divide
+        struct NO* s = novo_NO(aloc, 0);
+        if(s == NULL)
+            return 0;
+        s->filhos[0] = *raiz;
+        if(!divideFilho_NO(s, 0, aloc)){
+            desaloca_NO(aloc, s);
+            return 0;
+        }
+        *raiz = s;
+    }
+    struct NO* x = *raiz;
+    while(1){
+        int i = posicao_NO(x, chave);
+        if(i < x->n && x->chaves[i] == chave)
+            return 0; //Valor j encontra-se na rvore e no ser inserido
+        if(x->folha){ //A folha tem espao: s desloca as chaves maiores
+            abreEspaco_NO(x, i);
+            x->chaves[i] = chave;
+            x->infos[i] = valor;
+            x->n++;
+            return 1; //Insero ocorreu corretamente
+        }
+        if(x->filhos[i]->n == MAX_CHAVES_B){ //Filho cheio: divide antes de descer
+            if(!divideFilho_NO(x, i, aloc))
+                return 0;
+            if(chave == x->chaves[i])
+                return 0; //A chave que subiu  a que queramos inserir
+            if(chave > x->chaves[i])
+                i++; //Desce na metade da direita
+        }
+        x = x->filhos[i];
+    }
+}
+
+//==================Remoo==========================
+//Desce da raiz garantindo que todo n em que entramos (menos a raiz) tenha pelo menos t chaves,
+//emprestando de um irmo ou juntando com ele. Assim, tirar uma chave nunca deixa um n abaixo do mnimo
+//Se a chave est em um n interno, ela  trocada pelo antecessor (ou sucessor) e a remoo continua na subrvore
+int remove_ArvB(ArvB *raiz, int valor){
+    if(raiz == NULL || *raiz == NULL)
+        return 0;
+    Alocador<struct NO>* aloc = alocador_ArvB(raiz);
+    struct NO* x = *raiz;
+    int res = 0;
+    while(1){
+        int i = posicao_NO(x, valor);
+        if(i < x->n && x->chaves[i] == valor){ //A chave est nesse n
+            if(x->folha){
+                fechaEspaco_NO(x, i);
+                res = 1;
+                break;
+            }
+            struct NO* y = x->filhos[i];
+            struct NO* z = x->filhos[i + 1];
+            if(y->n >= ORDEM_B){ //Troca pelo antecessor (maior chave da subrvore esquerda) e remove o antecessor
+                struct NO* p = y;
+                while(!p->folha)
+                    p = p->filhos[p->n];
+                x->chaves[i] = p->chaves[p->n - 1];
+                x->infos[i] = p->infos[p->n - 1];
+                valor = x->chaves[i];
+                x = y;
+            }else if(z->n >= ORDEM_B){ //Troca pelo sucessor (menor chave da subrvore direita) e remove o sucessor
+                struct NO* p = z;
+                while(!p->folha)
+                    p = p->filhos[0];
+                x->chaves[i] = p->chaves[0];
+                x->infos[i] = p->infos[0];
+                valor = x->chaves[i];
+                x = z;
+            }else{ //Os dois filhos tm t-1 chaves: junta tudo e continua no n juntado
+                juntaFilhos_NO(x, i, aloc);
+                x = y;
+            }
+            continue;
+        }
+        if(x->folha)
+            break; //No encontrou
+        if(x->filhos[i]->n == MIN_CHAVES_B){ //Filho no mnimo: completa antes de descer
+            if(i > 0 && x->filhos[i - 1]->n >= ORDEM_B)
+                emprestaEsquerda_NO(x, i);
+            else if(i < x->n && x->filhos[i + 1]->n >= ORDEM_B)
+                emprestaDireita_NO(x, i);
+            else if(i < x->n)
+                juntaFilhos_NO(x, i, aloc);
+            else{
+                juntaFilhos_NO(x, i - 1, aloc);
+                i--;
+            }
+        }
+        x = x->filhos[i];
+    }
+    //Uma juno na raiz pode deix-la sem chaves: a rvore diminui de altura
+    if((*raiz)->n == 0){
+        struct NO* antiga = *raiz;
+        *raiz = antiga->folha ? NULL : antiga->filhos[0];
+        desaloca_NO(aloc, antiga);
+    }
+    return res;
+}
+
+//Imprime as chaves em ordem, para testes
+void emOrdem_NO(struct NO* no){
+    if(no == NULL)
+        return;
+    for(int i = 0; i < no->n; i++){
+        if(!no->folha)
+            emOrdem_NO(no->filhos[i]);
+        printf("%d\n", no->chaves[i]);
+    }
+    if(!no->folha)
+        emOrdem_NO(no->filhos[no->n]);
+}
+
+void emOrdem_ArvB(ArvB *raiz){
+    if(raiz == NULL)
+        return;
+    emOrdem_NO(*raiz);
+}
+
+//Operaes da rvore B reunidas em uma struct, para as estruturas que recebem a rvore como parmetro de template (Comum/Particionado.h)
+struct MotorB{
+    typedef ArvB Arvore;
+    static ArvB* cria(int modo){ return cria_ArvB(modo); }
+    static void libera(ArvB *raiz){ libera_ArvB(raiz); }
+    static int insere(ArvB *raiz, int chave, int valor){ return insere_ArvB(raiz, chave, valor); }
+    static int consulta(ArvB *raiz, int valor){ return consulta_ArvB(raiz, valor); }
+    static int remove(ArvB *raiz, int valor){ return remove_ArvB(raiz, valor); }
+    static int atualiza(ArvB *raiz, int chave, int valor){ return atualiza_ArvB(raiz, chave, valor); }
+    template <class F>
+    static long long varre(ArvB *raiz, int lo, int hi, F funcao){ return varre_ArvB(raiz, lo, hi, funcao); }
+};
+
+#endif
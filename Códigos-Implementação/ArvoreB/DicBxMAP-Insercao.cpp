@@ -0,0 +1,130 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore B (o std::map  uma rvore binria)
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreB.h" //Implementao da rvore B com ns do tamanho da linha de cache (compartilhada pelos programas de teste)
+#include "../Comum/Memoria.h" //Conta os bytes usados pelo Mapa
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    double t = tmr.elapsed(); //Tempo de execuo do trecho de cdigo em segundos (s)
+    int N = 2500000; //Nmero de ns da rvore/Mapa. Range 1.000-20.000.000
+    int num_rodadas = 1; //Nmero de rodadas para pegar a mdia de tempos e evitar distores
+    double somaMAPA = 0.0; //Tempo do Mapa. O da rvore  calculado para cada modo de alocao
+    double tempo_libera_MAPA = 0.0; //Tempo para liberar o Mapa
+    size_t bytes_MAPA = 0, bytes_malloc = 0, bytes_arena = 0; //Memria usada pelos ns de cada implementao
+    double *tempo_B, *tempo_MAPA;
+    tempo_B = (double *)malloc(N * sizeof(double)); //Vetores para armazenar os tempos de insero de cada valor
+    tempo_MAPA = (double *)malloc(N * sizeof(double));
+    std::cout<<"N = "<<N<<std::endl;
+    std::cout<<std::endl;
+    int res; //Resposta se a insero ocorreu corretamente (1) ou no (0)
+    int falhas = 0; //Inseres que no deram certo. Se houver alguma, os tempos no valem
+
+    //=============================Mapa============================================
+    //Cria um Mapa adicionando os elementos na seguncia: 0, 2, 3, 4...N-1
+    std::cout<<"Inserindo elementos no Mapa e calculando o tempo..."<<std::endl;
+    std::cout<<std::endl;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        std::map<int, int> Mapa; //Para comparar com a implementao de rvore B. Redefino a cada rodada
+        for(int i=0;i<N;i++){
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            Mapa.insert(std::pair<int, int>(i, i));
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            tempo_MAPA[i] = t;
+        }
+        tmr.reset();
+        Mapa.clear(); //Tempo para liberar o Mapa, para comparar com a liberao das rvores
+        tempo_libera_MAPA = tmr.elapsed();
+    }
+    { //Memria ocupada pelo Mapa cheio: preenchido de novo fora da medida, com o alocador que conta os bytes
+        std::map<int, int, std::less<int>, ContaAlocador<std::pair<const int, int> > > MapaConta;
+        for(int i=0;i<N;i++)
+            MapaConta.insert(std::pair<int, int>(i, i));
+        bytes_MAPA = bytes_ContaAlocador;
+    }
+    std::cout<<"Calculando o tempo medio de insercao..."<<std::endl;
+    std::cout<<std::endl;
+    for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores no Mapa
+    {
+        somaMAPA = somaMAPA + tempo_MAPA[j];
+    }
+    std::cout << "Tempo medio para preencher Mapa com " << N << " nos = " << somaMAPA << " segundos" << std::endl; //Exibe na tela os valores
+    std::cout << "Tempo para liberar Mapa com " << N << " nos = " << tempo_libera_MAPA << " segundos" << std::endl;
+    std::cout<<std::endl;
+    free(tempo_MAPA);
+    //=============================Arvore B======================================
+    //A rvore B  medida duas vezes: com um malloc por n e com a arena (Comum/Alocador.h)
+    int modos[2] = {ALOCA_MALLOC, ALOCA_ARENA};
+    const char *nome_modos[2] = {"malloc", "arena"};
+    for(int m=0;m<2;m++)
+    {
+        std::cout<<"Inserindo elementos na Arvore B ("<<nome_modos[m]<<") e calculando o tempo..."<<std::endl;
+        std::cout<<std::endl;
+        double tempo_libera = 0.0; //Tempo para liberar a rvore inteira
+        for(int j=0;j<num_rodadas;j++)
+        {
+            ArvB *raiz = cria_ArvB(modos[m]);//Cria rvore B
+            for(int i=0;i<N;i++)
+            {
+                tmr.reset();
+                //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+                res = insere_ArvB(raiz,i,i);
+                //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+                t = tmr.elapsed();
+                tempo_B[i] = t;
+                if(res != 1) falhas++;
+            }
+            if(modos[m] == ALOCA_ARENA) //Memria ocupada pelos ns
+                bytes_arena = alocador_ArvB(raiz)->memoria;
+            else
+                bytes_malloc = (size_t) totalNO_ArvB(*raiz) * sizeof(struct NO); //Cada n guarda vrias chaves. Sem contar o cabealho do malloc
+            tmr.reset();
+            libera_ArvB(raiz);
+            tempo_libera = tmr.elapsed();
+        }
+
+        std::cout<<"Calculando o tempo medio de insercao..."<<std::endl;
+        std::cout<<std::endl;
+        double somaB = 0.0;
+        for(int j=0;j<N;j++) //Calcula o tempo total para inserir N valores na rvore B
+        {
+            somaB = somaB + tempo_B[j];
+        }
+        std::cout << "Tempo medio para preencher Arvore B ("<<nome_modos[m]<<") com " << N << " nos = " << somaB << " segundos" << std::endl; //Exibe na tela
+        std::cout << "Tempo para liberar Arvore B ("<<nome_modos[m]<<") com " << N << " nos = " << tempo_libera << " segundos" << std::endl;
+        std::cout<<std::endl;
+    }
+    //Bytes por n de cada implementao
+    std::cout << "Bytes por no - Mapa: " << (double) bytes_MAPA / N << std::endl;
+    std::cout << "Bytes por no - Arvore B (malloc): " << (double) bytes_malloc / N << std::endl;
+    std::cout << "Bytes por no - Arvore B (arena): " << (double) bytes_arena / N << std::endl;
+    std::cout<<std::endl;
+    free(tempo_B); //Libera o vetor
+
+    if(falhas > 0)
+        std::cout << "Alguma insercao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,512 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <vector>
+#include <string>
+
+//Programa nico de benchmark: mede os motores (AVL, LLRB, Rubro-Negra, rvore B e std::map) com os parmetros passados na linha
+//de comando, sem precisar editar N e num_rodadas e recompilar, e escreve os resultados em CSV ou JSON (um registro por medida),
+//para que as rodadas de planejamento de capacidade possam ser feitas por script e comparadas entre compilaes
+//
+//Compilar (de Cdigos-Implementao): g++ -O3 -std=c++17 -o benchmark Benchmark/Benchmark.cpp
+//Exemplo: ./benchmark --motores avl,llrb,mapa --operacoes insercao,busca --n 1e5,1e6,1e7 --rodadas 5 --semente 7 --formato json --saida res.json
+//
+//Opes (listas separadas por vrgula):
+//  --motores     avl, llrb, rb, b, mapa (padro: todos)
+//  --operacoes   insercao, busca, remocao, mista (padro: insercao,busca,remocao)
+//  --n           tamanhos do dicionrio (padro: 1000000). Aceita 1e6
+//  --consultas   operaes medidas na busca e na mista (padro: N)
+//  --rodadas     repeties de cada medida (padro: 3)
+//  --semente     semente do gerador (padro: 42). A rodada r usa semente + r
+//  --distribuicoes  uniforme, zipf, ordenada, decrescente, agrupada, faltantes (padro: uniforme). Ver Comum/GeraChaves.h
+//  --alocacao    arena ou malloc (padro: arena)
+//  --formato     csv ou json (padro: csv)
+//  --saida       arquivo de sada (padro: a sada padro). O andamento vai para a sada de erro
+//  --rotulo      texto copiado em todos os registros, para identificar a compilao (por exemplo, o commit)
+//  --medicao     lote ou latencia (padro: lote). Ver abaixo
+//  --amostra     na medio de latncia, mede uma operao a cada K (padro: 1, todas)
+//  --contadores  sim ou nao (padro: sim). Contadores de hardware em volta do trecho medido (Comum/Contadores.h)
+//
+//Operaes (com as chaves 0, 2, 4...2(N-1) e informao = chave). A ordem das chaves vem da distribuio (Comum/GeraChaves.h):
+//  insercao: insere as N chaves numa rvore vazia
+//  busca: com as N chaves inseridas, faz Q consultas sorteadas na distribuio (com repetio)
+//  remocao: com as N chaves inseridas, faz N remoes na distribuio (sem repetio, menos na zipf)
+//  mista: com as N chaves inseridas, Q operaes (50% consultas, 25% inseres e 25% remoes) com as chaves da busca
+//A rvore  sempre construda na ordem da insero: a da distribuio quando ela  ordenada, decrescente ou agrupada, e uniforme
+//nas outras (zipf e faltantes descrevem acessos, no a ordem em que as chaves chegaram)
+//S o trecho da operao  medido; a construo da rvore e a liberao ficam fora
+//Medio (Comum/Latencia.h):
+//  lote: um relgio em volta do lao inteiro, s a vazo (ns por operao), sem nada somado a cada operao
+//  latencia: alm disso, a operao amostrada  medida com o contador de ciclos e vai para um histograma log-linear, de onde saem
+//            as colunas p50_ns, p99_ns, p999_ns e max_ns (erro de no mximo 3%, j descontado o custo de ler o relgio, medido
+//            na calibrao). As barreiras do relgio tambm impedem que buscas seguidas se sobreponham no processador, ento a
+//            latncia medida  a de uma operao isolada. A vazo dessa medio inclui o custo do relgio,
+//            ento para comparar vazo use a medio em lote. Na medio em lote essas colunas ficam vazias (null no JSON)
+//Contadores: ciclos, instrues, desvios errados, falhas de cache (ltimo nvel), de L1d e de TLB de dados e falhas de pgina,
+//ligados s durante o trecho medido e divididos pelo nmero de operaes (colunas ciclos_por_op, instrucoes_por_op...). O que o
+//kernel no deixar abrir (mquina virtual sem PMU, perf_event_paranoid 3)  avisado na sada de erro e a coluna fica vazia
+//Todos os motores de uma rodada recebem exatamente as mesmas chaves. A coluna confere  1 quando o nmero de operaes que
+//deram certo (inseridos, encontrados, removidos)  o esperado, simulado antes numa tabela de presena
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "Motores.h" //rvores, cada uma no seu namespace, e o std::map com a mesma interface
+#include "../Comum/GeraChaves.h" //Chaves distintas em O(m) e distribuies de acesso
+#include "../Comum/Latencia.h" //Contador de ciclos e histograma de latncia
+#include "../Comum/Contadores.h" //Contadores de hardware (perf_event_open)
+#include "Texto.h" //Listas da linha de comando e texto no JSON
+
+#define OP_INSERCAO 0
+#define OP_BUSCA 1
+#define OP_REMOCAO 2
+#define OP_MISTA 3
+
+static const char *nomes_Operacao[] = {"insercao", "busca", "remocao", "mista"};
+
+//Carga de uma rodada, gerada uma vez e usada por todos os motores
+struct Carga{
+    int N;
+    int distribuicao;
+    std::vector<int> chaves; //Ordem de insero
+    std::vector<int> remocao; //Chaves das remoes
+    std::vector<int> consultas; //Chaves da busca e da mista
+    std::vector<char> tipos; //Operao de cada passo da mista: OP_BUSCA, OP_INSERCAO ou OP_REMOCAO
+    long long esperado_busca; //Quantas consultas da busca encontram a chave
+    long long esperado_remocao; //Quantas remoes encontram a chave
+    long long esperado_mista; //Quantas operaes da mista do certo
+};
+
+//Sorteia a carga da rodada. Os resultados esperados so simulados num vetor de presena com as chaves 0..2N-1
+void gera_Carga(struct Carga *c, int N, int num_consultas, int distribuicao, unsigned int semente){
+    struct Sorteio s;
+    inicia_Sorteio(&s, semente);
+    c->N = N;
+    c->distribuicao = distribuicao;
+    c->chaves.resize(N);
+    c->remocao.resize(N);
+    c->consultas.resize(num_consultas);
+    c->tipos.resize(num_consultas);
+    int ordem = (distribuicao == DIST_ORDENADA || distribuicao == DIST_DECRESCENTE || distribuicao == DIST_AGRUPADA) ? distribuicao : DIST_UNIFORME;
+    gera_Chaves(c->chaves.data(), N, N, ordem, 1, proximo_Sorteio(&s));
+    gera_Chaves(c->remocao.data(), N, N, distribuicao, 1, proximo_Sorteio(&s));
+    gera_Chaves(c->consultas.data(), num_consultas, N, distribuicao, 0, proximo_Sorteio(&s));
+    for(int j=0;j<num_consultas;j++){
+        int r = (int) intervalo_Sorteio(&s, 4);
+        c->tipos[j] = (r < 2) ? OP_BUSCA : (r == 2 ? OP_INSERCAO : OP_REMOCAO);
+    }
+
+    std::vector<char> presente(2 * N);
+    for(int v=0;v<2*N;v++)
+        presente[v] = (v % 2 == 0);
+    c->esperado_busca = 0;
+    for(int j=0;j<num_consultas;j++)
+        c->esperado_busca += presente[c->consultas[j]];
+    c->esperado_mista = 0;
+    for(int j=0;j<num_consultas;j++){
+        int v = c->consultas[j];
+        if(c->tipos[j] == OP_BUSCA)
+            c->esperado_mista += presente[v];
+        else if(c->tipos[j] == OP_INSERCAO){
+            c->esperado_mista += !presente[v];
+            presente[v] = 1;
+        }else{
+            c->esperado_mista += presente[v];
+            presente[v] = 0;
+        }
+    }
+    for(int v=0;v<2*N;v++) //A remoo comea de novo com as N chaves
+        presente[v] = (v % 2 == 0);
+    c->esperado_remocao = 0;
+    for(int i=0;i<N;i++){
+        c->esperado_remocao += presente[c->remocao[i]];
+        presente[c->remocao[i]] = 0;
+    }
+}
+
+//Resultado de uma medida
+struct Medida{
+    long long operacoes; //Operaes medidas
+    double segundos; //Tempo total delas
+    int confere; //1 se o nmero de operaes que deram certo  o esperado
+    struct Histograma *latencia; //Latncia das operaes amostradas (em tiques), ou NULL na medio em lote
+    int amostra; //Mede uma operao a cada amostra
+    struct Contadores *contadores; //Contadores ligados durante o trecho medido, ou NULL
+};
+
+//Passo j da operao medida. Usado pela medio de latncia, que mede um passo de cada vez
+template <class M>
+inline int passo_Motor(typename M::Arvore *arv, int operacao, const struct Carga *c, int j){
+    switch(operacao){
+    case OP_INSERCAO:
+        return M::insere(arv, c->chaves[j], c->chaves[j]);
+    case OP_BUSCA:
+        return M::consulta(arv, c->consultas[j]);
+    case OP_REMOCAO:
+        return M::remove(arv, c->remocao[j]);
+    }
+    int v = c->consultas[j];
+    if(c->tipos[j] == OP_BUSCA)
+        return M::consulta(arv, v);
+    if(c->tipos[j] == OP_INSERCAO)
+        return M::insere(arv, v, v);
+    return M::remove(arv, v);
+}
+
+//Mede uma operao num motor M (MotorAVL, MotorLLRB, MotorRB, MotorB ou MotorMapa)
+//Com med->latencia != NULL tambm registra a latncia de uma operao a cada med->amostra
+template <class M>
+void mede_Motor(int operacao, const struct Carga *c, int modo_alocacao, struct Medida *med){
+    Timer tmr;
+    typename M::Arvore *arv = M::cria(modo_alocacao);
+    const int N = c->N;
+    const int Q = (int) c->consultas.size();
+    long long certos = 0, esperado = 0;
+    if(med->latencia != NULL){
+        if(operacao != OP_INSERCAO)
+            for(int i=0;i<N;i++) //Construo, fora da medida
+                M::insere(arv, c->chaves[i], c->chaves[i]);
+        int total = (operacao == OP_INSERCAO || operacao == OP_REMOCAO) ? N : Q;
+        int falta = 0; //Operaes at a prxima amostra
+        inicia_Contadores(med->contadores);
+        tmr.reset();
+        for(int j=0;j<total;j++){
+            if(falta == 0){
+                uint64_t t0 = le_Relogio();
+                certos += passo_Motor<M>(arv, operacao, c, j);
+                registra_Histograma(med->latencia, le_Relogio() - t0);
+                falta = med->amostra;
+            }else
+                certos += passo_Motor<M>(arv, operacao, c, j);
+            falta--;
+        }
+        med->segundos = tmr.elapsed();
+        para_Contadores(med->contadores);
+        med->operacoes = total;
+        esperado = (operacao == OP_INSERCAO) ? N : (operacao == OP_BUSCA) ? c->esperado_busca :
+                   (operacao == OP_REMOCAO) ? c->esperado_remocao : c->esperado_mista;
+    }else if(operacao == OP_INSERCAO){
+        inicia_Contadores(med->contadores);
+        tmr.reset();
+        for(int i=0;i<N;i++)
+            certos += M::insere(arv, c->chaves[i], c->chaves[i]);
+        med->segundos = tmr.elapsed();
+        para_Contadores(med->contadores);
+        med->operacoes = N;
+        esperado = N;
+    }else{
+        for(int i=0;i<N;i++) //Construo, fora da medida
+            M::insere(arv, c->chaves[i], c->chaves[i]);
+        if(operacao == OP_BUSCA){
+            inicia_Contadores(med->contadores);
+            tmr.reset();
+            for(int j=0;j<Q;j++)
+                certos += M::consulta(arv, c->consultas[j]);
+            med->segundos = tmr.elapsed();
+            para_Contadores(med->contadores);
+            med->operacoes = Q;
+            esperado = c->esperado_busca;
+        }else if(operacao == OP_REMOCAO){
+            inicia_Contadores(med->contadores);
+            tmr.reset();
+            for(int i=0;i<N;i++)
+                certos += M::remove(arv, c->remocao[i]);
+            med->segundos = tmr.elapsed();
+            para_Contadores(med->contadores);
+            med->operacoes = N;
+            esperado = c->esperado_remocao;
+        }else{
+            inicia_Contadores(med->contadores);
+            tmr.reset();
+            for(int j=0;j<Q;j++){
+                int v = c->consultas[j];
+                if(c->tipos[j] == OP_BUSCA)
+                    certos += M::consulta(arv, v);
+                else if(c->tipos[j] == OP_INSERCAO)
+                    certos += M::insere(arv, v, v);
+                else
+                    certos += M::remove(arv, v);
+            }
+            med->segundos = tmr.elapsed();
+            para_Contadores(med->contadores);
+            med->operacoes = Q;
+            esperado = c->esperado_mista;
+        }
+    }
+    med->confere = (certos == esperado);
+    M::libera(arv);
+}
+
+//Tabela de motores: nome na linha de comando e a funo que mede
+struct Motor{
+    const char *nome;
+    void (*mede)(int operacao, const struct Carga *c, int modo_alocacao, struct Medida *med);
+};
+
+static const struct Motor motores_Benchmark[] = {
+    {"avl", mede_Motor<avl::MotorAVL>},
+    {"llrb", mede_Motor<llrb::MotorLLRB>},
+    {"rb", mede_Motor<rb::MotorRB>},
+    {"b", mede_Motor<arvb::MotorB>},
+    {"mapa", mede_Motor<MotorMapa>},
+};
+static const int num_motores = sizeof(motores_Benchmark) / sizeof(motores_Benchmark[0]);
+
+//==================Linha de comando==========================
+
+void ajuda_Benchmark(){
+    fprintf(stderr, "Uso: benchmark [--motores avl,llrb,rb,b,mapa] [--operacoes insercao,busca,remocao,mista] [--n 1e6,...]\n"
+                    "                [--consultas Q] [--rodadas R] [--semente S] [--alocacao arena|malloc]\n"
+                    "                [--distribuicoes uniforme,zipf,ordenada,decrescente,agrupada,faltantes]\n"
+                    "                [--formato csv|json] [--saida arquivo] [--rotulo texto]\n"
+                    "                [--medicao lote|latencia] [--amostra K] [--contadores sim|nao]\n");
+}
+
+int main(int argc, char *argv[]){
+    std::vector<std::string> nomes_motores, nomes_operacoes, nomes_distribuicoes(1, "uniforme");
+    for(int m=0;m<num_motores;m++)
+        nomes_motores.push_back(motores_Benchmark[m].nome);
+    nomes_operacoes.push_back("insercao");
+    nomes_operacoes.push_back("busca");
+    nomes_operacoes.push_back("remocao");
+    std::vector<int> tamanhos(1, 1000000);
+    long long num_consultas = 0; //0 = N
+    int num_rodadas = 3;
+    unsigned int semente = 42;
+    int modo_alocacao = ALOCA_ARENA;
+    int json = 0;
+    int latencia = 0, amostra = 1;
+    int usa_contadores = 1;
+    const char *arquivo = NULL, *rotulo = "";
+
+    for(int a=1;a<argc;a++){
+        std::string opcao = argv[a];
+        if(opcao == "--ajuda" || opcao == "-h"){
+            ajuda_Benchmark();
+            return 0;
+        }
+        if(a + 1 >= argc){
+            fprintf(stderr, "Falta o valor de %s\n", argv[a]);
+            ajuda_Benchmark();
+            return 1;
+        }
+        const char *valor = argv[++a];
+        int valido = 1; //0 se um valor numrico no serve (ver le_Inteiro)
+        if(opcao == "--motores")
+            nomes_motores = separa_Lista(valor);
+        else if(opcao == "--operacoes")
+            nomes_operacoes = separa_Lista(valor);
+        else if(opcao == "--n"){
+            tamanhos.clear();
+            std::vector<std::string> itens = separa_Lista(valor);
+            for(size_t i=0;i<itens.size() && valido;i++){
+                int n = 0;
+                valido = le_Inteiro(itens[i].c_str(), 1, INT_MAX, &n);
+                tamanhos.push_back(n);
+            }
+        }else if(opcao == "--consultas"){
+            int q = 0;
+            valido = le_Inteiro(valor, 0, INT_MAX, &q);
+            num_consultas = q;
+        }else if(opcao == "--rodadas")
+            valido = le_Inteiro(valor, 1, INT_MAX, &num_rodadas);
+        else if(opcao == "--semente")
+            semente = (unsigned int) strtoul(valor, NULL, 10);
+        else if(opcao == "--distribuicoes")
+            nomes_distribuicoes = separa_Lista(valor);
+        else if(opcao == "--alocacao")
+            modo_alocacao = (std::string(valor) == "malloc") ? ALOCA_MALLOC : ALOCA_ARENA;
+        else if(opcao == "--formato")
+            json = (std::string(valor) == "json");
+        else if(opcao == "--saida")
+            arquivo = valor;
+        else if(opcao == "--rotulo")
+            rotulo = valor;
+        else if(opcao == "--medicao"){
+            if(std::string(valor) != "lote" && std::string(valor) != "latencia"){
+                fprintf(stderr, "Medicao desconhecida: %s\n", valor);
+                return 1;
+            }
+            latencia = (std::string(valor) == "latencia");
+        }else if(opcao == "--amostra")
+            valido = le_Inteiro(valor, 1, INT_MAX, &amostra);
+        else if(opcao == "--contadores")
+            usa_contadores = (std::string(valor) != "nao");
+        else{
+            fprintf(stderr, "Opcao desconhecida: %s\n", argv[a - 1]);
+            ajuda_Benchmark();
+            return 1;
+        }
+        if(!valido){
+            fprintf(stderr, "Valor invalido para %s: %s\n", argv[a - 1], valor);
+            return 1;
+        }
+    }
+
+    //Confere os nomes antes de comear a medir
+    std::vector<int> motores, operacoes;
+    for(size_t i=0;i<nomes_motores.size();i++){
+        int m = 0;
+        while(m < num_motores && nomes_motores[i] != motores_Benchmark[m].nome)
+            m++;
+        if(m == num_motores){
+            fprintf(stderr, "Motor desconhecido: %s\n", nomes_motores[i].c_str());
+            return 1;
+        }
+        motores.push_back(m);
+    }
+    for(size_t i=0;i<nomes_operacoes.size();i++){
+        int o = 0;
+        while(o < 4 && nomes_operacoes[i] != nomes_Operacao[o])
+            o++;
+        if(o == 4){
+            fprintf(stderr, "Operacao desconhecida: %s\n", nomes_operacoes[i].c_str());
+            return 1;
+        }
+        operacoes.push_back(o);
+    }
+    std::vector<int> distribuicoes;
+    for(size_t i=0;i<nomes_distribuicoes.size();i++){
+        int d = distribuicao_Nome(nomes_distribuicoes[i].c_str());
+        if(d < 0){
+            fprintf(stderr, "Distribuicao desconhecida: %s\n", nomes_distribuicoes[i].c_str());
+            return 1;
+        }
+        distribuicoes.push_back(d);
+    }
+    for(size_t i=0;i<tamanhos.size();i++)
+        if(tamanhos[i] < 1 || tamanhos[i] > INT_MAX / 2){
+            fprintf(stderr, "N invalido\n");
+            return 1;
+        }
+    if(amostra < 1){
+        fprintf(stderr, "Amostra invalida\n");
+        return 1;
+    }
+    struct Relogio relogio = {}; //S  calibrado na medio de latncia; na de lote no  lido
+    struct Histograma histograma;
+    if(latencia)
+        calibra_Relogio(&relogio);
+    struct Contadores contadores;
+    if(usa_contadores){
+        abre_Contadores(&contadores);
+        for(int i=0;i<NUM_CONTADORES;i++)
+            if(!disponivel_Contador(&contadores, i))
+                std::cerr << "Contador indisponivel: " << nomes_Contador[i] << std::endl;
+    }
+
+    FILE *saida = stdout;
+    if(arquivo != NULL && (saida = fopen(arquivo, "w")) == NULL){
+        fprintf(stderr, "Nao consegui abrir %s\n", arquivo);
+        return 1;
+    }
+    if(json)
+        fprintf(saida, "[\n");
+    else{
+        fprintf(saida, "rotulo,motor,operacao,distribuicao,n,rodada,semente,alocacao,medicao,operacoes,segundos,ns_por_op,mops_por_s,"
+                        "amostras,p50_ns,p99_ns,p999_ns,max_ns,");
+        for(int i=0;i<NUM_CONTADORES;i++)
+            fprintf(saida, "%s_por_op,", nomes_Contador[i]);
+        fprintf(saida, "confere\n");
+    }
+
+    int erro = 0, primeiro = 1;
+    struct Carga carga;
+    for(size_t t=0;t<tamanhos.size();t++){
+        int N = tamanhos[t];
+        int Q = (num_consultas > 0) ? (int) num_consultas : N;
+        for(size_t d=0;d<distribuicoes.size();d++){
+            for(int r=0;r<num_rodadas;r++){
+                gera_Carga(&carga, N, Q, distribuicoes[d], semente + r);
+                const char *distribuicao = nomes_Distribuicao[distribuicoes[d]];
+                for(size_t m=0;m<motores.size();m++){
+                    for(size_t o=0;o<operacoes.size();o++){
+                        struct Medida med;
+                        med.latencia = latencia ? &histograma : NULL;
+                        med.amostra = amostra;
+                        med.contadores = usa_contadores ? &contadores : NULL;
+                        if(latencia)
+                            zera_Histograma(&histograma);
+                        motores_Benchmark[motores[m]].mede(operacoes[o], &carga, modo_alocacao, &med);
+                        double ns = 1e9 * med.segundos / med.operacoes;
+                        double mops = med.operacoes / med.segundos / 1e6;
+                        const char *nome = motores_Benchmark[motores[m]].nome;
+                        const char *alocacao = (modo_alocacao == ALOCA_ARENA) ? "arena" : "malloc";
+                        const char *medicao = latencia ? "latencia" : "lote";
+                        //Colunas de latncia: amostras e percentis em ns, vazias (null no JSON) na medio em lote
+                        char colunas[512];
+                        double p50 = 0, p99 = 0;
+                        if(latencia){
+                            p50 = nanos_Relogio(&relogio, percentil_Histograma(&histograma, 0.5));
+                            p99 = nanos_Relogio(&relogio, percentil_Histograma(&histograma, 0.99));
+                            double p999 = nanos_Relogio(&relogio, percentil_Histograma(&histograma, 0.999));
+                            double maximo = nanos_Relogio(&relogio, histograma.maximo);
+                            snprintf(colunas, sizeof(colunas), json ? "\"amostras\": %llu, \"p50_ns\": %.6g, \"p99_ns\": %.6g, \"p999_ns\": %.6g, \"max_ns\": %.6g"
+                                                                    : "%llu,%.6g,%.6g,%.6g,%.6g",
+                                     (unsigned long long) histograma.total, p50, p99, p999, maximo);
+                        }else
+                            snprintf(colunas, sizeof(colunas), "%s", json ? "\"amostras\": null, \"p50_ns\": null, \"p99_ns\": null, \"p999_ns\": null, \"max_ns\": null"
+                                                                          : ",,,,");
+                        //Contadores por operao, vazios (null) quando desligados ou indisponveis
+                        for(int i=0;i<NUM_CONTADORES;i++){
+                            size_t usado = strlen(colunas);
+                            if(usa_contadores && disponivel_Contador(&contadores, i)){
+                                double por_op = (double) contadores.valor[i] / med.operacoes;
+                                if(json)
+                                    snprintf(colunas + usado, sizeof(colunas) - usado, ", \"%s_por_op\": %.6g", nomes_Contador[i], por_op);
+                                else
+                                    snprintf(colunas + usado, sizeof(colunas) - usado, ",%.6g", por_op);
+                            }else if(json)
+                                snprintf(colunas + usado, sizeof(colunas) - usado, ", \"%s_por_op\": null", nomes_Contador[i]);
+                            else
+                                snprintf(colunas + usado, sizeof(colunas) - usado, ",");
+                        }
+                        if(json){
+                            fprintf(saida, "%s  {\"rotulo\": ", primeiro ? "" : ",\n");
+                            escreveTexto_JSON(saida, rotulo);
+                            fprintf(saida, ", \"motor\": \"%s\", \"operacao\": \"%s\", \"distribuicao\": \"%s\", \"n\": %d, \"rodada\": %d, \"semente\": %u, \"alocacao\": \"%s\", "
+                                           "\"medicao\": \"%s\", \"operacoes\": %lld, \"segundos\": %.9g, \"ns_por_op\": %.6g, \"mops_por_s\": %.6g, %s, \"confere\": %d}",
+                                    nome, nomes_Operacao[operacoes[o]], distribuicao, N, r, semente + r, alocacao, medicao, med.operacoes, med.segundos, ns, mops,
+                                    colunas, med.confere);
+                        }else
+                            fprintf(saida, "%s,%s,%s,%s,%d,%d,%u,%s,%s,%lld,%.9g,%.6g,%.6g,%s,%d\n", rotulo, nome, nomes_Operacao[operacoes[o]], distribuicao, N, r,
+                                    semente + r, alocacao, medicao, med.operacoes, med.segundos, ns, mops, colunas, med.confere);
+                        fflush(saida); //Uma varredura longa interrompida mantm o que j foi medido
+                        primeiro = 0;
+                        if(!med.confere)
+                            erro = 1;
+                        std::cerr << nome << " " << nomes_Operacao[operacoes[o]] << " " << distribuicao << " N = " << N << " rodada " << r << ": " << ns << " ns por operacao";
+                        if(latencia)
+                            std::cerr << " (p50 " << p50 << " ns, p99 " << p99 << " ns)";
+                        std::cerr << std::endl;
+                    }
+                }
+            }
+        }
+    }
+    if(json)
+        fprintf(saida, "%s]\n", primeiro ? "" : "\n");
+    if(saida != stdout)
+        fclose(saida);
+    if(usa_contadores)
+        fecha_Contadores(&contadores);
+
+    if(erro)
+        std::cerr << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return erro;
+}
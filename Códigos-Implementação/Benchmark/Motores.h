@@ -0,0 +1,67 @@
+#ifndef MOTORES_H
+#define MOTORES_H
+
+//Motores que o programa de benchmark sabe medir (Benchmark/Benchmark.cpp)
+//Cada rvore j rene as suas operaes numa struct (MotorAVL, MotorLLRB, MotorRB, MotorB), a mesma usada por Comum/Particionado.h.
+//Mas os cabealhos das rvores definem todos struct NO e funes com os mesmos nomes (libera_NO, procuraMenor...), ento no
+//podem entrar juntos no mesmo programa. Aqui cada um entra no seu namespace. Os cabealhos que eles incluem (biblioteca padro
+//e Comum/) so includos antes, fora dos namespaces: quando a rvore tenta inclu-los de novo, a guarda do cabealho j est definida
+//Para um motor novo: incluir o cabealho num namespace novo e acrescentar uma linha nas tabelas de motores de Benchmark.cpp e Ycsb.cpp
+//Alm de cria, libera, insere, consulta e remove, o Ycsb.cpp usa atualiza e varre
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <cstddef>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <map>
+#include "../Comum/Alocador.h"
+#include "../Comum/ConsultaLote.h"
+#include "../Comum/ArvoreCongelada.h"
+#include "../Comum/Iterador.h"
+#include "../Comum/ConsultaVizinho.h"
+#include "../Comum/Dica.h"
+
+namespace avl{
+#include "../AVL/ArvoreAVL.h"
+}
+namespace llrb{
+#include "../LLRB/ArvoreLLRB.h"
+}
+namespace rb{
+#include "../RB/ArvoreRB.h"
+}
+namespace arvb{
+#include "../ArvoreB/ArvoreB.h"
+}
+
+//std::map com a mesma interface dos motores das rvores. O modo de alocao no se aplica
+struct MotorMapa{
+    typedef std::map<int, int> Arvore;
+    static Arvore* cria(int){ return new std::map<int, int>(); }
+    static void libera(Arvore *mapa){ delete mapa; }
+    static int insere(Arvore *mapa, int chave, int valor){ return mapa->insert(std::pair<int, int>(chave, valor)).second ? 1 : 0; }
+    static int consulta(Arvore *mapa, int valor){ return mapa->find(valor) != mapa->end(); }
+    static int remove(Arvore *mapa, int valor){ return (int) mapa->erase(valor); }
+    static int atualiza(Arvore *mapa, int chave, int valor){
+        std::map<int, int>::iterator it = mapa->find(chave);
+        if(it == mapa->end())
+            return 0;
+        it->second = valor;
+        return 1;
+    }
+    template <class F>
+    static long long varre(Arvore *mapa, int lo, int hi, F funcao){
+        long long visitados = 0;
+        for(std::map<int, int>::iterator it = mapa->lower_bound(lo); it != mapa->end() && it->first <= hi; ++it){
+            funcao(it->first, it->second);
+            visitados++;
+        }
+        return visitados;
+    }
+};
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef TEXTO_H
+#define TEXTO_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <string>
+
+//Tratamento de texto comum aos programas de benchmark (Benchmark.cpp e Ycsb.cpp): as listas e os nmeros da linha de comando e o
+//texto no JSON
+
+//Separa a lista "a,b,c"
+static inline std::vector<std::string> separa_Lista(const char *lista){
+    std::vector<std::string> itens;
+    std::string atual;
+    for(const char *p=lista;;p++){
+        if(*p == ',' || *p == '\0'){
+            if(!atual.empty())
+                itens.push_back(atual);
+            atual.clear();
+            if(*p == '\0')
+                break;
+        }else
+            atual += *p;
+    }
+    return itens;
+}
+
+//L um inteiro entre minimo e maximo. Aceita notao cientfica (1e6), mas no sobras (1e6x) nem fraes (2.5). Retorna 0 se
+//o texto no serve. O intervalo  conferido no double, antes da converso: converter um double que no cabe no int (1e10) 
+//comportamento indefinido
+static inline int le_Inteiro(const char *texto, int minimo, int maximo, int *valor){
+    char *fim;
+    double x = strtod(texto, &fim);
+    if(fim == texto || *fim != '\0' || !(x >= minimo && x <= maximo) || x != floor(x)) //!(...) tambm recusa NaN
+        return 0;
+    *valor = (int) x;
+    return 1;
+}
+
+//Escreve o texto entre aspas, escapando o que o JSON exige
+static inline void escreveTexto_JSON(FILE *saida, const char *texto){
+    fputc('"', saida);
+    for(const char *p=texto;*p;p++){
+        if(*p == '"' || *p == '\\')
+            fputc('\\', saida);
+        if((unsigned char) *p >= 0x20)
+            fputc(*p, saida);
+    }
+    fputc('"', saida);
+}
+
+#endif
@@ -0,0 +1,576 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+//Benchmark de cargas mistas no estilo do YCSB (Cooper et al., "Benchmarking Cloud Serving Systems with YCSB", 2010)
+//Os programas DicXxMAP-Busca, -Insercao e -Remocao (e o Benchmark.cpp) medem uma operao de cada vez, mas o trfego real mistura
+//leituras, escritas e varreduras sobre um dicionrio j carregado. Aqui cada carga  uma proporo de tipos de operao e uma
+//distribuio de chaves; a rvore  carregada com N chaves e os clientes (uma ou mais threads) executam Q operaes sorteadas
+//O resultado sai por tipo de operao: vazo e percentis de latncia (Comum/Latencia.h), em CSV ou JSON
+//
+//Compilar (de Cdigos-Implementao): g++ -O3 -std=c++17 -pthread -o ycsb Benchmark/Ycsb.cpp
+//Exemplo: ./ycsb --motores avl,b,mapa --cargas a,b,e --n 1e6 --threads 1,4 --formato json --saida ycsb.json
+//
+//Opes (listas separadas por vrgula):
+//  --motores     avl, llrb, rb, b, mapa (padro: todos)
+//  --cargas      a, b, c, d, e, f (padro: todas) e personalizada (ver --proporcoes)
+//  --proporcoes  porcentagem de cada tipo na carga personalizada, somando 100. Ex.: busca=70,insercao=10,remocao=10,varredura=10
+//  --distribuicao  chaves da carga personalizada: uniforme, zipf ou recente (padro: zipf)
+//                Sem --cargas, --proporcoes ou --distribuicao mede s a personalizada. Com --cargas, ela tem que estar na lista
+//  --n           chaves carregadas antes da medida (padro: 1000000). Aceita 1e6
+//  --operacoes   operaes medidas em cada execuo, somando todas as threads (padro: N)
+//  --threads     quantidades de clientes (padro: 1)
+//  --particoes   partes do dicionrio com mais de uma thread (padro: 16). Ver abaixo
+//  --varredura   tamanho mximo de uma varredura, em chaves (padro: 100, como no YCSB)
+//  --amostra     mede a latncia de uma operao a cada K de cada thread (padro: 1, todas). 0 = s a vazo
+//  --rodadas, --semente, --alocacao, --formato, --saida, --rotulo: como no Benchmark.cpp
+//
+//Cargas (as mesmas do YCSB; a E usa a varredura de intervalo das rvores):
+//  a: 50% busca, 50% atualizacao (zipf)           d: 95% busca, 5% insercao (recente)
+//  b: 95% busca, 5% atualizacao (zipf)            e: 95% varredura, 5% insercao (zipf)
+//  c: 100% busca (zipf)                           f: 50% busca, 50% le_modifica (zipf)
+//Tipos de operao, com as chaves carregadas 0, 2, 4...2(N-1):
+//  busca (consulta), atualizacao (troca a informao de uma chave), insercao (de uma chave nova: os mpares, em ordem sorteada),
+//  remocao, varredura (as chaves em [v, v + 2L - 1], cerca de L chaves, com L sorteado entre 1 e --varredura) e
+//  le_modifica (l a informao e grava informao + 1, o read-modify-write do YCSB)
+//Distribuies das chaves das buscas, atualizaes, remoes e varreduras (Comum/GeraChaves.h):
+//  uniforme; zipf (poucas chaves quentes); recente (zipf sobre a ordem de insero: as chaves inseridas por ltimo so as mais lidas)
+//
+//Com uma thread o cliente usa a rvore direto, sem trava. Com T threads o dicionrio  um DicParticionado (Comum/Particionado.h)
+//com --particoes partes, cada uma com a sua trava, e as operaes de cada thread so uma fatia contnua do fluxo sorteado
+//A varredura trava uma parte de cada vez e a le_modifica trava a parte da chave durante a leitura e a escrita
+//Com vrias threads, na carga d parte das buscas chega a uma chave recente antes da thread que a insere (certos menor que operacoes)
+//O fluxo de operaes  sorteado antes (fora da medida) e  o mesmo para todos os motores e quantidades de threads
+//A coluna mops_por_s de cada tipo  a parte dele na vazo total (operaes do tipo / tempo da execuo). A linha "total" junta
+//os tipos. confere  1 quando a quantidade de chaves no fim  N + inseres que deram certo - remoes que deram certo
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "Motores.h" //rvores, cada uma no seu namespace, e o std::map com a mesma interface
+#include "../Comum/Particionado.h" //Dicionrio dividido em partes com trava, para vrias threads
+#include "../Comum/GeraChaves.h" //Permutao, Zipf e sorteio das chaves
+#include "../Comum/Latencia.h" //Contador de ciclos e histograma de latncia
+#include "Texto.h" //Listas da linha de comando e texto no JSON
+
+#define OP_BUSCA 0
+#define OP_ATUALIZACAO 1
+#define OP_INSERCAO 2
+#define OP_REMOCAO 3
+#define OP_VARREDURA 4
+#define OP_LE_MODIFICA 5
+#define NUM_TIPOS 6
+
+static const char *nomes_Tipo[NUM_TIPOS] = {"busca", "atualizacao", "insercao", "remocao", "varredura", "le_modifica"};
+
+#define DIST_RECENTE NUM_DISTRIBUICOES //Alm das de GeraChaves.h: zipf sobre a ordem de insero
+
+//Carga: porcentagem de cada tipo de operao e distribuio das chaves
+struct CargaYcsb{
+    const char *nome;
+    int proporcao[NUM_TIPOS]; //busca, atualizacao, insercao, remocao, varredura, le_modifica
+    int distribuicao;
+};
+
+static struct CargaYcsb cargas_Ycsb[] = {
+    {"a", {50, 50, 0, 0, 0, 0}, DIST_ZIPF},
+    {"b", {95, 5, 0, 0, 0, 0}, DIST_ZIPF},
+    {"c", {100, 0, 0, 0, 0, 0}, DIST_ZIPF},
+    {"d", {95, 0, 5, 0, 0, 0}, DIST_RECENTE},
+    {"e", {0, 0, 5, 0, 95, 0}, DIST_ZIPF},
+    {"f", {50, 0, 0, 0, 0, 50}, DIST_ZIPF},
+    {"personalizada", {50, 50, 0, 0, 0, 0}, DIST_ZIPF}, //Trocada por --proporcoes e --distribuicao
+};
+static const int num_cargas = sizeof(cargas_Ycsb) / sizeof(cargas_Ycsb[0]);
+
+//Operaes de uma execuo, sorteadas uma vez e usadas por todos os motores
+struct Fluxo{
+    int N;
+    std::vector<char> tipos;
+    std::vector<int> chaves;
+    std::vector<int> tamanhos; //Tamanho de cada varredura (0 nas outras operaes)
+};
+
+//Sorteia Q operaes da carga sobre as chaves 0, 2...2(N-1). As inseres usam os mpares, cada um uma vez, em ordem sorteada
+void gera_Fluxo(struct Fluxo *f, int N, int Q, const struct CargaYcsb *carga, int max_varredura, unsigned int semente){
+    struct Sorteio s;
+    inicia_Sorteio(&s, semente);
+    struct Permutacao populares, novas; //Posto na Zipf -> chave carregada; k-sima insero -> chave nova
+    inicia_Permutacao(&populares, N, proximo_Sorteio(&s));
+    inicia_Permutacao(&novas, N, proximo_Sorteio(&s));
+    struct Zipf z;
+    if(carga->distribuicao != DIST_UNIFORME)
+        inicia_Zipf(&z, N, ZIPF_THETA);
+    f->N = N;
+    f->tipos.resize(Q);
+    f->chaves.resize(Q);
+    f->tamanhos.assign(Q, 0);
+    long long inseridas = 0;
+    for(int j=0;j<Q;j++){
+        int x = (int) intervalo_Sorteio(&s, 100), tipo = 0;
+        while(x >= carga->proporcao[tipo]){
+            x -= carga->proporcao[tipo];
+            tipo++;
+        }
+        f->tipos[j] = (char) tipo;
+        if(tipo == OP_INSERCAO){
+            f->chaves[j] = (int) (2 * aplica_Permutacao(&novas, inseridas % N) + 1);
+            inseridas++;
+            continue;
+        }
+        if(carga->distribuicao == DIST_UNIFORME)
+            f->chaves[j] = (int) (2 * intervalo_Sorteio(&s, N));
+        else{
+            long long posto = (long long) sorteia_Zipf(&z, &s);
+            long long recentes = (inseridas < N) ? inseridas : N;
+            if(carga->distribuicao == DIST_RECENTE && posto < recentes) //Chave inserida posto inseres atrs
+                f->chaves[j] = (int) (2 * aplica_Permutacao(&novas, (inseridas - 1 - posto) % N) + 1);
+            else{
+                if(carga->distribuicao == DIST_RECENTE)
+                    posto -= recentes;
+                f->chaves[j] = (int) (2 * aplica_Permutacao(&populares, posto));
+            }
+        }
+        if(tipo == OP_VARREDURA)
+            f->tamanhos[j] = 1 + (int) intervalo_Sorteio(&s, max_varredura);
+    }
+}
+
+//Resultado de uma thread. Cada thread escreve s no seu, e o alinhamento evita que dois resultados dividam uma linha de cache
+struct alignas(64) ResultadoCliente{
+    long long operacoes[NUM_TIPOS];
+    long long certos[NUM_TIPOS]; //Operaes que deram certo (chave encontrada, inserida ou removida; varredura no vazia)
+    long long soma; //Soma das informaes lidas, para que as leituras no sejam descartadas pelo compilador
+    struct Histograma latencia[NUM_TIPOS]; //Em tiques
+};
+
+//Uma operao do fluxo. Com direto = 1 (uma thread) usa a rvore da nica parte sem trava
+template <class M>
+inline int passo_Ycsb(struct DicParticionado<M> *d, int direto, const struct Fluxo *f, int j, struct ResultadoCliente *r){
+    int chave = f->chaves[j];
+    typename M::Arvore *arv = d->particoes[0].arv;
+    switch(f->tipos[j]){
+    case OP_BUSCA:
+        return direto ? M::consulta(arv, chave) : consulta_DicParticionado(d, chave);
+    case OP_ATUALIZACAO:
+        return direto ? M::atualiza(arv, chave, j) : atualiza_DicParticionado(d, chave, j);
+    case OP_INSERCAO:
+        return direto ? M::insere(arv, chave, chave) : insere_DicParticionado(d, chave, chave);
+    case OP_REMOCAO:
+        return direto ? M::remove(arv, chave) : remove_DicParticionado(d, chave);
+    case OP_VARREDURA:{
+        long long soma = 0, hi = (long long) chave + 2LL * f->tamanhos[j] - 1;
+        if(hi > INT_MAX)
+            hi = INT_MAX;
+        auto leitura = [&soma](int, int info){ soma += info; };
+        long long n = direto ? M::varre(arv, chave, (int) hi, leitura) : varre_DicParticionado(d, chave, (int) hi, leitura);
+        r->soma += soma;
+        return n > 0;
+    }
+    }
+    //le_modifica: l a informao (varredura de uma chave s) e grava informao + 1, com a parte travada entre as duas
+    struct ParticaoDic<M> *p = direto ? &d->particoes[0] : &d->particoes[particao_DicParticionado(d, chave)];
+    if(!direto)
+        p->trava.lock();
+    int lido = 0;
+    int res = 0;
+    if(M::varre(p->arv, chave, chave, [&lido](int, int info){ lido = info; }) == 1)
+        res = M::atualiza(p->arv, chave, lido + 1);
+    if(!direto)
+        p->trava.unlock();
+    r->soma += lido;
+    return res;
+}
+
+//Execuo compartilhada pelas threads
+template <class M>
+struct ExecucaoYcsb{
+    struct DicParticionado<M> *d;
+    int direto;
+    const struct Fluxo *f;
+    int T;
+    int amostra; //0 = sem latncia
+    std::atomic<int> prontos; //Threads esperando a largada
+    std::atomic<int> largada;
+};
+
+//Cliente t: executa a sua fatia do fluxo
+template <class M>
+void cliente_Ycsb(struct ExecucaoYcsb<M> *ex, int t, struct ResultadoCliente *r){
+    const struct Fluxo *f = ex->f;
+    long long Q = (long long) f->tipos.size();
+    int ini = (int) (Q * t / ex->T), fim = (int) (Q * (t + 1) / ex->T);
+    ex->prontos++;
+    while(!ex->largada.load(std::memory_order_acquire))
+        std::this_thread::yield();
+    int falta = 0; //Operaes at a prxima amostra de latncia
+    for(int j=ini;j<fim;j++){
+        int tipo = f->tipos[j], res;
+        if(ex->amostra > 0 && falta == 0){
+            uint64_t t0 = le_Relogio();
+            res = passo_Ycsb<M>(ex->d, ex->direto, f, j, r);
+            registra_Histograma(&r->latencia[tipo], le_Relogio() - t0);
+            falta = ex->amostra;
+        }else
+            res = passo_Ycsb<M>(ex->d, ex->direto, f, j, r);
+        falta--;
+        r->operacoes[tipo]++;
+        r->certos[tipo] += res;
+    }
+}
+
+//Resultado de uma execuo (j somado entre as threads)
+struct MedidaYcsb{
+    double segundos;
+    long long operacoes[NUM_TIPOS];
+    long long certos[NUM_TIPOS];
+    struct Histograma latencia[NUM_TIPOS];
+    int confere;
+};
+
+//Carrega N chaves no motor M e executa o fluxo com T threads
+template <class M>
+void mede_Ycsb(const struct Fluxo *f, int T, int P, int amostra, int modo_alocacao, struct MedidaYcsb *med){
+    const int N = f->N;
+    struct ExecucaoYcsb<M> ex;
+    ex.direto = (T == 1);
+    ex.d = cria_DicParticionado<M>(ex.direto ? 1 : P, 0, 2 * N - 1, modo_alocacao);
+    ex.f = f;
+    ex.T = T;
+    ex.amostra = amostra;
+    ex.prontos = 0;
+    ex.largada = 0;
+    struct Sorteio s;
+    inicia_Sorteio(&s, (uint64_t) N * 31 + 7);
+    struct Permutacao ordem; //Carga em ordem sorteada, fora da medida
+    inicia_Permutacao(&ordem, N, proximo_Sorteio(&s));
+    for(int i=0;i<N;i++){
+        int chave = (int) (2 * aplica_Permutacao(&ordem, i));
+        insere_DicParticionado(ex.d, chave, chave);
+    }
+
+    std::vector<struct ResultadoCliente> resultados(T);
+    for(int t=0;t<T;t++)
+        memset(&resultados[t], 0, sizeof(struct ResultadoCliente)); //Zera tambm os histogramas
+    std::vector<std::thread> clientes;
+    for(int t=0;t<T;t++)
+        clientes.push_back(std::thread(cliente_Ycsb<M>, &ex, t, &resultados[t]));
+    while(ex.prontos.load() < T) //S comea a medir com todas as threads criadas
+        std::this_thread::yield();
+    Timer tmr;
+    ex.largada.store(1, std::memory_order_release);
+    for(int t=0;t<T;t++)
+        clientes[t].join();
+    med->segundos = tmr.elapsed();
+
+    for(int k=0;k<NUM_TIPOS;k++){
+        med->operacoes[k] = med->certos[k] = 0;
+        zera_Histograma(&med->latencia[k]);
+        for(int t=0;t<T;t++){
+            med->operacoes[k] += resultados[t].operacoes[k];
+            med->certos[k] += resultados[t].certos[k];
+            junta_Histograma(&med->latencia[k], &resultados[t].latencia[k]);
+        }
+    }
+    long long chaves = varre_DicParticionado(ex.d, INT_MIN, INT_MAX, [](int, int){});
+    med->confere = (chaves == (long long) N + med->certos[OP_INSERCAO] - med->certos[OP_REMOCAO]) ;
+    libera_DicParticionado(ex.d);
+}
+
+//Tabela de motores: nome na linha de comando e a funo que mede
+struct MotorYcsb{
+    const char *nome;
+    void (*mede)(const struct Fluxo *f, int T, int P, int amostra, int modo_alocacao, struct MedidaYcsb *med);
+};
+
+static const struct MotorYcsb motores_Ycsb[] = {
+    {"avl", mede_Ycsb<avl::MotorAVL>},
+    {"llrb", mede_Ycsb<llrb::MotorLLRB>},
+    {"rb", mede_Ycsb<rb::MotorRB>},
+    {"b", mede_Ycsb<arvb::MotorB>},
+    {"mapa", mede_Ycsb<MotorMapa>},
+};
+static const int num_motores = sizeof(motores_Ycsb) / sizeof(motores_Ycsb[0]);
+
+//==================Linha de comando==========================
+
+void ajuda_Ycsb(){
+    fprintf(stderr, "Uso: ycsb [--motores avl,llrb,rb,b,mapa] [--cargas a,b,c,d,e,f,personalizada] [--n 1e6,...] [--operacoes Q]\n"
+                    "           [--proporcoes busca=P,atualizacao=P,insercao=P,remocao=P,varredura=P,le_modifica=P]\n"
+                    "           [--distribuicao uniforme|zipf|recente] [--threads 1,2,...] [--particoes P] [--varredura L]\n"
+                    "           [--amostra K] [--rodadas R] [--semente S] [--alocacao arena|malloc]\n"
+                    "           [--formato csv|json] [--saida arquivo] [--rotulo texto]\n");
+}
+
+//L "busca=70,insercao=30" na carga personalizada. Retorna 0 se algum tipo  desconhecido ou se no soma 100
+int leProporcoes_Ycsb(const char *texto, struct CargaYcsb *carga){
+    std::vector<std::string> itens = separa_Lista(texto);
+    int total = 0;
+    for(int k=0;k<NUM_TIPOS;k++)
+        carga->proporcao[k] = 0;
+    for(size_t i=0;i<itens.size();i++){
+        size_t igual = itens[i].find('=');
+        if(igual == std::string::npos)
+            return 0;
+        std::string nome = itens[i].substr(0, igual);
+        int k = 0;
+        while(k < NUM_TIPOS && nome != nomes_Tipo[k])
+            k++;
+        int p = 0;
+        if(k == NUM_TIPOS || !le_Inteiro(itens[i].c_str() + igual + 1, 0, 100, &p))
+            return 0;
+        carga->proporcao[k] += p;
+        total += p;
+    }
+    return total == 100;
+}
+
+int main(int argc, char *argv[]){
+    std::vector<std::string> nomes_motores, nomes_cargas;
+    for(int m=0;m<num_motores;m++)
+        nomes_motores.push_back(motores_Ycsb[m].nome);
+    for(int c=0;c<6;c++)
+        nomes_cargas.push_back(cargas_Ycsb[c].nome);
+    std::vector<int> tamanhos(1, 1000000), threads(1, 1);
+    long long num_operacoes = 0; //0 = N
+    int num_rodadas = 1, particoes = 16, max_varredura = 100, amostra = 1;
+    unsigned int semente = 42;
+    int modo_alocacao = ALOCA_ARENA;
+    int json = 0;
+    const char *arquivo = NULL, *rotulo = "";
+    struct CargaYcsb *personalizada = &cargas_Ycsb[num_cargas - 1];
+    int escolheu_cargas = 0, mudou_personalizada = 0; //--proporcoes e --distribuicao s valem para a carga personalizada
+
+    for(int a=1;a<argc;a++){
+        std::string opcao = argv[a];
+        if(opcao == "--ajuda" || opcao == "-h"){
+            ajuda_Ycsb();
+            return 0;
+        }
+        if(a + 1 >= argc){
+            fprintf(stderr, "Falta o valor de %s\n", argv[a]);
+            ajuda_Ycsb();
+            return 1;
+        }
+        const char *valor = argv[++a];
+        int valido = 1; //0 se um valor numrico no serve (ver le_Inteiro)
+        if(opcao == "--motores")
+            nomes_motores = separa_Lista(valor);
+        else if(opcao == "--cargas"){
+            nomes_cargas = separa_Lista(valor);
+            escolheu_cargas = 1;
+        }
+        else if(opcao == "--proporcoes"){
+            if(!leProporcoes_Ycsb(valor, personalizada)){
+                fprintf(stderr, "Proporcoes invalidas (tipos: busca, atualizacao, insercao, remocao, varredura, le_modifica; soma 100): %s\n", valor);
+                return 1;
+            }
+            mudou_personalizada = 1;
+        }else if(opcao == "--distribuicao"){
+            std::string d = valor;
+            mudou_personalizada = 1;
+            if(d == "recente")
+                personalizada->distribuicao = DIST_RECENTE;
+            else if(d == "zipf" || d == "uniforme")
+                personalizada->distribuicao = distribuicao_Nome(valor);
+            else{
+                fprintf(stderr, "Distribuicao desconhecida: %s\n", valor);
+                return 1;
+            }
+        }else if(opcao == "--n" || opcao == "--threads"){
+            std::vector<int> &lista = (opcao == "--n") ? tamanhos : threads;
+            lista.clear();
+            std::vector<std::string> itens = separa_Lista(valor);
+            for(size_t i=0;i<itens.size() && valido;i++){
+                int x = 0;
+                valido = le_Inteiro(itens[i].c_str(), 1, INT_MAX, &x);
+                lista.push_back(x);
+            }
+        }else if(opcao == "--operacoes"){
+            int q = 0;
+            valido = le_Inteiro(valor, 0, INT_MAX, &q);
+            num_operacoes = q;
+        }else if(opcao == "--particoes")
+            valido = le_Inteiro(valor, 1, INT_MAX, &particoes);
+        else if(opcao == "--varredura")
+            valido = le_Inteiro(valor, 1, INT_MAX, &max_varredura);
+        else if(opcao == "--amostra")
+            valido = le_Inteiro(valor, 0, INT_MAX, &amostra);
+        else if(opcao == "--rodadas")
+            valido = le_Inteiro(valor, 1, INT_MAX, &num_rodadas);
+        else if(opcao == "--semente")
+            semente = (unsigned int) strtoul(valor, NULL, 10);
+        else if(opcao == "--alocacao")
+            modo_alocacao = (std::string(valor) == "malloc") ? ALOCA_MALLOC : ALOCA_ARENA;
+        else if(opcao == "--formato")
+            json = (std::string(valor) == "json");
+        else if(opcao == "--saida")
+            arquivo = valor;
+        else if(opcao == "--rotulo")
+            rotulo = valor;
+        else{
+            fprintf(stderr, "Opcao desconhecida: %s\n", argv[a - 1]);
+            ajuda_Ycsb();
+            return 1;
+        }
+        if(!valido){
+            fprintf(stderr, "Valor invalido para %s: %s\n", argv[a - 1], valor);
+            return 1;
+        }
+    }
+
+    //Confere os valores antes de comear a medir
+    if(mudou_personalizada){
+        if(!escolheu_cargas)
+            nomes_cargas.assign(1, personalizada->nome);
+        else if(std::find(nomes_cargas.begin(), nomes_cargas.end(), personalizada->nome) == nomes_cargas.end()){
+            fprintf(stderr, "--proporcoes e --distribuicao so valem para a carga personalizada, que nao esta em --cargas\n");
+            return 1;
+        }
+    }
+    std::vector<int> motores, cargas;
+    for(size_t i=0;i<nomes_motores.size();i++){
+        int m = 0;
+        while(m < num_motores && nomes_motores[i] != motores_Ycsb[m].nome)
+            m++;
+        if(m == num_motores){
+            fprintf(stderr, "Motor desconhecido: %s\n", nomes_motores[i].c_str());
+            return 1;
+        }
+        motores.push_back(m);
+    }
+    for(size_t i=0;i<nomes_cargas.size();i++){
+        int c = 0;
+        while(c < num_cargas && nomes_cargas[i] != cargas_Ycsb[c].nome)
+            c++;
+        if(c == num_cargas){
+            fprintf(stderr, "Carga desconhecida: %s\n", nomes_cargas[i].c_str());
+            return 1;
+        }
+        cargas.push_back(c);
+    }
+    if(max_varredura < 1 || amostra < 0 || particoes < 1 || num_operacoes < 0 || num_operacoes > INT_MAX){
+        fprintf(stderr, "Parametro invalido\n");
+        return 1;
+    }
+    for(size_t i=0;i<tamanhos.size();i++)
+        if(tamanhos[i] < 1 || tamanhos[i] > INT_MAX / 2 - max_varredura){
+            fprintf(stderr, "N invalido\n");
+            return 1;
+        }
+    for(size_t i=0;i<threads.size();i++)
+        if(threads[i] < 1){
+            fprintf(stderr, "Numero de threads invalido\n");
+            return 1;
+        }
+
+    struct Relogio relogio;
+    calibra_Relogio(&relogio);
+    FILE *saida = stdout;
+    if(arquivo != NULL && (saida = fopen(arquivo, "w")) == NULL){
+        fprintf(stderr, "Nao consegui abrir %s\n", arquivo);
+        return 1;
+    }
+    if(json)
+        fprintf(saida, "[\n");
+    else
+        fprintf(saida, "rotulo,motor,carga,threads,n,rodada,semente,alocacao,tipo,operacoes,certos,segundos,mops_por_s,"
+                       "amostras,p50_ns,p99_ns,p999_ns,max_ns,confere\n");
+
+    int erro = 0, primeiro = 1;
+    struct Fluxo fluxo;
+    struct MedidaYcsb *med = new struct MedidaYcsb;
+    struct Histograma *total = new struct Histograma;
+    for(size_t n=0;n<tamanhos.size();n++){
+        int N = tamanhos[n];
+        int Q = (num_operacoes > 0) ? (int) num_operacoes : N;
+        for(size_t c=0;c<cargas.size();c++){
+            const struct CargaYcsb *carga = &cargas_Ycsb[cargas[c]];
+            for(int r=0;r<num_rodadas;r++){
+                gera_Fluxo(&fluxo, N, Q, carga, max_varredura, semente + r);
+                for(size_t m=0;m<motores.size();m++){
+                    for(size_t t=0;t<threads.size();t++){
+                        motores_Ycsb[motores[m]].mede(&fluxo, threads[t], particoes, amostra, modo_alocacao, med);
+                        const char *nome = motores_Ycsb[motores[m]].nome;
+                        const char *alocacao = (modo_alocacao == ALOCA_ARENA) ? "arena" : "malloc";
+                        long long ops_total = 0, certos_total = 0;
+                        zera_Histograma(total);
+                        for(int k=0;k<NUM_TIPOS;k++){
+                            ops_total += med->operacoes[k];
+                            certos_total += med->certos[k];
+                            junta_Histograma(total, &med->latencia[k]);
+                        }
+                        //Uma linha por tipo que apareceu no fluxo e a linha "total" (k = NUM_TIPOS)
+                        for(int k=0;k<=NUM_TIPOS;k++){
+                            long long ops = (k < NUM_TIPOS) ? med->operacoes[k] : ops_total;
+                            long long certos = (k < NUM_TIPOS) ? med->certos[k] : certos_total;
+                            const struct Histograma *h = (k < NUM_TIPOS) ? &med->latencia[k] : total;
+                            if(ops == 0)
+                                continue;
+                            const char *tipo = (k < NUM_TIPOS) ? nomes_Tipo[k] : "total";
+                            double mops = ops / med->segundos / 1e6;
+                            char colunas[160];
+                            if(amostra > 0)
+                                snprintf(colunas, sizeof(colunas), json ? "\"amostras\": %llu, \"p50_ns\": %.6g, \"p99_ns\": %.6g, \"p999_ns\": %.6g, \"max_ns\": %.6g"
+                                                                        : "%llu,%.6g,%.6g,%.6g,%.6g",
+                                         (unsigned long long) h->total, nanos_Relogio(&relogio, percentil_Histograma(h, 0.5)),
+                                         nanos_Relogio(&relogio, percentil_Histograma(h, 0.99)), nanos_Relogio(&relogio, percentil_Histograma(h, 0.999)),
+                                         nanos_Relogio(&relogio, h->maximo));
+                            else
+                                snprintf(colunas, sizeof(colunas), "%s", json ? "\"amostras\": null, \"p50_ns\": null, \"p99_ns\": null, \"p999_ns\": null, \"max_ns\": null"
+                                                                              : ",,,,");
+                            if(json){
+                                fprintf(saida, "%s  {\"rotulo\": ", primeiro ? "" : ",\n");
+                                escreveTexto_JSON(saida, rotulo);
+                                fprintf(saida, ", \"motor\": \"%s\", \"carga\": \"%s\", \"threads\": %d, \"n\": %d, \"rodada\": %d, \"semente\": %u, \"alocacao\": \"%s\", "
+                                               "\"tipo\": \"%s\", \"operacoes\": %lld, \"certos\": %lld, \"segundos\": %.9g, \"mops_por_s\": %.6g, %s, \"confere\": %d}",
+                                        nome, carga->nome, threads[t], N, r, semente + r, alocacao, tipo, ops, certos, med->segundos, mops, colunas, med->confere);
+                            }else
+                                fprintf(saida, "%s,%s,%s,%d,%d,%d,%u,%s,%s,%lld,%lld,%.9g,%.6g,%s,%d\n", rotulo, nome, carga->nome, threads[t], N, r,
+                                        semente + r, alocacao, tipo, ops, certos, med->segundos, mops, colunas, med->confere);
+                            primeiro = 0;
+                        }
+                        fflush(saida); //Uma varredura longa interrompida mantm o que j foi medido
+                        if(!med->confere)
+                            erro = 1;
+                        std::cerr << nome << " carga " << carga->nome << " " << threads[t] << " thread(s) N = " << N << " rodada " << r << ": "
+                                  << ops_total / med->segundos / 1e6 << " Mops/s";
+                        if(amostra > 0)
+                            std::cerr << " (p99 " << nanos_Relogio(&relogio, percentil_Histograma(total, 0.99)) << " ns)";
+                        std::cerr << std::endl;
+                    }
+                }
+            }
+        }
+    }
+    delete med;
+    delete total;
+    if(json)
+        fprintf(saida, "%s]\n", primeiro ? "" : "\n");
+    if(saida != stdout)
+        fclose(saida);
+
+    if(erro)
+        std::cerr << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return erro;
+}
@@ -0,0 +1,130 @@
+#ifndef ALOCADOR_H
+#define ALOCADOR_H
+
+#include <cstdlib>
+#include <cstddef>
+
+//Alocador de ns usado pelas rvores (AVL e LLRB)
+//Pode trabalhar de dois modos, escolhidos na criao da rvore:
+//- ALOCA_MALLOC: um malloc/free para cada n, exatamente como era feito antes
+//- ALOCA_ARENA: os ns so retirados de blocos grandes e contguos (arena/slab). Alocar um n  s avanar um ponteiro,
+//  os ns removidos vo para uma lista de livres e so reaproveitados, e liberar a rvore inteira  liberar os blocos, sem percorrer os ns
+//Com 15.000.000 de ns isso evita milhes de chamadas ao malloc/free e deixa os ns vizinhos prximos na memria
+
+//Modos de alocao
+#define ALOCA_MALLOC 0
+#define ALOCA_ARENA 1
+
+//Quantidade de ns em cada bloco da arena
+#define NOS_POR_BLOCO 65536
+
+//Cabealho de cada bloco da arena. Os ns vm logo em seguida na memria
+//O alinhamento garante que o primeiro n fique alinhado para qualquer tipo
+struct alignas(alignof(std::max_align_t)) BlocoArena{
+    struct BlocoArena *anterior; //Blocos formam uma lista encadeada para a liberao em bloco
+};
+
+template <class T>
+struct Alocador{
+    int modo; //ALOCA_MALLOC ou ALOCA_ARENA
+    struct BlocoArena *blocos; //ltimo bloco alocado
+    T *proximo; //Prximo n ainda no usado do bloco atual
+    T *fim; //Fim do bloco atual
+    void *livres; //Lista de ns devolvidos. O prprio n guarda o ponteiro para o prximo livre
+    size_t memoria; //Bytes alocados pela arena (usado para calcular bytes por n nos testes)
+};
+
+//Inicializa o alocador no modo escolhido
+template <class T>
+void inicia_Alocador(Alocador<T> *a, int modo){
+    static_assert(sizeof(T) >= sizeof(void*), "O no precisa comportar o ponteiro da lista de livres");
+    a->modo = modo;
+    a->blocos = NULL;
+    a->proximo = NULL;
+    a->fim = NULL;
+    a->livres = NULL;
+    a->memoria = 0;
+}
+
+//Aloca um bloco novo para a arena
+//Ns com alinhamento maior que o do malloc (por exemplo, alinhados  linha de cache) usam aligned_alloc,
+//e o cabealho do bloco ocupa um alinhamento inteiro para que o primeiro n continue alinhado
+template <class T>
+int novoBloco_Alocador(Alocador<T> *a, size_t quant){
+    size_t cab = alignof(T) > sizeof(struct BlocoArena) ? alignof(T) : sizeof(struct BlocoArena); //Espao do cabealho
+    struct BlocoArena *b;
+    if(alignof(T) > alignof(std::max_align_t))
+        b = (struct BlocoArena*) aligned_alloc(alignof(T), cab + quant * sizeof(T));
+    else
+        b = (struct BlocoArena*) malloc(cab + quant * sizeof(T));
+    if(b == NULL)
+        return 0; //Alocao de memria falhou
+    b->anterior = a->blocos;
+    a->blocos = b;
+    a->proximo = (T*)((char*) b + cab); //Os ns comeam logo depois do cabealho
+    a->fim = a->proximo + quant;
+    a->memoria += cab + quant * sizeof(T);
+    return 1;
+}
+
+//Retorna a memria para um n, ou NULL se a alocao falhou
+//Na arena, primeiro reaproveita um n da lista de livres, depois avana no bloco atual
+template <class T>
+T* aloca_NO(Alocador<T> *a){
+    if(a->modo == ALOCA_MALLOC){
+        if(alignof(T) > alignof(std::max_align_t))
+            return (T*) aligned_alloc(alignof(T), sizeof(T)); //sizeof(T) j  mltiplo do alinhamento
+        return (T*) malloc(sizeof(T));
+    }
+
+    if(a->livres != NULL){ //Reaproveita um n removido
+        T *no = (T*) a->livres;
+        a->livres = *(void**) a->livres;
+        return no;
+    }
+    if(a->proximo == a->fim) //Bloco atual acabou
+        if(!novoBloco_Alocador(a, NOS_POR_BLOCO))
+            return NULL;
+    return a->proximo++;
+}
+
+//Retorna n ns contguos da arena, usados na construo da rvore a partir de um vetor ordenado
+//Se no houver espao no bloco atual, aloca um bloco do tamanho necessrio
+//Retorna NULL no modo ALOCA_MALLOC (cada n precisa ser liberado separadamente) ou se a alocao falhou
+template <class T>
+T* alocaContiguo_Alocador(Alocador<T> *a, size_t n){
+    if(a->modo != ALOCA_ARENA)
+        return NULL;
+    if((size_t)(a->fim - a->proximo) < n)
+        if(!novoBloco_Alocador(a, n > NOS_POR_BLOCO ? n : NOS_POR_BLOCO))
+            return NULL;
+    T *nos = a->proximo;
+    a->proximo += n;
+    return nos;
+}
+
+//Devolve um n ao alocador. Na arena o n vai para a lista de livres e s  liberado junto com os blocos
+template <class T>
+void desaloca_NO(Alocador<T> *a, T *no){
+    if(a->modo == ALOCA_MALLOC){
+        free(no);
+        return;
+    }
+    *(void**) no = a->livres;
+    a->livres = no;
+}
+
+//Libera todos os blocos da arena de uma vez. O(nmero de blocos), sem visitar os ns
+//No modo ALOCA_MALLOC no h nada para fazer: os ns so liberados um a um pela rvore
+template <class T>
+void libera_Alocador(Alocador<T> *a){
+    struct BlocoArena *b = a->blocos;
+    while(b != NULL){
+        struct BlocoArena *ant = b->anterior;
+        free(b);
+        b = ant;
+    }
+    inicia_Alocador(a, a->modo);
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef ARVORECONGELADA_H
+#define ARVORECONGELADA_H
+
+#include <cstdlib>
+
+//Cpia somente leitura de uma rvore (AVL, LLRB ou Rubro-Negra), para os perodos em que quase s h buscas
+//Os elementos ficam em um vetor na ordem de Eytzinger (a ordem de uma busca em largura): a raiz na posio 1
+//e os filhos da posio k nas posies 2k e 2k+1. No h ponteiros: descer um nvel  s calcular o ndice
+//A busca no tem desvio condicional dentro do lao (k = 2k + (chave < valor)) e, como os netos dos netos
+//de k esto juntos nas posies 16k..16k+15, d para pedir com prefetch o bloco de 64 bytes de 4 nveis abaixo
+//A cpia no acompanha alteraes feitas na rvore depois de congelada:  preciso congelar de novo
+
+#define LINHA_CACHE 64
+
+struct ArvCongelada{
+    int *chaves; //Chaves na ordem de Eytzinger. Posio 0 no  usada
+    int *infos; //Informao de cada chave, na mesma posio
+    int n; //Quantidade de elementos
+};
+
+//Vetor alinhado  linha de cache, para que o bloco 16k..16k+15 seja uma linha s
+int* alocaVetor_ArvCongelada(int n){
+    size_t bytes = (size_t)(n + 1) * sizeof(int);
+    bytes = (bytes + LINHA_CACHE - 1) / LINHA_CACHE * LINHA_CACHE; //aligned_alloc exige mltiplo do alinhamento
+    return (int*) aligned_alloc(LINHA_CACHE, bytes);
+}
+
+//Conta os ns da rvore
+template <class T>
+int total_NO(T *no){
+    if(no == NULL)
+        return 0;
+    return total_NO(no->esq) + total_NO(no->dir) + 1;
+}
+
+//Percorre a rvore em ordem e coloca cada elemento na prxima posio de Eytzinger em ordem crescente
+//*k  a posio do elemento anterior (0 antes do primeiro)
+template <class T>
+void congela_NO(T *no, struct ArvCongelada *c, int *k){
+    if(no == NULL)
+        return;
+    congela_NO(no->esq, c, k);
+    int p = *k;
+    if(p == 0 || 2 * p + 1 <= c->n){ //Primeiro elemento ou tem filho direito: desce para a direita e depois tudo para a esquerda
+        p = (p == 0) ? 1 : 2 * p + 1;
+        while(2 * p <= c->n)
+            p = 2 * p;
+    }else
+        p >>= __builtin_ffs(~p); //Sobe enquanto for filho direito e mais uma vez
+    c->chaves[p] = no->chave;
+    c->infos[p] = no->info;
+    *k = p;
+    congela_NO(no->dir, c, k);
+}
+
+//Cria a cpia congelada a partir da raiz. O(N). Retorna NULL se faltou memria
+template <class T>
+struct ArvCongelada* congela_Arvore(T *raiz){
+    struct ArvCongelada *c = (struct ArvCongelada*) malloc(sizeof(struct ArvCongelada));
+    if(c == NULL)
+        return NULL;
+    c->n = total_NO(raiz);
+    c->chaves = alocaVetor_ArvCongelada(c->n);
+    c->infos = alocaVetor_ArvCongelada(c->n);
+    if(c->chaves == NULL || c->infos == NULL){ //Alocao de memria falhou
+        free(c->chaves);
+        free(c->infos);
+        free(c);
+        return NULL;
+    }
+    c->chaves[0] = 0;
+    c->infos[0] = 0;
+    int k = 0;
+    congela_NO(raiz, c, &k);
+    return c;
+}
+
+//Busca sem desvio condicional no lao: ao sair, k passou das folhas e os bits de k guardam o caminho
+//(1 = foi para a direita). Tirando os 1 do final e mais um bit, chegamos no ltimo n em que fomos para a esquerda,
+//que  o menor elemento >= valor (ou 0 se no existe)
+//Retorna 1 se encontrou (e coloca a informao em *info, se info != NULL) ou 0 caso contrrio
+int consulta_ArvCongelada(struct ArvCongelada *c, int valor, int *info = NULL){
+    if(c == NULL)
+        return 0;
+    const int *chaves = c->chaves;
+    int n = c->n;
+    int k = 1;
+    while(k <= n){
+        __builtin_prefetch(chaves + 16 * (size_t)k); //Bloco dos descendentes 4 nveis abaixo. Prefetch fora do vetor no causa erro
+        k = 2 * k + (chaves[k] < valor);
+    }
+    k >>= __builtin_ffs(~k);
+    if(k == 0 || chaves[k] != valor)
+        return 0; //No encontrou
+    if(info != NULL)
+        *info = c->infos[k];
+    return 1; //Encontrou
+}
+
+//Memria usada pela cpia (para calcular bytes por elemento nos testes)
+size_t memoria_ArvCongelada(struct ArvCongelada *c){
+    if(c == NULL)
+        return 0;
+    return sizeof(struct ArvCongelada) + 2 * (size_t)(c->n + 1) * sizeof(int);
+}
+
+void libera_ArvCongelada(struct ArvCongelada *c){
+    if(c == NULL)
+        return;
+    free(c->chaves);
+    free(c->infos);
+    free(c);
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef CHAVE_H
+#define CHAVE_H
+
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+//Comparao de chaves das rvores genricas (AVL/ArvoreAVLGenerica.h e LLRB/ArvoreLLRBGenerica.h)
+//Compara  um objeto de funo no estilo de std::less: comp(a, b) diz se a vem antes de b
+//As rvores s usam compara_Chave, que devolve <0, 0 ou >0 (como o memcmp). Na verso geral isso custa at duas
+//chamadas de comp. Os tipos mais usados tm verses prprias:
+//- Chaves inteiras com std::less: == e < direto, o mesmo cdigo das rvores com int
+//- ChaveFixa com ComparaChaveFixa: um nico memcmp
+
+//Inteiro comparado com std::less (ou std::less<>)
+template <class Chave, class Compara>
+struct ChaveInteira{
+    static const bool valor = std::is_integral<Chave>::value &&
+        (std::is_same<Compara, std::less<Chave> >::value || std::is_same<Compara, std::less<> >::value);
+};
+
+//Retorna <0 se a vem antes de b, 0 se so iguais ou >0 se a vem depois de b
+template <class Chave, class Compara>
+inline int compara_Chave(const Compara& comp, const Chave& a, const Chave& b){
+    if constexpr (ChaveInteira<Chave, Compara>::valor){
+        if(a == b)
+            return 0;
+        return a < b ? -1 : 1;
+    }else{
+        if(comp(a, b))
+            return -1;
+        if(comp(b, a))
+            return 1;
+        return 0;
+    }
+}
+
+//Chave de tamanho fixo em bytes (um hash, um identificador de 16 bytes...), ordenada como no memcmp
+template <int TAM>
+struct ChaveFixa{
+    unsigned char bytes[TAM];
+};
+
+template <int TAM>
+struct ComparaChaveFixa{
+    bool operator()(const ChaveFixa<TAM>& a, const ChaveFixa<TAM>& b) const{
+        return memcmp(a.bytes, b.bytes, TAM) < 0;
+    }
+};
+
+template <int TAM>
+inline int compara_Chave(const ComparaChaveFixa<TAM>&, const ChaveFixa<TAM>& a, const ChaveFixa<TAM>& b){
+    return memcmp(a.bytes, b.bytes, TAM);
+}
+
+#endif
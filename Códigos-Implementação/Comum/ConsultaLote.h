@@ -0,0 +1,53 @@
+#ifndef CONSULTALOTE_H
+#define CONSULTALOTE_H
+
+//Consulta em lote, compartilhada pelas rvores com ponteiros (AVL, LLRB e Rubro-Negra)
+//Em uma rvore grande quase todo nvel da busca  uma falta de cache: a busca fica parada esperando a memria
+//Como as buscas de um lote so independentes, avanamos vrias ao mesmo tempo, um nvel de cada vez (AMAC):
+//ao descer um nvel, pedimos o prximo n com __builtin_prefetch e passamos para a prxima busca do grupo.
+//Quando voltamos a ela, o n j est (ou est quase) no cache
+//Se uma busca termina, o lugar dela no grupo  ocupado pela prxima chave do lote
+
+//Quantidade de buscas avanando ao mesmo tempo. Deve cobrir a latncia da memria sem estourar os buffers de falta de cache
+#define GRUPO_CONSULTA 16
+
+//T  o n da rvore: precisa dos campos chave, esq e dir
+//resultados[i] recebe 1 se valores[i] est na rvore ou 0 caso contrrio
+//Retorna quantas chaves foram encontradas
+template <class T>
+int consultaLote_NO(T *raiz, const int valores[], int n, int resultados[]){
+    T *atual[GRUPO_CONSULTA]; //N em que cada busca do grupo est
+    int indice[GRUPO_CONSULTA]; //Posio no lote da chave de cada busca
+    int proximo = 0, ativos = 0, encontrados = 0;
+    while(ativos < GRUPO_CONSULTA && proximo < n){ //Comea as primeiras buscas pela raiz
+        atual[ativos] = raiz;
+        indice[ativos++] = proximo++;
+    }
+    while(ativos > 0){
+        for(int s = 0; s < ativos; ){
+            T *no = atual[s];
+            int valor = valores[indice[s]];
+            if(no == NULL || no->chave == valor){ //Busca terminou
+                resultados[indice[s]] = (no != NULL);
+                encontrados += (no != NULL);
+                if(proximo < n){ //Reaproveita o lugar com a prxima chave do lote
+                    atual[s] = raiz;
+                    indice[s] = proximo++;
+                    s++;
+                }else{ //Lote acabou: traz a ltima busca ativa para esse lugar
+                    ativos--;
+                    atual[s] = atual[ativos];
+                    indice[s] = indice[ativos];
+                }
+                continue;
+            }
+            no = (valor > no->chave) ? no->dir : no->esq; //Desce um nvel
+            __builtin_prefetch(no); //Pede o n agora e s olha para ele na prxima volta
+            atual[s] = no;
+            s++;
+        }
+    }
+    return encontrados;
+}
+
+#endif
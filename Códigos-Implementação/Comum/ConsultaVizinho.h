@@ -0,0 +1,61 @@
+#ifndef CONSULTAVIZINHO_H
+#define CONSULTAVIZINHO_H
+
+#include <cstddef>
+
+//Consultas pela chave mais prxima, compartilhadas pelas rvores com ponteiros (AVL, LLRB e Rubro-Negra)
+//Todas descem uma vez da raiz at uma folha, lembrando o ltimo n que serviu como resposta: O(log N)
+//Como em uma rvore de busca a resposta est sempre no caminho da busca, no  preciso voltar nem percorrer em ordem
+//No lao, o filho  escolhido por uma comparao s (no = cond ? no->esq : no->dir), que o compilador costuma fazer sem desvio
+
+//T  o n da rvore: precisa dos campos chave, esq e dir
+//Menor n com chave >= valor (inclusivo = 1) ou com chave > valor (inclusivo = 0). NULL se no existe
+template <class T>
+T* primeiroMaior_NO(T *no, int valor, int inclusivo){
+    T *resp = NULL;
+    while(no != NULL){
+        if(inclusivo && no->chave == valor) //No existe chave mais prxima que a prpria
+            return no;
+        int maior = no->chave > valor;
+        resp = maior ? no : resp;
+        no = maior ? no->esq : no->dir;
+    }
+    return resp;
+}
+
+//Maior n com chave <= valor (inclusivo = 1) ou com chave < valor (inclusivo = 0). NULL se no existe
+template <class T>
+T* ultimoMenor_NO(T *no, int valor, int inclusivo){
+    T *resp = NULL;
+    while(no != NULL){
+        if(inclusivo && no->chave == valor)
+            return no;
+        int menor = no->chave < valor;
+        resp = menor ? no : resp;
+        no = menor ? no->dir : no->esq;
+    }
+    return resp;
+}
+
+//N com chave igual a valor. NULL se no existe
+template <class T>
+T* busca_NO(T *no, int valor){
+    while(no != NULL && no->chave != valor)
+        no = (valor < no->chave) ? no->esq : no->dir;
+    return no;
+}
+
+//Copia a chave e a informao do n encontrado. chave e info podem ser NULL
+//Retorna 1 se havia resposta ou 0 caso contrrio (nesse caso chave e info no so alterados)
+template <class T>
+int resposta_NO(T *no, int *chave, int *info){
+    if(no == NULL)
+        return 0;
+    if(chave != NULL)
+        *chave = no->chave;
+    if(info != NULL)
+        *info = no->info;
+    return 1;
+}
+
+#endif
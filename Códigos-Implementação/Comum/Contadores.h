@@ -0,0 +1,139 @@
+#ifndef CONTADORES_H
+#define CONTADORES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//Contadores de hardware (perf_event_open do Linux) para os testes (Benchmark/Benchmark.cpp)
+//O tempo diz qual rvore ganha do std::map, mas no por qu. Com os contadores abertos em volta do trecho medido d para ver
+//por operao as falhas de cache e de TLB (o custo de seguir ponteiros para ns espalhados), os desvios errados (comparaes
+//imprevisveis na descida) e as instrues (o trabalho de balanceamento)
+//S conta o prprio processo em modo usurio (exclude_kernel), o que o perf_event_paranoid padro (2) permite sem root
+//Cada contador  aberto sozinho: o que o kernel ou a mquina no tiver (mquina virtual sem PMU, paranoid 3, outro sistema)
+//fica indisponvel e os outros continuam. Se o kernel revezar os contadores (mais eventos que registradores), o valor 
+//corrigido pela frao do tempo em que cada um esteve ativo durante o trecho. O RESET s zera a contagem, no os tempos, que
+//se acumulam desde a abertura: por isso os tempos so lidos no incio de cada trecho e a correo usa as diferenas
+
+#define CONT_CICLOS 0
+#define CONT_INSTRUCOES 1
+#define CONT_DESVIOS_ERRADOS 2
+#define CONT_FALHAS_CACHE 3 //ltimo nvel de cache
+#define CONT_FALHAS_L1D 4 //Leituras que falham no cache L1 de dados
+#define CONT_FALHAS_TLB 5 //Leituras que falham no TLB de dados
+#define CONT_FALHAS_PAGINA 6 //Evento de software: funciona mesmo sem PMU
+#define NUM_CONTADORES 7
+
+static const char *nomes_Contador[NUM_CONTADORES] = {"ciclos", "instrucoes", "desvios_errados", "falhas_cache", "falhas_l1d", "falhas_tlb", "falhas_pagina"};
+
+struct Contadores{
+    int fd[NUM_CONTADORES]; //-1 se o contador no est disponvel
+    uint64_t valor[NUM_CONTADORES]; //Contagem do ltimo trecho (entre inicia_Contadores e para_Contadores)
+    uint64_t ligado[NUM_CONTADORES], contando[NUM_CONTADORES]; //Tempos acumulados lidos no incio do trecho
+};
+
+#ifdef __linux__
+//Tipo e configurao do perf_event de cada contador
+static inline void evento_Contador(int i, struct perf_event_attr *attr){
+    const uint64_t leitura_falha = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    switch(i){
+    case CONT_CICLOS: attr->type = PERF_TYPE_HARDWARE; attr->config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case CONT_INSTRUCOES: attr->type = PERF_TYPE_HARDWARE; attr->config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case CONT_DESVIOS_ERRADOS: attr->type = PERF_TYPE_HARDWARE; attr->config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    case CONT_FALHAS_CACHE: attr->type = PERF_TYPE_HARDWARE; attr->config = PERF_COUNT_HW_CACHE_MISSES; break;
+    case CONT_FALHAS_L1D: attr->type = PERF_TYPE_HW_CACHE; attr->config = PERF_COUNT_HW_CACHE_L1D | leitura_falha; break;
+    case CONT_FALHAS_TLB: attr->type = PERF_TYPE_HW_CACHE; attr->config = PERF_COUNT_HW_CACHE_DTLB | leitura_falha; break;
+    default: attr->type = PERF_TYPE_SOFTWARE; attr->config = PERF_COUNT_SW_PAGE_FAULTS; break;
+    }
+}
+
+//L o valor, o tempo ligado e o tempo em que o contador esteve de fato contando (acumulados desde a abertura)
+static inline int le_Contador(int fd, uint64_t leitura[3]){
+    return read(fd, leitura, 3 * sizeof(uint64_t)) == (ssize_t) (3 * sizeof(uint64_t));
+}
+#endif
+
+//Abre os contadores (parados). Retorna quantos ficaram disponveis
+static inline int abre_Contadores(struct Contadores *c){
+    int abertos = 0;
+    for(int i=0;i<NUM_CONTADORES;i++){
+        c->fd[i] = -1;
+        c->valor[i] = c->ligado[i] = c->contando[i] = 0;
+#ifdef __linux__
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        evento_Contador(i, &attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        c->fd[i] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0); //Este processo, qualquer CPU
+        if(c->fd[i] >= 0)
+            abertos++;
+#endif
+    }
+    return abertos;
+}
+
+static inline int disponivel_Contador(const struct Contadores *c, int i){
+    return c->fd[i] >= 0;
+}
+
+//Zera e liga os contadores. Aceita NULL (contadores desligados), assim como para_Contadores
+static inline void inicia_Contadores(struct Contadores *c){
+#ifdef __linux__
+    if(c == NULL)
+        return;
+    for(int i=0;i<NUM_CONTADORES;i++)
+        if(c->fd[i] >= 0){
+            uint64_t leitura[3];
+            if(le_Contador(c->fd[i], leitura)){
+                c->ligado[i] = leitura[1];
+                c->contando[i] = leitura[2];
+            }
+            ioctl(c->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(c->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+}
+
+//Desliga os contadores e guarda em valor a contagem desde inicia_Contadores
+static inline void para_Contadores(struct Contadores *c){
+#ifdef __linux__
+    if(c == NULL)
+        return;
+    for(int i=0;i<NUM_CONTADORES;i++)
+        if(c->fd[i] >= 0)
+            ioctl(c->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    for(int i=0;i<NUM_CONTADORES;i++){
+        c->valor[i] = 0;
+        uint64_t leitura[3];
+        if(c->fd[i] < 0 || !le_Contador(c->fd[i], leitura))
+            continue;
+        uint64_t ligado = leitura[1] - c->ligado[i], contando = leitura[2] - c->contando[i]; //S deste trecho
+        if(contando > 0 && contando < ligado)
+            c->valor[i] = (uint64_t) ((double) leitura[0] * ligado / contando); //Revezado com outros eventos: estima
+        else
+            c->valor[i] = leitura[0];
+    }
+#endif
+}
+
+static inline void fecha_Contadores(struct Contadores *c){
+#ifdef __linux__
+    for(int i=0;i<NUM_CONTADORES;i++)
+        if(c->fd[i] >= 0)
+            close(c->fd[i]);
+#endif
+    for(int i=0;i<NUM_CONTADORES;i++)
+        c->fd[i] = -1;
+}
+
+#endif
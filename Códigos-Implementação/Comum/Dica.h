@@ -0,0 +1,69 @@
+#ifndef DICA_H
+#define DICA_H
+
+#include <cstddef>
+#include <climits>
+
+//Dica de insero, compartilhada pela AVL e pela LLRB (como o emplace_hint do std::map)
+//Quando as chaves chegam em ordem crescente (horrios, nmeros de sequncia) ou quase, cada chave nova cai ao lado da anterior,
+//mas insere_* sempre desce a partir da raiz. A dica guarda o caminho da ltima insero: para cada nvel, o endereo do
+//ponteiro que leva ao n (como a pilha de insereIterativo_ArvAVL) e o intervalo (lo, hi) de chaves que cabem naquela subrvore
+//Para inserir, subimos pelo caminho s at a primeira subrvore em que a chave cabe e descemos dali
+//Com chaves em ordem crescente a chave cabe logo no ltimo n, ento a busca custa O(1) amortizado, mais o rebalanceamento
+//A dica s vale enquanto a rvore for alterada apenas pelas inseres com essa dica. Depois de qualquer outra alterao
+//(insere_*, remove_*, carregaOrdenado_*)  preciso chamar inicia_Dica de novo
+
+//Caminho mais longo: 64 ns (altura da LLRB para N < 2^32) mais o ponteiro NULL onde entra o novo n
+#define ALTURA_MAX_DICA 65
+
+//T  o n da rvore: precisa dos campos chave, esq e dir
+template <class T>
+struct Dica{
+    T **caminho[ALTURA_MAX_DICA]; //caminho[0] aponta para a raiz e caminho[i+1] para um dos filhos de *caminho[i]
+    long long lo[ALTURA_MAX_DICA], hi[ALTURA_MAX_DICA]; //As chaves da subrvore *caminho[i] esto entre lo[i] e hi[i] (exclusive)
+    int topo; //Quantidade de nveis guardados (a raiz sempre fica)
+};
+
+//Comea a dica pela raiz, que aceita qualquer chave
+template <class T>
+void inicia_Dica(struct Dica<T> *d, T **raiz){
+    d->caminho[0] = raiz;
+    d->lo[0] = LLONG_MIN;
+    d->hi[0] = LLONG_MAX;
+    d->topo = 1;
+}
+
+//Sobe pelo caminho at a primeira subrvore em que a chave cabe
+template <class T>
+void sobe_Dica(struct Dica<T> *d, int chave){
+    while(d->topo > 1 && (chave <= d->lo[d->topo - 1] || chave >= d->hi[d->topo - 1]))
+        d->topo--;
+}
+
+//Desce do ltimo nvel at a posio da chave, guardando o caminho
+//Retorna o endereo do ponteiro NULL em que o novo n deve entrar (o ltimo nvel da dica) ou NULL se a chave j est na rvore
+template <class T>
+T** desce_Dica(struct Dica<T> *d, int chave){
+    int t = d->topo - 1;
+    T **p = d->caminho[t];
+    long long lo = d->lo[t], hi = d->hi[t];
+    while(*p != NULL){
+        T *no = *p;
+        if(chave == no->chave)
+            return NULL; //Valor j encontra-se na rvore
+        if(chave < no->chave){
+            hi = no->chave;
+            p = &(no->esq);
+        }else{
+            lo = no->chave;
+            p = &(no->dir);
+        }
+        d->caminho[d->topo] = p;
+        d->lo[d->topo] = lo;
+        d->hi[d->topo] = hi;
+        d->topo++;
+    }
+    return p;
+}
+
+#endif
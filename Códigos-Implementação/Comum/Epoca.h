@@ -0,0 +1,326 @@
+#ifndef EPOCA_H
+#define EPOCA_H
+
+#include <cstdlib>
+#include <cstring>
+#include "Alocador.h"
+
+//Recuperao de memria por pocas, para as rvores com um escritor e vrios leitores sem trava
+//(AVL/ArvoreAVLConcorrente.h e LLRB/ArvoreLLRBConcorrente.h)
+//
+//O escritor nunca altera um n que os leitores podem estar vendo: ele copia os ns do caminho que vai mudar
+//(e os que as rotaes e trocas de cor alteram), monta a nova verso da rvore ao lado e publica a nova raiz de uma vez.
+//Os ns substitudos no podem ir para o free() na hora, porque um leitor que pegou a raiz antiga ainda pode estar neles
+//
+//pocas: existe um contador global. Cada leitor, ao comear uma busca, anota a poca global no seu lugar e, ao terminar,
+//marca o lugar como inativo. Um n substitudo  guardado com a poca em que saiu da rvore (depois de publicada a nova raiz).
+//Todo leitor que comea depois disso anota uma poca maior e s enxerga a rvore nova, ento quando todos os leitores
+//ativos tm poca maior que a do n, ningum mais pode chegar nele e ele volta para o alocador
+//
+//Todos os acessos compartilhados usam as funes __atomic do g++ com ordem sequencial, assim os ns e a raiz
+//continuam sendo ponteiros comuns
+
+#define MAX_LEITORES 128 //Quantidade mxima de threads leitoras
+#define EPOCA_INATIVA (~0ULL) //poca de um leitor que no est no meio de uma busca
+#define LIMITE_APOSENTADOS 1024 //Tenta devolver os ns ao alocador quando houver pelo menos essa quantidade esperando
+
+//Cada leitor escreve s no seu lugar, e cada lugar ocupa uma linha de cache, para que os leitores no disputem a mesma linha
+struct alignas(64) LeitorEpoca{
+    unsigned long long epoca; //poca em que a busca atual comeou, ou EPOCA_INATIVA
+};
+
+//N que saiu da rvore e espera os leitores antigos terminarem
+template <class T>
+struct NoAposentado{
+    T *no;
+    unsigned long long epoca; //poca global quando o n saiu da rvore
+};
+
+//T  o n da rvore: precisa dos campos esq, dir e versao
+template <class T>
+struct Epoca{
+    struct LeitorEpoca leitores[MAX_LEITORES];
+    unsigned long long global; //poca atual
+    int num_leitores; //Lugares de leitores j entregues
+    Alocador<T> *aloc; //Alocador dos ns da rvore (s o escritor usa)
+    //Ns esperando para voltar ao alocador
+    struct NoAposentado<T> *aposentados;
+    int quantAposentados, capAposentados;
+    //Atualizao em andamento (s o escritor usa)
+    unsigned int versao; //Ns com essa verso foram criados na atualizao atual e ainda no so vistos pelos leitores
+    T **novos; //Ns criados na atualizao atual (liberados se ela for cancelada)
+    int quantNovos, capNovos;
+    T **trocados; //Ns que saem da rvore se a atualizao for confirmada
+    int quantTrocados, capTrocados;
+    int falhou; //1 se faltou memria na atualizao atual
+    T lixo; //Devolvido quando falta memria, para que o escritor nunca altere um n publicado
+};
+
+//Inicializa a estrutura. Retorna 0 se faltou memria
+template <class T>
+int inicia_Epoca(struct Epoca<T> *e, Alocador<T> *aloc){
+    for(int i = 0; i < MAX_LEITORES; i++)
+        e->leitores[i].epoca = EPOCA_INATIVA;
+    e->global = 1;
+    e->num_leitores = 0;
+    e->aloc = aloc;
+    e->quantAposentados = e->quantNovos = e->quantTrocados = 0;
+    e->capAposentados = 2 * LIMITE_APOSENTADOS;
+    e->capNovos = e->capTrocados = 256;
+    e->aposentados = (struct NoAposentado<T>*) malloc(e->capAposentados * sizeof(struct NoAposentado<T>));
+    e->novos = (T**) malloc(e->capNovos * sizeof(T*));
+    e->trocados = (T**) malloc(e->capTrocados * sizeof(T*));
+    e->versao = 0;
+    e->falhou = 0;
+    memset(&e->lixo, 0, sizeof(T));
+    if(e->aposentados == NULL || e->novos == NULL || e->trocados == NULL){
+        free(e->aposentados);
+        free(e->novos);
+        free(e->trocados);
+        return 0;
+    }
+    return 1;
+}
+
+//Devolve ao alocador todos os ns aposentados e libera os vetores. Nenhum leitor pode estar ativo
+template <class T>
+void libera_Epoca(struct Epoca<T> *e){
+    for(int i = 0; i < e->quantAposentados; i++)
+        desaloca_NO(e->aloc, e->aposentados[i].no);
+    free(e->aposentados);
+    free(e->novos);
+    free(e->trocados);
+}
+
+//==================Leitores==========================
+
+//Entrega um lugar para uma thread leitora. Cada thread deve pedir o seu uma vez e us-lo em todas as buscas
+//Retorna -1 se j h MAX_LEITORES leitores
+template <class T>
+int registraLeitor_Epoca(struct Epoca<T> *e){
+    int id = __atomic_fetch_add(&e->num_leitores, 1, __ATOMIC_SEQ_CST);
+    return id < MAX_LEITORES ? id : -1;
+}
+
+//Chamada antes de ler a raiz. A escrita precisa ser vista pelo escritor antes da leitura da raiz (ordem sequencial)
+template <class T>
+void entra_Epoca(struct Epoca<T> *e, int id){
+    __atomic_store_n(&e->leitores[id].epoca, __atomic_load_n(&e->global, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+}
+
+//Chamada quando o leitor no vai mais usar nenhum n
+template <class T>
+void sai_Epoca(struct Epoca<T> *e, int id){
+    __atomic_store_n(&e->leitores[id].epoca, EPOCA_INATIVA, __ATOMIC_RELEASE);
+}
+
+//==================Escritor==========================
+
+//Acrescenta um ponteiro em um vetor que cresce dobrando. Retorna 0 se faltou memria
+template <class T>
+int empilha_Epoca(T ***vetor, int *quant, int *cap, T *no){
+    if(*quant == *cap){
+        T **novo = (T**) realloc(*vetor, 2 * (*cap) * sizeof(T*));
+        if(novo == NULL)
+            return 0;
+        *vetor = novo;
+        *cap *= 2;
+    }
+    (*vetor)[(*quant)++] = no;
+    return 1;
+}
+
+//Zera a verso de todos os ns (usado quando o contador de verses d a volta)
+//S o escritor l e escreve a verso, ento isso no atrapalha os leitores
+template <class T>
+void zeraVersao_NO(T *no){
+    while(no != NULL){
+        no->versao = 0;
+        zeraVersao_NO(no->esq);
+        no = no->dir;
+    }
+}
+
+//Comea uma atualizao da rvore com a raiz atual raiz
+template <class T>
+void inicia_Atualizacao(struct Epoca<T> *e, T *raiz){
+    e->versao++;
+    if(e->versao == 0){ //Deu a volta: um n antigo poderia ter a mesma verso da atualizao atual
+        zeraVersao_NO(raiz);
+        e->versao = 1;
+    }
+    e->quantNovos = 0;
+    e->quantTrocados = 0;
+    e->falhou = 0;
+}
+
+//Retorna um n novo, criado nesta atualizao. Se faltar memria, retorna o n lixo e marca a falha
+template <class T>
+T* novo_Epoca(struct Epoca<T> *e){
+    T *novo = e->falhou ? NULL : aloca_NO(e->aloc);
+    if(novo == NULL || !empilha_Epoca(&e->novos, &e->quantNovos, &e->capNovos, novo)){
+        if(novo != NULL)
+            desaloca_NO(e->aloc, novo);
+        e->falhou = 1;
+        return &e->lixo;
+    }
+    novo->versao = e->versao;
+    return novo;
+}
+
+//Retorna uma verso do n que pode ser alterada: o prprio n, se foi criado nesta atualizao, ou uma cpia dele
+//A cpia substitui o n na nova verso da rvore, ento o n original sai da rvore se a atualizao for confirmada
+template <class T>
+T* escreve_Epoca(struct Epoca<T> *e, T *no){
+    if(no->versao == e->versao && no != &e->lixo)
+        return no;
+    if(!empilha_Epoca(&e->trocados, &e->quantTrocados, &e->capTrocados, no)){
+        e->falhou = 1;
+        return &e->lixo;
+    }
+    T *novo = novo_Epoca(e);
+    if(e->falhou)
+        return &e->lixo;
+    *novo = *no;
+    novo->versao = e->versao;
+    return novo;
+}
+
+//O n sai da rvore (remoo). Se foi criado nesta atualizao, ainda vai para o alocador com os outros, depois das pocas
+template <class T>
+void descarta_Epoca(struct Epoca<T> *e, T *no){
+    if(!empilha_Epoca(&e->trocados, &e->quantTrocados, &e->capTrocados, no))
+        e->falhou = 1;
+}
+
+//Desfaz a atualizao: os ns criados nunca foram vistos pelos leitores e voltam para o alocador na hora
+template <class T>
+void cancela_Atualizacao(struct Epoca<T> *e){
+    for(int i = 0; i < e->quantNovos; i++)
+        desaloca_NO(e->aloc, e->novos[i]);
+    e->quantNovos = 0;
+    e->quantTrocados = 0;
+}
+
+//Menor poca entre os leitores ativos (EPOCA_INATIVA se nenhum est no meio de uma busca)
+template <class T>
+unsigned long long menor_Epoca(struct Epoca<T> *e){
+    unsigned long long menor = EPOCA_INATIVA;
+    int n = __atomic_load_n(&e->num_leitores, __ATOMIC_SEQ_CST);
+    if(n > MAX_LEITORES)
+        n = MAX_LEITORES;
+    for(int i = 0; i < n; i++){
+        unsigned long long ep = __atomic_load_n(&e->leitores[i].epoca, __ATOMIC_SEQ_CST);
+        if(ep < menor)
+            menor = ep;
+    }
+    return menor;
+}
+
+//Devolve ao alocador os ns aposentados que nenhum leitor ativo pode estar usando
+template <class T>
+void recupera_Epoca(struct Epoca<T> *e){
+    unsigned long long menor = menor_Epoca(e);
+    int fica = 0;
+    for(int i = 0; i < e->quantAposentados; i++){
+        if(e->aposentados[i].epoca < menor)
+            desaloca_NO(e->aloc, e->aposentados[i].no);
+        else
+            e->aposentados[fica++] = e->aposentados[i];
+    }
+    e->quantAposentados = fica;
+}
+
+//Confirma a atualizao. Deve ser chamada depois de publicar a nova raiz
+//Os ns trocados recebem a poca atual e a poca global avana: leitores que comearem daqui em diante no os veem mais
+template <class T>
+void confirma_Atualizacao(struct Epoca<T> *e){
+    unsigned long long ep = __atomic_load_n(&e->global, __ATOMIC_SEQ_CST);
+    for(int i = 0; i < e->quantTrocados; i++){
+        if(e->quantAposentados == e->capAposentados){
+            struct NoAposentado<T> *novo = (struct NoAposentado<T>*) realloc(e->aposentados, 2 * e->capAposentados * sizeof(struct NoAposentado<T>));
+            if(novo != NULL){
+                e->aposentados = novo;
+                e->capAposentados *= 2;
+            }else{ //Sem memria para guardar: espera todos os leitores atuais terminarem e tenta de novo
+                __atomic_fetch_add(&e->global, 1, __ATOMIC_SEQ_CST);
+                while(e->quantAposentados == e->capAposentados)
+                    recupera_Epoca(e);
+            }
+        }
+        e->aposentados[e->quantAposentados].no = e->trocados[i];
+        e->aposentados[e->quantAposentados].epoca = ep;
+        e->quantAposentados++;
+    }
+    e->quantTrocados = 0;
+    e->quantNovos = 0;
+    __atomic_fetch_add(&e->global, 1, __ATOMIC_SEQ_CST);
+    if(e->quantAposentados >= LIMITE_APOSENTADOS)
+        recupera_Epoca(e);
+}
+
+//==================Vrias threads alterando==========================
+//Na AVL otimista (AVL/ArvoreAVLOtimista.h) todas as threads alteram a rvore, ento no h uma lista nica de aposentados.
+//Cada thread ocupa o seu lugar de leitor durante toda a operao (entra_Epoca/sai_Epoca) e guarda os ns que ela
+//desligou da rvore na sua prpria lista. Os ns vm do alocador no modo ALOCA_MALLOC, que vrias threads podem usar
+
+//Lista de ns desligados por uma thread
+template <class T>
+struct alignas(64) AposentadosThread{
+    struct NoAposentado<T> *nos;
+    int quant, cap;
+    int limite; //Tenta recuperar quando quant chegar a esse valor
+};
+
+template <class T>
+void inicia_AposentadosThread(struct AposentadosThread<T> *ap){
+    ap->nos = NULL;
+    ap->quant = ap->cap = 0;
+    ap->limite = LIMITE_APOSENTADOS;
+}
+
+//Guarda um n que a thread acabou de desligar com a poca atual
+//Se faltar memria para a lista, o n s  liberado junto com a rvore (no pode ir para o free enquanto outros leem)
+template <class T>
+void aposenta_Epoca(struct Epoca<T> *e, struct AposentadosThread<T> *ap, T *no){
+    if(ap->quant == ap->cap){
+        int cap = ap->cap == 0 ? 2 * LIMITE_APOSENTADOS : 2 * ap->cap;
+        struct NoAposentado<T> *novo = (struct NoAposentado<T>*) realloc(ap->nos, cap * sizeof(struct NoAposentado<T>));
+        if(novo == NULL)
+            return;
+        ap->nos = novo;
+        ap->cap = cap;
+    }
+    ap->nos[ap->quant].no = no;
+    ap->nos[ap->quant].epoca = __atomic_load_n(&e->global, __ATOMIC_SEQ_CST);
+    ap->quant++;
+}
+
+//Devolve ao alocador os ns da lista que nenhuma thread ativa pode estar usando
+//A poca global avana antes da varredura: quem entrar depois disso j no v nenhum n da lista
+template <class T>
+void recuperaThread_Epoca(struct Epoca<T> *e, struct AposentadosThread<T> *ap){
+    __atomic_fetch_add(&e->global, 1, __ATOMIC_SEQ_CST);
+    unsigned long long menor = menor_Epoca(e);
+    int fica = 0;
+    for(int i = 0; i < ap->quant; i++){
+        if(ap->nos[i].epoca < menor)
+            desaloca_NO(e->aloc, ap->nos[i].no);
+        else
+            ap->nos[fica++] = ap->nos[i];
+    }
+    ap->quant = fica;
+    //Se uma thread lenta segura muitos ns, espera a lista dobrar antes de varrer de novo
+    ap->limite = 2 * fica > LIMITE_APOSENTADOS ? 2 * fica : LIMITE_APOSENTADOS;
+}
+
+//Libera todos os ns da lista. Nenhuma thread pode estar ativa
+template <class T>
+void liberaThread_Epoca(struct Epoca<T> *e, struct AposentadosThread<T> *ap){
+    for(int i = 0; i < ap->quant; i++)
+        desaloca_NO(e->aloc, ap->nos[i].no);
+    free(ap->nos);
+    inicia_AposentadosThread(ap);
+}
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef GERACHAVES_H
+#define GERACHAVES_H
+
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+//Gerador de chaves para os testes (Benchmark/Benchmark.cpp)
+//O antigo GeraAleatorios sorteava cada nmero e procurava no vetor se ele j tinha sado (Existe), ento m chaves distintas
+//custavam O(m), e por isso os testes acabavam usando as chaves em sequncia 0..N-1, que favorecem as rvores e o std::map pela
+//localidade de cache. Aqui as chaves distintas saem de uma permutao: a chave j  a imagem de j por uma bijeo pseudoaleatria
+//de [0, n) (uma rede de Feistel), ento m chaves custam O(m), sem memria extra e sem repetio
+//
+//O conjunto de chaves tem n chaves: a de ndice i  2i. Os mpares 2i + 1 nunca esto na rvore e servem de consultas que falham
+//Distribuies (ordem em que as chaves aparecem na sequncia):
+//  uniforme: ndices sorteados com a mesma chance (sem repetio, uma permutao aleatria)
+//  zipf: poucas chaves concentram a maioria dos acessos (ZIPF_THETA, como no YCSB). Os ndices mais populares so espalhados
+//        pela permutao, para as chaves quentes no ficarem vizinhas na rvore. Sempre com repetio
+//  ordenada e decrescente: ndices em ordem crescente ou decrescente
+//  agrupada: grupos de TAM_GRUPO chaves consecutivas, com os grupos em ordem aleatria (dados que chegam por origem ou por lote)
+//  faltantes: uniforme entre 0 e 2n - 1, ento mais ou menos metade das chaves (PROPORCAO_FALTANTES) no est na rvore
+//Com unicos = 1 nenhuma chave se repete (insero e remoo); com unicos = 0 as chaves so sorteadas de novo a cada posio (consultas)
+
+#define DIST_UNIFORME 0
+#define DIST_ZIPF 1
+#define DIST_ORDENADA 2
+#define DIST_DECRESCENTE 3
+#define DIST_AGRUPADA 4
+#define DIST_FALTANTES 5
+#define NUM_DISTRIBUICOES 6
+
+static const char *nomes_Distribuicao[NUM_DISTRIBUICOES] = {"uniforme", "zipf", "ordenada", "decrescente", "agrupada", "faltantes"};
+
+#define ZIPF_THETA 0.99 //Inclinao da Zipf (a do YCSB)
+#define TAM_GRUPO 64 //Chaves consecutivas em cada grupo da distribuio agrupada
+#define PROPORCAO_FALTANTES 0.5 //Chance de uma consulta "faltantes" (com repetio) procurar uma chave que no est na rvore
+
+//==================Nmeros aleatrios==========================
+//splitmix64: um estado de 64 bits e poucas operaes por nmero, bem mais rpido que std::mt19937 com uniform_int_distribution
+
+struct Sorteio{
+    uint64_t estado;
+};
+
+void inicia_Sorteio(struct Sorteio *s, uint64_t semente){
+    s->estado = semente;
+}
+
+uint64_t proximo_Sorteio(struct Sorteio *s){
+    uint64_t z = (s->estado += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+//Inteiro entre 0 e n - 1 (multiplicao em vez de resto; o vis  desprezvel para n < 2^32)
+uint64_t intervalo_Sorteio(struct Sorteio *s, uint64_t n){
+    return (uint64_t) (((unsigned __int128) proximo_Sorteio(s) * n) >> 64);
+}
+
+//Real entre 0 e 1
+double real_Sorteio(struct Sorteio *s){
+    return (proximo_Sorteio(s) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+//==================Permutao de [0, n)==========================
+//Rede de Feistel com 4 rodadas sobre 2k bits (4^k >= n):  uma bijeo de [0, 4^k). Para ficar em [0, n), quando a imagem
+//cai fora aplicamos de novo (cycle walking). Como 4^k < 4n, so menos de 4 aplicaes em mdia
+
+struct Permutacao{
+    uint64_t n;
+    int meio; //k: bits de cada metade
+    uint64_t mascara; //2^k - 1
+    uint64_t chaves[4]; //Chave de cada rodada
+};
+
+void inicia_Permutacao(struct Permutacao *p, uint64_t n, uint64_t semente){
+    p->n = n;
+    p->meio = 1;
+    while(((uint64_t) 1 << (2 * p->meio)) < n)
+        p->meio++;
+    p->mascara = ((uint64_t) 1 << p->meio) - 1;
+    struct Sorteio s;
+    inicia_Sorteio(&s, semente);
+    for(int r=0;r<4;r++)
+        p->chaves[r] = proximo_Sorteio(&s);
+}
+
+//Funo de cada rodada: mistura a metade com a chave (finalizador do splitmix64)
+uint64_t rodada_Permutacao(uint64_t x, uint64_t chave){
+    uint64_t z = x ^ chave;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+//Imagem de i (0 <= i < n)
+uint64_t aplica_Permutacao(const struct Permutacao *p, uint64_t i){
+    do{
+        uint64_t esq = i >> p->meio, dir = i & p->mascara;
+        for(int r=0;r<4;r++){
+            uint64_t t = dir;
+            dir = esq ^ (rodada_Permutacao(dir, p->chaves[r]) & p->mascara);
+            esq = t;
+        }
+        i = (esq << p->meio) | dir;
+    }while(i >= p->n);
+    return i;
+}
+
+//==================Zipf==========================
+//Mtodo de Gray et al. ("Quickly generating billion-record synthetic databases"), o mesmo do YCSB: depois de calcular zeta(n)
+//uma vez (O(n)), cada nmero sai em O(1). O resultado  o posto: 0  o mais popular
+
+struct Zipf{
+    uint64_t n;
+    double theta, alfa, zetan, eta, limite2;
+};
+
+void inicia_Zipf(struct Zipf *z, uint64_t n, double theta){
+    z->n = n;
+    z->theta = theta;
+    z->zetan = 0;
+    for(uint64_t i=1;i<=n;i++)
+        z->zetan += 1.0 / pow((double) i, theta);
+    double zeta2 = 1.0 + 1.0 / pow(2.0, theta);
+    z->alfa = 1.0 / (1.0 - theta);
+    z->eta = (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / z->zetan);
+    z->limite2 = 1.0 + pow(0.5, theta);
+}
+
+uint64_t sorteia_Zipf(const struct Zipf *z, struct Sorteio *s){
+    double u = real_Sorteio(s);
+    double uz = u * z->zetan;
+    if(uz < 1.0)
+        return 0;
+    if(uz < z->limite2)
+        return 1;
+    uint64_t r = (uint64_t) (z->n * pow(z->eta * u - z->eta + 1.0, z->alfa));
+    return (r < z->n) ? r : z->n - 1;
+}
+
+//==================Sequncias de chaves==========================
+
+//Preenche saida com m chaves do conjunto de n chaves, na distribuio escolhida
+//Com unicos = 1, m no pode passar de n (de 2n em "faltantes"); "zipf" sempre repete
+//Retorna 1 ou 0 (distribuio desconhecida ou m grande demais)
+int gera_Chaves(int saida[], long long m, long long n, int distribuicao, int unicos, uint64_t semente){
+    if(n < 1 || m < 0 || 2 * n - 1 > INT32_MAX)
+        return 0;
+    struct Sorteio s;
+    inicia_Sorteio(&s, semente);
+    struct Permutacao p;
+    switch(distribuicao){
+    case DIST_UNIFORME:
+        if(unicos){
+            if(m > n)
+                return 0;
+            inicia_Permutacao(&p, n, proximo_Sorteio(&s));
+            for(long long j=0;j<m;j++)
+                saida[j] = (int) (2 * aplica_Permutacao(&p, j));
+        }else
+            for(long long j=0;j<m;j++)
+                saida[j] = (int) (2 * intervalo_Sorteio(&s, n));
+        return 1;
+    case DIST_ZIPF:{
+        struct Zipf z;
+        inicia_Zipf(&z, n, ZIPF_THETA);
+        inicia_Permutacao(&p, n, proximo_Sorteio(&s));
+        for(long long j=0;j<m;j++)
+            saida[j] = (int) (2 * aplica_Permutacao(&p, sorteia_Zipf(&z, &s)));
+        return 1;
+    }
+    case DIST_ORDENADA:
+    case DIST_DECRESCENTE:
+        if(unicos){
+            if(m > n)
+                return 0;
+            //Amostra ordenada de m ndices entre n (algoritmo S de Knuth): cada ndice entra com chance (faltam escolher)/(faltam ver)
+            long long k = 0;
+            for(long long i=0;i<n && k<m;i++)
+                if((long long) intervalo_Sorteio(&s, n - i) < m - k)
+                    saida[k++] = (int) (2 * i);
+        }else
+            for(long long j=0;j<m;j++)
+                saida[j] = (int) (2 * (j % n));
+        if(distribuicao == DIST_DECRESCENTE)
+            std::reverse(saida, saida + m);
+        return 1;
+    case DIST_AGRUPADA:
+        if(unicos){
+            if(m > n)
+                return 0;
+            long long grupos = (n + TAM_GRUPO - 1) / TAM_GRUPO;
+            inicia_Permutacao(&p, grupos, proximo_Sorteio(&s));
+            long long k = 0;
+            for(long long g=0;k<m;g++){
+                long long ini = (long long) aplica_Permutacao(&p, g) * TAM_GRUPO;
+                for(long long i=ini;i<ini+TAM_GRUPO && i<n && k<m;i++)
+                    saida[k++] = (int) (2 * i);
+            }
+        }else{
+            for(long long j=0;j<m;j+=TAM_GRUPO){
+                long long ini = (long long) intervalo_Sorteio(&s, n);
+                for(long long i=0;i<TAM_GRUPO && j+i<m;i++)
+                    saida[j + i] = (int) (2 * ((ini + i) % n));
+            }
+        }
+        return 1;
+    case DIST_FALTANTES:
+        if(unicos){
+            if(m > 2 * n)
+                return 0;
+            inicia_Permutacao(&p, 2 * n, proximo_Sorteio(&s));
+            for(long long j=0;j<m;j++)
+                saida[j] = (int) aplica_Permutacao(&p, j);
+        }else
+            for(long long j=0;j<m;j++)
+                saida[j] = (int) (2 * intervalo_Sorteio(&s, n) + (real_Sorteio(&s) < PROPORCAO_FALTANTES));
+        return 1;
+    }
+    return 0;
+}
+
+//ndice da distribuio pelo nome, ou -1
+int distribuicao_Nome(const char *nome){
+    for(int d=0;d<NUM_DISTRIBUICOES;d++){
+        const char *a = nome, *b = nomes_Distribuicao[d];
+        while(*a && *a == *b){
+            a++;
+            b++;
+        }
+        if(*a == '\0' && *b == '\0')
+            return d;
+    }
+    return -1;
+}
+
+#endif
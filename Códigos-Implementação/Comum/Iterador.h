@@ -0,0 +1,105 @@
+#ifndef ITERADOR_H
+#define ITERADOR_H
+
+#include <cstddef>
+
+//Iteradores em ordem e varredura de intervalo, compartilhados pelas rvores com ponteiros (AVL, LLRB e Rubro-Negra)
+//Os percursos emOrdem_* so recursivos e s imprimem. Aqui o caminho da raiz at o n atual fica em uma pilha de
+//tamanho fixo dentro do prprio iterador: no h recurso nem alocao de memria
+//Cada avano custa O(1) amortizado. Ao chegar em um n, pedimos com prefetch o filho pelo qual o prximo avano vai descer
+//O iterador no acompanha alteraes na rvore: inserir ou remover durante o percurso invalida o iterador
+
+//Tamanho da pilha: cabe o caminho mais longo de qualquer das rvores com chaves int
+//A Rubro-Negra (e a LLRB) tem altura no mximo 2*log2(N+1), ou seja, 64 ns para N < 2^32. A AVL fica abaixo de 1,44*log2(N+2)
+#define ALTURA_MAX_ITERADOR 64
+
+//T  o n da rvore: precisa dos campos chave, info, esq e dir
+template <class T>
+struct Iterador{
+    T *pilha[ALTURA_MAX_ITERADOR]; //Ns ainda no visitados do caminho. O topo  o n atual
+    int topo; //Quantidade de ns na pilha (0 = percurso terminou)
+    int reverso; //0 = ordem crescente, 1 = ordem decrescente
+};
+
+//Empilha o n e desce sempre para o lado das chaves menores (ou maiores, no reverso)
+template <class T>
+void empilhaLado_Iterador(struct Iterador<T> *it, T *no){
+    while(no != NULL){
+        it->pilha[it->topo++] = no;
+        no = it->reverso ? no->dir : no->esq;
+    }
+}
+
+//O prximo avano desce pelo outro filho do topo: j pede esse n
+template <class T>
+void prefetch_Iterador(struct Iterador<T> *it){
+    if(it->topo > 0){
+        T *no = it->pilha[it->topo - 1];
+        __builtin_prefetch(it->reverso ? no->esq : no->dir);
+    }
+}
+
+//Posiciona o iterador na menor chave (ou na maior, se reverso)
+template <class T>
+void inicia_Iterador(struct Iterador<T> *it, T *raiz, int reverso){
+    it->topo = 0;
+    it->reverso = reverso;
+    empilhaLado_Iterador(it, raiz);
+    prefetch_Iterador(it);
+}
+
+//Posiciona o iterador na primeira chave >= valor (ou na ltima chave <= valor, se reverso)
+//Desce uma vez da raiz: O(log N). S ficam na pilha os ns cuja chave ainda vai ser visitada
+template <class T>
+void iniciaEm_Iterador(struct Iterador<T> *it, T *raiz, int valor, int reverso){
+    it->topo = 0;
+    it->reverso = reverso;
+    T *no = raiz;
+    while(no != NULL){
+        if(valor == no->chave){
+            it->pilha[it->topo++] = no;
+            break;
+        }
+        if((valor < no->chave) != (reverso != 0)){ //Chave do n vem depois de valor no percurso: fica na pilha
+            it->pilha[it->topo++] = no;
+            no = reverso ? no->dir : no->esq;
+        }else
+            no = reverso ? no->esq : no->dir;
+    }
+    prefetch_Iterador(it);
+}
+
+//N atual do percurso, ou NULL se o percurso terminou
+template <class T>
+T* atual_Iterador(struct Iterador<T> *it){
+    if(it->topo == 0)
+        return NULL;
+    return it->pilha[it->topo - 1];
+}
+
+//Vai para a prxima chave do percurso
+template <class T>
+void avanca_Iterador(struct Iterador<T> *it){
+    if(it->topo == 0)
+        return;
+    T *no = it->pilha[--it->topo];
+    empilhaLado_Iterador(it, it->reverso ? no->esq : no->dir);
+    prefetch_Iterador(it);
+}
+
+//Chama funcao(chave, info) para cada chave em [lo, hi], em ordem crescente. Retorna quantas chaves foram visitadas
+//funcao pode ser ponteiro de funo ou lambda: como  parmetro de template, a chamada pode ser expandida no lao
+template <class T, class F>
+long long varre_NO(T *raiz, int lo, int hi, F funcao){
+    struct Iterador<T> it;
+    long long visitados = 0;
+    iniciaEm_Iterador(&it, raiz, lo, 0);
+    for(T *no = atual_Iterador(&it); no != NULL && no->chave <= hi; no = atual_Iterador(&it)){
+        funcao(no->chave, no->info);
+        visitados++;
+        avanca_Iterador(&it);
+    }
+    return visitados;
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef LATENCIA_H
+#define LATENCIA_H
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+//Medio de latncia por operao para os testes (Benchmark/Benchmark.cpp)
+//Os programas de teste chamam Timer::reset()/elapsed() (high_resolution_clock) em volta de cada operao e guardam os tempos num
+//vetor de double com uma posio por operao (120 MB com 15M chaves), que depois s  usado para tirar a mdia. Cada leitura do
+//relgio custa quase o mesmo que a operao, e a mdia esconde a cauda, que  o que importa para os nossos SLAs
+//Aqui cada operao medida custa duas leituras do contador de ciclos (rdtsc, ou clock_gettime fora do x86) e um incremento num
+//histograma de tamanho fixo (NUM_BALDES contadores, 15 KB), de onde saem os percentis
+//
+//Histograma em escala log-linear, como o HdrHistogram: cada potncia de 2  dividida em BALDES_POR_OITAVA baldes iguais,
+//ento o erro relativo de qualquer percentil  de no mximo 1/BALDES_POR_OITAVA (3%), do primeiro ciclo at 2^64
+//Os valores so registrados em tiques do relgio e convertidos para nanossegundos s no relatrio (ns_por_tique, calibrado uma vez)
+//O rdtsc supe um TSC invariante (constant_tsc em /proc/cpuinfo), o caso de todo x86 dos ltimos 15 anos
+
+#define BITS_OITAVA 5
+#define BALDES_POR_OITAVA (1 << BITS_OITAVA)
+#define NUM_BALDES ((64 - BITS_OITAVA + 1) * BALDES_POR_OITAVA)
+
+//==================Relgio==========================
+
+//Leitura do relgio em tiques. As barreiras (lfence) impedem que o processador adiante ou atrase a leitura em relao  operao
+static inline uint64_t le_Relogio(){
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+static inline uint64_t nanos_Sistema(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+struct Relogio{
+    double ns_por_tique; //Converso de tiques para nanossegundos
+    uint64_t custo; //Menor tempo (em tiques) entre duas leituras seguidas: o que o prprio relgio soma a cada amostra
+};
+
+//Compara o relgio com o clock_gettime durante uns 20 ms e mede o custo de uma leitura
+static inline void calibra_Relogio(struct Relogio *r){
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t ns0 = nanos_Sistema(), t0 = le_Relogio();
+    while(nanos_Sistema() - ns0 < 20000000ULL)
+        ;
+    uint64_t ns1 = nanos_Sistema(), t1 = le_Relogio();
+    r->ns_por_tique = (double) (ns1 - ns0) / (double) (t1 - t0);
+#else
+    r->ns_por_tique = 1.0;
+#endif
+    r->custo = UINT64_MAX;
+    for(int i=0;i<1000;i++){
+        uint64_t a = le_Relogio();
+        uint64_t b = le_Relogio();
+        if(b - a < r->custo)
+            r->custo = b - a;
+    }
+}
+
+//Converte uma amostra de tiques para nanossegundos, descontando o custo do prprio relgio
+static inline double nanos_Relogio(const struct Relogio *r, uint64_t tiques){
+    return (tiques > r->custo) ? (double) (tiques - r->custo) * r->ns_por_tique : 0.0;
+}
+
+//==================Histograma==========================
+
+struct Histograma{
+    uint64_t contagem[NUM_BALDES];
+    uint64_t total; //Amostras registradas
+    uint64_t maximo; //Maior valor registrado (exato, no arredondado pelo balde)
+};
+
+static inline void zera_Histograma(struct Histograma *h){
+    memset(h, 0, sizeof(struct Histograma));
+}
+
+//Balde do valor v: abaixo de 2*BALDES_POR_OITAVA um balde por valor; acima, desloca at sobrarem BITS_OITAVA + 1 bits
+static inline int balde_Histograma(uint64_t v){
+    if(v < 2 * BALDES_POR_OITAVA)
+        return (int) v;
+    int desloca = (63 - __builtin_clzll(v)) - BITS_OITAVA;
+    return desloca * BALDES_POR_OITAVA + (int) (v >> desloca);
+}
+
+//Maior valor que cai no balde b
+static inline uint64_t limite_Histograma(int b){
+    if(b < 2 * BALDES_POR_OITAVA)
+        return (uint64_t) b;
+    int desloca = b / BALDES_POR_OITAVA - 1;
+    uint64_t mantissa = (uint64_t) (b - desloca * BALDES_POR_OITAVA);
+    return ((mantissa + 1) << desloca) - 1;
+}
+
+static inline void registra_Histograma(struct Histograma *h, uint64_t v){
+    h->contagem[balde_Histograma(v)]++;
+    h->total++;
+    if(v > h->maximo)
+        h->maximo = v;
+}
+
+//Soma o histograma b em a (rodadas ou threads diferentes)
+static inline void junta_Histograma(struct Histograma *a, const struct Histograma *b){
+    for(int i=0;i<NUM_BALDES;i++)
+        a->contagem[i] += b->contagem[i];
+    a->total += b->total;
+    if(b->maximo > a->maximo)
+        a->maximo = b->maximo;
+}
+
+//Valor (em tiques) abaixo do qual esto pelo menos a frao p das amostras (p = 0.5, 0.99, 0.999...)
+//Devolve o limite superior do balde, nunca mais que o mximo registrado. 0 se o histograma est vazio
+static inline uint64_t percentil_Histograma(const struct Histograma *h, double p){
+    if(h->total == 0)
+        return 0;
+    uint64_t alvo = (uint64_t) (p * (double) h->total);
+    if((double) alvo < p * (double) h->total)
+        alvo++; //Arredonda para cima: o p99 de 100 amostras  a 99
+    if(alvo < 1)
+        alvo = 1;
+    uint64_t acumulado = 0;
+    for(int b=0;b<NUM_BALDES;b++){
+        acumulado += h->contagem[b];
+        if(acumulado >= alvo){
+            uint64_t v = limite_Histograma(b);
+            return (v < h->maximo) ? v : h->maximo;
+        }
+    }
+    return h->maximo;
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef MEMORIA_H
+#define MEMORIA_H
+
+#include <cstddef>
+#include <memory>
+
+//Alocador para contineres da STL que conta quantos bytes foram pedidos
+//Usado nos testes para calcular quantos bytes por n o std::map ocupa, para comparar com as rvores
+//Conta apenas o que foi pedido ao alocador (no inclui o cabealho que o malloc coloca em cada bloco)
+
+static size_t bytes_ContaAlocador = 0; //Total de bytes em uso pelos contineres que usam ContaAlocador
+
+template <class T>
+struct ContaAlocador{
+    typedef T value_type;
+
+    ContaAlocador() {}
+    template <class U> ContaAlocador(const ContaAlocador<U>&) {}
+
+    T* allocate(size_t n){
+        bytes_ContaAlocador += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n){
+        bytes_ContaAlocador -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+template <class T, class U>
+bool operator==(const ContaAlocador<T>&, const ContaAlocador<U>&){ return true; }
+template <class T, class U>
+bool operator!=(const ContaAlocador<T>&, const ContaAlocador<U>&){ return false; }
+
+#endif
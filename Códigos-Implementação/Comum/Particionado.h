@@ -0,0 +1,136 @@
+#ifndef PARTICIONADO_H
+#define PARTICIONADO_H
+
+#include <cstdlib>
+#include <new>
+#include <mutex>
+
+//Dicionrio particionado para uso com vrias threads
+//As rvores (AVL, LLRB, ...) s podem ser usadas por uma thread de cada vez. Aqui o intervalo de chaves  dividido
+//em P partes de mesmo tamanho e cada parte  uma rvore independente com a sua prpria trava (mutex)
+//Operaes em partes diferentes no esperam umas pelas outras, ento insero, busca e remoo escalam com o nmero de ncleos
+//Como a diviso  por intervalo (e no por hash), a parte i s tem chaves menores que as da parte i+1:
+//percorrer as partes em ordem continua dando as chaves em ordem crescente
+//Chaves fora de [chaveMin, chaveMax] vo para a primeira ou para a ltima parte
+//
+//M  o "motor": uma struct com as operaes da rvore usada em cada parte (MotorAVL, MotorLLRB, ...),
+//definida no cabealho de cada rvore
+
+//Cada parte ocupa linhas de cache prprias, para que threads em partes vizinhas no disputem a mesma linha
+template <class M>
+struct alignas(64) ParticaoDic{
+    std::mutex trava; //Protege a rvore dessa parte
+    typename M::Arvore *arv; //rvore com as chaves dessa parte
+};
+
+template <class M>
+struct DicParticionado{
+    struct ParticaoDic<M> *particoes;
+    int P; //Quantidade de partes
+    long long chaveMin; //Menor chave do intervalo
+    long long largura; //Quantidade de chaves de cada parte
+};
+
+//Cria o dicionrio com P partes cobrindo as chaves de chaveMin at chaveMax
+//modo  o modo de alocao dos ns de cada rvore (ALOCA_MALLOC ou ALOCA_ARENA)
+//Retorna NULL se faltou memria
+template <class M>
+struct DicParticionado<M>* cria_DicParticionado(int P, int chaveMin, int chaveMax, int modo = ALOCA_MALLOC){
+    if(P < 1 || chaveMax < chaveMin)
+        return NULL;
+    struct DicParticionado<M> *d = (struct DicParticionado<M>*) malloc(sizeof(struct DicParticionado<M>));
+    if(d == NULL)
+        return NULL;
+    d->particoes = (struct ParticaoDic<M>*) aligned_alloc(alignof(struct ParticaoDic<M>), P * sizeof(struct ParticaoDic<M>));
+    if(d->particoes == NULL){
+        free(d);
+        return NULL;
+    }
+    d->P = P;
+    d->chaveMin = chaveMin;
+    d->largura = ((long long) chaveMax - chaveMin) / P + 1;
+    for(int i = 0; i < P; i++){
+        new (&d->particoes[i].trava) std::mutex(); //O mutex precisa ser construdo (a memria veio do aligned_alloc)
+        d->particoes[i].arv = M::cria(modo);
+        if(d->particoes[i].arv == NULL){ //Desfaz as partes j criadas
+            for(int j = 0; j <= i; j++){
+                M::libera(d->particoes[j].arv);
+                d->particoes[j].trava.~mutex();
+            }
+            free(d->particoes);
+            free(d);
+            return NULL;
+        }
+    }
+    return d;
+}
+
+//Parte responsvel pela chave
+template <class M>
+int particao_DicParticionado(struct DicParticionado<M> *d, int chave){
+    long long p = ((long long) chave - d->chaveMin) / d->largura;
+    if(chave < d->chaveMin || p < 0)
+        return 0;
+    if(p >= d->P)
+        return d->P - 1;
+    return (int) p;
+}
+
+template <class M>
+void libera_DicParticionado(struct DicParticionado<M> *d){
+    if(d == NULL)
+        return;
+    for(int i = 0; i < d->P; i++){
+        M::libera(d->particoes[i].arv);
+        d->particoes[i].trava.~mutex();
+    }
+    free(d->particoes);
+    free(d);
+}
+
+//As operaes travam s a parte da chave. Retornam o mesmo que a operao da rvore
+template <class M>
+int insere_DicParticionado(struct DicParticionado<M> *d, int chave, int valor){
+    struct ParticaoDic<M> *p = &d->particoes[particao_DicParticionado(d, chave)];
+    std::lock_guard<std::mutex> trava(p->trava);
+    return M::insere(p->arv, chave, valor);
+}
+
+template <class M>
+int consulta_DicParticionado(struct DicParticionado<M> *d, int chave){
+    struct ParticaoDic<M> *p = &d->particoes[particao_DicParticionado(d, chave)];
+    std::lock_guard<std::mutex> trava(p->trava);
+    return M::consulta(p->arv, chave);
+}
+
+template <class M>
+int remove_DicParticionado(struct DicParticionado<M> *d, int chave){
+    struct ParticaoDic<M> *p = &d->particoes[particao_DicParticionado(d, chave)];
+    std::lock_guard<std::mutex> trava(p->trava);
+    return M::remove(p->arv, chave);
+}
+
+template <class M>
+int atualiza_DicParticionado(struct DicParticionado<M> *d, int chave, int valor){
+    struct ParticaoDic<M> *p = &d->particoes[particao_DicParticionado(d, chave)];
+    std::lock_guard<std::mutex> trava(p->trava);
+    return M::atualiza(p->arv, chave, valor);
+}
+
+//Varredura de [lo, hi] parte por parte, em ordem crescente, travando uma parte de cada vez
+//No  um retrato do intervalo num instante s: uma parte j varrida pode mudar enquanto a prxima  lida
+template <class M, class F>
+long long varre_DicParticionado(struct DicParticionado<M> *d, int lo, int hi, F funcao){
+    if(lo > hi)
+        return 0;
+    long long visitados = 0;
+    int fim = particao_DicParticionado(d, hi);
+    for(int i = particao_DicParticionado(d, lo); i <= fim; i++){
+        struct ParticaoDic<M> *p = &d->particoes[i];
+        std::lock_guard<std::mutex> trava(p->trava);
+        visitados += M::varre(p->arv, lo, hi, funcao);
+    }
+    return visitados;
+}
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef PERSISTENTE_H
+#define PERSISTENTE_H
+
+#include <cstdlib>
+#include "Alocador.h"
+
+//Verses persistentes das rvores por cpia de caminho (AVL/ArvoreAVLPersistente.h e LLRB/ArvoreLLRBPersistente.h)
+//
+//Cada insero ou remoo monta uma nova verso da rvore copiando s os ns que mudariam: o caminho da raiz at o ponto
+//alterado e os ns que as rotaes e trocas de cor mexem, O(log N) ns. O resto  compartilhado com as verses antigas,
+//que continuam valendo. Guardar a verso atual  s contar mais uma referncia para a raiz: O(1)
+//
+//Contagem de referncias: o campo refs de cada n diz quantos ponteiros apontam para ele (filhos de ns de qualquer verso
+//e verses guardadas). Um n com refs == 1 s  visto pela verso que est sendo alterada, ento  alterado no lugar.
+//Sem verses guardadas nada  copiado, e as operaes custam quase o mesmo que as normais
+//Quando uma verso  solta, os ns que ficam sem referncia voltam para o alocador
+//
+//Os contadores no so atmicos: as verses so alteradas, guardadas e soltas s pela thread dona da rvore.
+//Uma verso guardada nunca muda, ento outras threads podem buscar nela sem trava enquanto ela no for solta
+//
+//Antes de cada operao so reservados os ns que ela pode precisar. Se faltar memria, a operao no comea
+//e nenhuma verso muda
+
+#define MAX_RESERVA 640 //Mximo de ns reservados (basta para rvores de at 2^50 ns)
+
+//T  o n da rvore: precisa dos campos esq, dir e refs
+template <class T>
+struct Versoes{
+    Alocador<T> *aloc; //Alocador dos ns da rvore
+    size_t nos; //Ns vivos, somando todas as verses
+    T *reserva[MAX_RESERVA]; //Ns j alocados para as prximas operaes
+    int quantReserva;
+};
+
+template <class T>
+void inicia_Versoes(struct Versoes<T> *v, Alocador<T> *aloc){
+    v->aloc = aloc;
+    v->nos = 0;
+    v->quantReserva = 0;
+}
+
+//Devolve a reserva ao alocador
+template <class T>
+void libera_Versoes(struct Versoes<T> *v){
+    while(v->quantReserva > 0)
+        desaloca_NO(v->aloc, v->reserva[--v->quantReserva]);
+}
+
+//Ns que uma operao pode copiar: at 6 por nvel (o n do caminho, os dois filhos e os netos que as rotaes mexem),
+//com altura de no mximo 2 log2(N+2) nas duas rvores
+template <class T>
+int necessarios_Versoes(struct Versoes<T> *v){
+    int log2 = 64 - __builtin_clzll((unsigned long long) v->nos + 2);
+    int n = 6 * (2 * log2 + 2);
+    return n < MAX_RESERVA ? n : MAX_RESERVA;
+}
+
+//Completa a reserva para a prxima operao. Retorna 0 se faltou memria
+template <class T>
+int reserva_Versoes(struct Versoes<T> *v){
+    int n = necessarios_Versoes(v);
+    while(v->quantReserva < n){
+        T *no = aloca_NO(v->aloc);
+        if(no == NULL)
+            return 0;
+        v->reserva[v->quantReserva++] = no;
+    }
+    return 1;
+}
+
+//N novo com uma referncia (o ponteiro que vai receb-lo)
+template <class T>
+T* novo_Versoes(struct Versoes<T> *v){
+    T *no = v->quantReserva > 0 ? v->reserva[--v->quantReserva] : aloca_NO(v->aloc);
+    no->refs = 1;
+    v->nos++;
+    return no;
+}
+
+//Retorna um n que pode ser alterado no lugar de no, que  apontado por um ponteiro da verso em construo
+//Se no  compartilhado,  copiado: a cpia toma o lugar desse ponteiro, no perde essa referncia e os filhos ganham uma
+template <class T>
+T* escreve_Versoes(struct Versoes<T> *v, T *no){
+    if(no->refs == 1)
+        return no;
+    T *novo = novo_Versoes(v);
+    *novo = *no;
+    novo->refs = 1;
+    if(novo->esq != NULL)
+        novo->esq->refs++;
+    if(novo->dir != NULL)
+        novo->dir->refs++;
+    no->refs--;
+    return novo;
+}
+
+//Mais uma referncia para o n (uma verso guardada ou um segundo pai)
+template <class T>
+T* guarda_Versoes(T *no){
+    if(no != NULL)
+        no->refs++;
+    return no;
+}
+
+//Solta uma referncia. Se ningum mais aponta para o n, ele volta para o alocador e os filhos perdem uma referncia
+template <class T>
+void solta_Versoes(struct Versoes<T> *v, T *no){
+    while(no != NULL && --no->refs == 0){
+        solta_Versoes(v, no->esq);
+        T *dir = no->dir;
+        desaloca_NO(v->aloc, no);
+        v->nos--;
+        no = dir;
+    }
+}
+
+#endif
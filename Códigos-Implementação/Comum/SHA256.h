@@ -0,0 +1,77 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+//SHA-256 (FIPS 180-4), usado pelas rvores autenticadas (AVL/ArvoreAVLMerkle.h)
+//Implementao direta, sem dependncias: a mensagem inteira  passada de uma vez e o resumo tem 32 bytes
+
+#define TAM_HASH 32
+
+static const uint32_t constantes_SHA256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t rotaciona_SHA256(uint32_t x, int n){
+    return (x >> n) | (x << (32 - n));
+}
+
+//Processa um bloco de 64 bytes
+static inline void bloco_SHA256(uint32_t estado[8], const unsigned char bloco[64]){
+    uint32_t w[64];
+    for(int i=0;i<16;i++)
+        w[i] = ((uint32_t) bloco[4*i] << 24) | ((uint32_t) bloco[4*i+1] << 16) | ((uint32_t) bloco[4*i+2] << 8) | (uint32_t) bloco[4*i+3];
+    for(int i=16;i<64;i++){
+        uint32_t s0 = rotaciona_SHA256(w[i-15], 7) ^ rotaciona_SHA256(w[i-15], 18) ^ (w[i-15] >> 3);
+        uint32_t s1 = rotaciona_SHA256(w[i-2], 17) ^ rotaciona_SHA256(w[i-2], 19) ^ (w[i-2] >> 10);
+        w[i] = w[i-16] + s0 + w[i-7] + s1;
+    }
+    uint32_t a = estado[0], b = estado[1], c = estado[2], d = estado[3];
+    uint32_t e = estado[4], f = estado[5], g = estado[6], h = estado[7];
+    for(int i=0;i<64;i++){
+        uint32_t t1 = h + (rotaciona_SHA256(e, 6) ^ rotaciona_SHA256(e, 11) ^ rotaciona_SHA256(e, 25)) + ((e & f) ^ (~e & g)) + constantes_SHA256[i] + w[i];
+        uint32_t t2 = (rotaciona_SHA256(a, 2) ^ rotaciona_SHA256(a, 13) ^ rotaciona_SHA256(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    estado[0] += a; estado[1] += b; estado[2] += c; estado[3] += d;
+    estado[4] += e; estado[5] += f; estado[6] += g; estado[7] += h;
+}
+
+//Calcula o resumo dos n bytes da mensagem e copia para saida
+static inline void calcula_SHA256(const unsigned char *mensagem, size_t n, unsigned char saida[TAM_HASH]){
+    uint32_t estado[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    size_t i = 0;
+    for(;i + 64 <= n;i += 64)
+        bloco_SHA256(estado, mensagem + i);
+    //ltimo bloco (ou dois): resto da mensagem, o bit 1, zeros e o tamanho em bits
+    unsigned char fim[128];
+    size_t resto = n - i;
+    memcpy(fim, mensagem + i, resto);
+    fim[resto] = 0x80;
+    size_t tam = (resto + 9 <= 64) ? 64 : 128;
+    memset(fim + resto + 1, 0, tam - resto - 1);
+    uint64_t bits = (uint64_t) n * 8;
+    for(int j=0;j<8;j++)
+        fim[tam - 1 - j] = (unsigned char) (bits >> (8 * j));
+    bloco_SHA256(estado, fim);
+    if(tam == 128)
+        bloco_SHA256(estado, fim + 64);
+    for(int j=0;j<8;j++){
+        saida[4*j] = (unsigned char) (estado[j] >> 24);
+        saida[4*j+1] = (unsigned char) (estado[j] >> 16);
+        saida[4*j+2] = (unsigned char) (estado[j] >> 8);
+        saida[4*j+3] = (unsigned char) estado[j];
+    }
+}
+
+#endif
@@ -0,0 +1,608 @@
+#ifndef ARVORELLRB_H
+#define ARVORELLRB_H
+
+#include <cstdio>
+#include <cstdlib>
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+#include "../Comum/ConsultaLote.h" //Consulta em lote com prefetch
+#include "../Comum/ArvoreCongelada.h" //Cpia somente leitura na ordem de Eytzinger
+#include "../Comum/Iterador.h" //Iteradores em ordem e varredura de intervalo
+#include "../Comum/ConsultaVizinho.h" //Consultas pela chave mais prxima
+#include "../Comum/Dica.h" //Dica de insero para chaves em ordem
+
+//Usei como referncia as aulas do professor Andr Backes, disponveis em http://www.facom.ufu.br/~backes/
+//Foi implementado uma variao da rvore Rubro-Negra para faciliar
+//rvore Rubro-Negra Cada Para a Esquerda - Left-Leaning Redblack (LLRB), proposta por Robert Sedgewick (2008)
+//Propriedades da rvore Rubro-Negra:
+//- Todo n deve ser preto ou vermelho (esquema de colorao para manter o balanceamento da rvore)
+//- A raiz  sempre preta
+//- Todo n folha (NULL)  preto (como toda folha possui dois ponteiros NULL, pode-se ignorar isso para representar a rvore fins prticos e didticos)
+//- Se um n  vemelho, ento os seus filhos so pretos (no existem ns vermelhos consecutivos)
+//- Todos os caminhos de um n para os ns folhas descendentes contm o mesmo nmero de ns pretos
+//- Permite rebalanceamento local para manter as propriedades da rvore (rotaes e ajuste de cores)
+//- No pior caso, os algoritmos das operaes sero O(log(n))
+
+// A LLRB atender a todas essas propriedades, adicionando-se mais uma:
+//- Se um n  vermelho, ento ele ser filho esquerdo do seu pai
+// Dessa forma camos na implementao de uma rvore 2-3 (no  uma rvore binria)
+// Na rvore 2-3, cada n pode armazenar um ou dois valores e, dependendo da quantidade de valores armazenados, ter dois (um valor) ou trs (dois valores) filhos
+// Funcionamento semelhante a rvore binria, agora possuindo tambm um subarvore do meio, onde estaro os elementos
+// maiores do que o primeiro, mas menores que o segundo valor do n pai
+// A implementao corresponde a implementao de uma rvore 2-3 se considerarmos que o n vemelho ser sempre o valor menor
+// de um n contendo dois valores e trs subrvores
+// Assim, balancear a rvore rubro-negra equivale a manipular uma rvore 2-3, uma tarefa muito mais simples do que manipular uma rvore AVL ou uma rubro-negra convencional
+// Com exceo da "insero" e da "remoo", as demais funes (criar, liberar e buscar) da LLRB so idnticas a de uma rvore Binria
+
+// As operaes de busca, insero e remoo de elementos possuem complexidade O(log N), no qual N  o nmero de elementos da rvore), que so aplicados a rvore de busca binria
+
+//Definio das cores
+#define RED 1
+#define BLACK 0
+
+typedef struct NO* ArvLLRB;
+
+//Definio do n do dicionrio. Tipo de dado armazenado
+struct NO{
+    int info; //Informao propriamente dita
+    int chave; //Chave associada  informao
+    struct NO *esq; //Filho esquerdo
+    struct NO *dir; //Filho direito
+    int cor; //Cor do n
+    union{
+        unsigned int versao; //Usado s no modo com um escritor e vrios leitores (ArvoreLLRBConcorrente.h)
+        unsigned int refs; //Usado s no modo persistente (ArvoreLLRBPersistente.h): quantos ponteiros apontam para o n
+        unsigned int tam; //Usado s no modo com estatsticas de ordem (ArvoreLLRBOrdem.h): quantos ns tem a subrvore
+    }; //Ocupa o espao que sobrava no fim do n
+};
+
+//Cabealho da rvore: ponteiro para a raiz seguido do alocador dos ns
+//O ArvLLRB* devolvido por cria_ArvLLRB aponta para o campo raiz, ento as funes continuam recebendo um ponteiro para ponteiro
+struct CabecaArvLLRB{
+    struct NO* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns dessa rvore
+};
+
+//Retorna o alocador da rvore a partir do ponteiro para a raiz
+Alocador<struct NO>* alocador_ArvLLRB(ArvLLRB* raiz){
+    return &((struct CabecaArvLLRB*) raiz)->aloc;
+}
+
+//Cria a rvore alocando o n raiz e retornando o ponteiro (ponteiro para ponteiro, fica mais fcil mudar quem  a raiz da rvore, se necessrio)
+//Idntica  rvore binria
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvLLRB* cria_ArvLLRB(int modo = ALOCA_MALLOC){
+    struct CabecaArvLLRB* cab = (struct CabecaArvLLRB*) malloc(sizeof(struct CabecaArvLLRB));
+    if(cab == NULL)//Erro na alocao de memria
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    return &cab->raiz;
+}
+
+//Liberar um n
+void libera_NO(struct NO* no){
+    if(no == NULL) //Se j est vazia, no tem nada a fazer.
+        return;
+    libera_NO(no->esq); //Caso contrrio libera recursivamente todos os ns.
+    libera_NO(no->dir);
+    free(no); //Como usei malloc, usar o free ao invs de delete.
+    no = NULL;
+}
+
+//Liberar toda a rvore, utilizando a funo libera_NO. Igual da rvore binria
+//Na arena no  preciso visitar os ns: os blocos so liberados de uma vez
+void libera_ArvLLRB(ArvLLRB* raiz){
+    if(raiz == NULL)
+        return;
+    Alocador<struct NO>* aloc = alocador_ArvLLRB(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);//libera todos os blocos
+    else
+        libera_NO(*raiz);//libera cada n
+    free(raiz);//libera a raiz (o cabealho comea no campo raiz)
+}
+
+//A consulta  idntica a uma rvore Binria. Por padro vamos buscar pela chave
+int consulta_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(raiz == NULL) //rvopre vazia?
+        return 0;//No encontrou
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor == atual->chave){ //Valor procurado est no n atual
+            return 1; //Encontrou
+        }
+        if(valor > atual->chave) //Se o valor procurado for maior que o n atual, procurar na subvore direita
+            atual = atual->dir;
+        else
+            atual = atual->esq; //Se o valor procurado for menor que o n atual, procurar na subvore esquerda
+    }
+    return 0; //No encontrou
+}
+
+//Consulta vrias chaves de uma vez, avanando as buscas em paralelo e usando prefetch (Comum/ConsultaLote.h)
+//resultados[i] recebe 1 se encontrou valores[i] ou 0 caso contrrio. Retorna quantas chaves foram encontradas
+int consultaLote_ArvLLRB(ArvLLRB *raiz, const int valores[], int n, int resultados[]){
+    if(raiz == NULL)
+        return 0;
+    return consultaLote_NO(*raiz, valores, n, resultados);
+}
+
+//Cria uma cpia somente leitura da rvore em um vetor na ordem de Eytzinger (Comum/ArvoreCongelada.h)
+//As buscas na cpia (consulta_ArvCongelada) no seguem ponteiros. Alteraes na rvore depois disso no aparecem na cpia
+struct ArvCongelada* congela_ArvLLRB(ArvLLRB *raiz){
+    if(raiz == NULL)
+        return NULL;
+    return congela_Arvore(*raiz);
+}
+
+//Iterador em ordem sem recurso nem alocao (Comum/Iterador.h). Com reverso = 1 vai da maior para a menor chave
+//Uso: for(struct NO* no = atual_Iterador(&it); no != NULL; avanca_Iterador(&it), no = atual_Iterador(&it))
+void iterador_ArvLLRB(ArvLLRB *raiz, struct Iterador<struct NO> *it, int reverso = 0){
+    inicia_Iterador(it, (raiz == NULL) ? NULL : *raiz, reverso);
+}
+
+//Iterador que comea na primeira chave >= valor (ou na ltima chave <= valor, se reverso)
+void iteradorEm_ArvLLRB(ArvLLRB *raiz, struct Iterador<struct NO> *it, int valor, int reverso = 0){
+    iniciaEm_Iterador(it, (raiz == NULL) ? NULL : *raiz, valor, reverso);
+}
+
+//Varredura do intervalo [lo, hi]: chama funcao(chave, info) em ordem crescente. Retorna quantas chaves foram visitadas
+template <class F>
+long long varre_ArvLLRB(ArvLLRB *raiz, int lo, int hi, F funcao){
+    if(raiz == NULL)
+        return 0;
+    return varre_NO(*raiz, lo, hi, funcao);
+}
+
+//Consultas pela chave mais prxima (Comum/ConsultaVizinho.h), em uma descida s
+//Todas retornam 1 se encontraram uma chave e copiam a chave e a informao dela para *chave e *info (que podem ser NULL)
+//Retornam 0 se no existe chave que atenda  condio
+
+//Chave igual a valor. Diferente de consulta_ArvLLRB, devolve tambm a informao guardada
+int busca_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(busca_NO(*raiz, valor), chave, info);
+}
+
+//Troca a informao guardada na chave valor, sem mexer na forma da rvore. Retorna 1 ou 0 (chave no est na rvore)
+int atualiza_ArvLLRB(ArvLLRB *raiz, int valor, int info){
+    if(raiz == NULL)
+        return 0;
+    struct NO* no = busca_NO(*raiz, valor);
+    if(no == NULL)
+        return 0;
+    no->info = info;
+    return 1;
+}
+
+//Menor chave >= valor (lower_bound)
+int limiteInferior_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(primeiroMaior_NO(*raiz, valor, 1), chave, info);
+}
+
+//Menor chave > valor (upper_bound)
+int limiteSuperior_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(primeiroMaior_NO(*raiz, valor, 0), chave, info);
+}
+
+//Maior chave <= valor (floor)
+int piso_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(ultimoMenor_NO(*raiz, valor, 1), chave, info);
+}
+
+//Menor chave >= valor (ceiling). Mesma resposta de limiteInferior_ArvLLRB
+int teto_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    return limiteInferior_ArvLLRB(raiz, valor, chave, info);
+}
+
+//Maior chave < valor (predecessor). valor no precisa estar na rvore
+int antecessor_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(ultimoMenor_NO(*raiz, valor, 0), chave, info);
+}
+
+//Menor chave > valor (successor). Mesma resposta de limiteSuperior_ArvLLRB
+int sucessor_ArvLLRB(ArvLLRB *raiz, int valor, int *chave, int *info){
+    return limiteSuperior_ArvLLRB(raiz, valor, chave, info);
+}
+
+//==================Implementao das rotaes==========================
+//Diferente da AVL, s temos dois tipos de rotao:  esquerda e  direita
+//Dado um conjunto de trs ns, a rotao visa deslocar um n vermelho que esteja  esquerda para  direita e vice-versa
+
+//Rotao  esquerda
+//Apenas rotaciona, no trata a violao de dois filhos vermelhos consecutivos, por exemplo
+struct NO* rotacionaEsquerda(struct NO* A){
+    struct NO* B = A->dir; //N B como filho direito de A
+    A->dir = B->esq; // Mover B para o lugar de A
+    B->esq = A; //A se torna filho esquerdo de B
+    B->cor = A->cor; //B recebe a cor de A
+    A->cor = RED; //Cor de A fica vermelha
+    return B;
+}
+
+//Rotao  direita. No trata outras violaes da LLRB
+struct NO* rotacionaDireita(struct NO* A){
+    struct NO* B = A->esq; //N B como filho esquerdo de A
+    A->esq = B->dir; // Mover B para o lugar de A
+    B->dir = A; //A se torna filho direito de B
+    B->cor = A->cor; //B recebe a cor de A
+    A->cor = RED; //Cor de A fica vermelha
+    return B;
+}
+//Funo auxiliar para retornar a cor do n
+int cor(struct NO* H){
+    if(H == NULL)
+        return BLACK; //Propriedade da rvore Rubro-Negra. Todo n folha (NULL)  preto
+    else
+        return H->cor;
+}
+
+//Funo auxiliar para inverter a cor do pai e de seus filhos
+void trocaCor(struct NO* H){
+    H->cor = !H->cor; //Inverte a cor do pai
+    if(H->esq != NULL) //Inverte a cor do filho da esquerda
+        H->esq->cor = !H->esq->cor;
+    if(H->dir != NULL)//Inverte a cor do filho da direita
+        H->dir->cor = !H->dir->cor;
+}
+
+// Funo auxiliar utilizada na funo insere_ArvLLRB
+// Trata dos seguintes casos:
+//-Se a raiz  NULL: insira o n
+//-Se o valor  menor do que a raiz: v para a subrvore  esquerda
+//-Se o valor  maior que a raiz: v para a subrvore  direita
+//Aplique o mtodo recursivamente
+//Ao voltar na recursso, verificar as propriedades de cada subrvore e aplicar as rotaes ou mudana de cor
+//necessrias caso alguma propriedade foi violada
+struct NO* insereNO(struct NO* H, int chave, int valor, int *resp, Alocador<struct NO>* aloc){
+    if(H == NULL){ //vore vazia ou estou em um n folha
+        struct NO *novo; //Crio o novo n
+        novo = aloca_NO(aloc); //Alocao de memria (malloc ou arena)
+        if(novo == NULL){ //Verificao da alocao de memria
+            *resp = 0;
+            return NULL;
+        }
+        //Preenche o novo n com as informaes
+        novo->info = valor;
+        novo->chave = chave;
+        novo->cor = RED; //Novo n  sempre vermelho
+        novo->dir = NULL; //Como  um n folha, esq=NULL e dir=NULL
+        novo->esq = NULL;
+        *resp = 1; //Deu certo a insero
+        return novo;
+    }
+
+    if(chave == H->chave)
+        *resp = 0;// Valor duplicado. No faz nada e informa que no deu certo a insero
+    else{
+        if(chave < H->chave)
+            H->esq = insereNO(H->esq,chave,valor,resp,aloc); //Valor  menor que o pai, vou pra subrvore da esquerda
+        else
+            H->dir = insereNO(H->dir,chave,valor,resp,aloc); //Valor  maior que o pai, vou pra subrvore da direita
+    }
+
+    //Voltando da recurso verifico se as propriedades da rvore se mantm
+
+    //n vermelho  sempre filho  esquerda (LLRB)
+    if(cor(H->dir) == RED && cor(H->esq) == BLACK)
+        H = rotacionaEsquerda(H); //Rotao  esquerda
+
+    //Filho e Neto so vermelhos
+    //Filho vira pai de 2 ns vermelhos
+    if(cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireita(H); //Rotao  direita
+
+    //2 filhos Vermelhos: troca cor!
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        trocaCor(H); //Troca a cor do pai e dos filhos
+
+    return H;
+}
+
+//Funo de gerenciamento da insero
+int insere_ArvLLRB(ArvLLRB* raiz, int chave, int valor){
+    int resp; //Guarda a resposta da insero passada como parmetro e usada na recurso
+    *raiz = insereNO(*raiz,chave,valor,&resp,alocador_ArvLLRB(raiz)); //Funo responsvel pela busca do local de insero do n
+    if((*raiz) != NULL) //rvore est vazia.
+        (*raiz)->cor = BLACK; //Raiz  sempre preta
+
+    return resp;
+}
+
+//Insero com dica (Comum/Dica.h): desce a partir do ponto do caminho da ltima insero em que a chave cabe,
+//e no a partir da raiz. Com chaves em ordem crescente, a busca custa O(1) amortizado
+//Na subida aplicamos as mesmas correes de insereNO em cada n do caminho, mas paramos em um n preto que no mudou:
+//o pai s olha para os netos quando o filho  vermelho, ento nada muda acima daqui
+//Depois de uma rotao, a parte do caminho abaixo dela deixa de valer e  descartada da dica
+//Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insereDica_ArvLLRB(ArvLLRB* raiz, struct Dica<struct NO> *dica, int chave, int valor){
+    sobe_Dica(dica, chave);
+    ArvLLRB* p = desce_Dica(dica, chave);
+    if(p == NULL)
+        return 0; //Valor duplicado
+    struct NO *novo = aloca_NO(alocador_ArvLLRB(raiz));
+    if(novo == NULL)
+        return 0; //Alocao de memria falhou
+    novo->info = valor;
+    novo->chave = chave;
+    novo->cor = RED; //Novo n  sempre vermelho
+    novo->dir = NULL;
+    novo->esq = NULL;
+    *p = novo;
+
+    int validos = dica->topo; //Nveis da dica que continuam valendo
+    for(int i = dica->topo - 2; i >= 0; i--){ //Volta pelo caminho, a partir do pai do novo n
+        struct NO* H = *(dica->caminho[i]);
+        int mudou = 0;
+        if(cor(H->dir) == RED && cor(H->esq) == BLACK){ //n vermelho  sempre filho  esquerda (LLRB)
+            H = rotacionaEsquerda(H);
+            validos = i + 1;
+            mudou = 1;
+        }
+        if(cor(H->esq) == RED && cor(H->esq->esq) == RED){ //Filho e Neto so vermelhos
+            H = rotacionaDireita(H);
+            validos = i + 1;
+            mudou = 1;
+        }
+        if(cor(H->esq) == RED && cor(H->dir) == RED){ //2 filhos Vermelhos: troca cor!
+            trocaCor(H);
+            mudou = 1;
+        }
+        *(dica->caminho[i]) = H;
+        if(!mudou && H->cor == BLACK)
+            break;
+    }
+    dica->topo = validos;
+    (*raiz)->cor = BLACK; //Raiz  sempre preta
+    return 1;
+}
+
+//Funes auxiliares da construo a partir de um vetor ordenado
+//No basta pegar o elemento do meio e pintar de vermelho o ltimo nvel: um n poderia ficar com dois filhos vermelhos
+//ou com um filho vermelho  direita. Por isso montamos diretamente uma rvore 2-3 com todas as folhas na mesma altura
+//e a escrevemos como LLRB: n de um valor = n preto; n de dois valores = n preto com filho esquerdo vermelho
+
+//Pega o prximo n: do vetor contguo (arena) ou do alocador
+struct NO* proximoNO_Constroi(struct NO* nos, int *usados, Alocador<struct NO>* aloc, int *ok){
+    struct NO* novo;
+    if(nos != NULL)
+        novo = &nos[(*usados)++];
+    else
+        novo = aloca_NO(aloc);
+    if(novo == NULL)
+        *ok = 0; //Alocao de memria falhou
+    return novo;
+}
+
+//Cria a subrvore 2-3 de altura h com os elementos ini..fim
+//Uma rvore 2-3 de altura h tem entre 2^h - 1 (s ns de um valor) e 2*(2^h - 1) elementos (s ns de dois valores)
+//Se os elementos cabem em um n de um valor com 2 filhos, usamos ele; seno, um n de dois valores com 3 filhos
+//Os elementos so divididos igualmente entre os filhos. Cada elemento  visitado uma vez: O(N)
+struct NO* constroi_NO(int chaves[], int valores[], int ini, int fim, int h, struct NO* nos, int *usados, Alocador<struct NO>* aloc, int *ok){
+    if(h == 0 || ini > fim)
+        return NULL;
+    int c = fim - ini + 1; //Quantidade de elementos da subrvore
+    int maxFilho = 2 * ((1 << (h - 1)) - 1); //Mximo de elementos em cada subrvore filha
+    if(c - 1 <= 2 * maxFilho){ //N de um valor (preto) com 2 filhos
+        int meio = ini + (c - 1) / 2;
+        struct NO* H = proximoNO_Constroi(nos, usados, aloc, ok);
+        if(H == NULL)
+            return NULL;
+        H->chave = chaves[meio];
+        H->info = valores[meio];
+        H->cor = BLACK;
+        H->esq = constroi_NO(chaves, valores, ini, meio - 1, h - 1, nos, usados, aloc, ok);
+        H->dir = constroi_NO(chaves, valores, meio + 1, fim, h - 1, nos, usados, aloc, ok);
+        return H;
+    }
+    //N de dois valores com 3 filhos: a = ini..m1-1, b = m1+1..m2-1, c = m2+1..fim
+    int resto = c - 2;
+    int m1 = ini + resto / 3;
+    int m2 = m1 + 1 + (resto - resto / 3) / 2;
+    struct NO* H = proximoNO_Constroi(nos, usados, aloc, ok); //Valor maior: n preto
+    if(H == NULL)
+        return NULL;
+    H->chave = chaves[m2];
+    H->info = valores[m2];
+    H->cor = BLACK;
+    H->esq = NULL;
+    H->dir = NULL;
+    struct NO* E = proximoNO_Constroi(nos, usados, aloc, ok); //Valor menor: filho esquerdo vermelho
+    if(E == NULL)
+        return H;
+    E->chave = chaves[m1];
+    E->info = valores[m1];
+    E->cor = RED;
+    H->esq = E;
+    E->esq = constroi_NO(chaves, valores, ini, m1 - 1, h - 1, nos, usados, aloc, ok);
+    E->dir = constroi_NO(chaves, valores, m1 + 1, m2 - 1, h - 1, nos, usados, aloc, ok);
+    H->dir = constroi_NO(chaves, valores, m2 + 1, fim, h - 1, nos, usados, aloc, ok);
+    return H;
+}
+
+//Constri a rvore de uma vez a partir de chaves em ordem crescente (sem repetio), em tempo O(N)
+//Inserir N chaves em ordem custa O(N log N) e faz rotaes e trocas de cor a cada insero
+//Na arena, todos os ns so alocados em um nico trecho contguo
+//A rvore precisa estar vazia. Retorna 1 se deu certo ou 0 (rvore no vazia, chaves fora de ordem ou falta de memria)
+int carregaOrdenado_ArvLLRB(ArvLLRB *raiz, int chaves[], int valores[], int n){
+    if(raiz == NULL || *raiz != NULL)
+        return 0;
+    for(int i = 1; i < n; i++)
+        if(chaves[i-1] >= chaves[i])
+            return 0; //Chaves fora de ordem ou repetidas
+    int h = 0; //Altura da rvore 2-3: maior h com 2^h - 1 <= n
+    while(((2LL << h) - 1) <= n)
+        h++;
+    Alocador<struct NO>* aloc = alocador_ArvLLRB(raiz);
+    struct NO* nos = alocaContiguo_Alocador(aloc, n); //NULL no modo malloc
+    int usados = 0, ok = 1;
+    *raiz = constroi_NO(chaves, valores, 0, n - 1, h, nos, &usados, aloc, &ok);
+    if(!ok){ //Desfaz o que foi construdo
+        if(aloc->modo == ALOCA_MALLOC)
+            libera_NO(*raiz);
+        *raiz = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+//Temos necessidade de outras 3 funes (alm das rotaes) para restabelecer o balanceamento da rvore
+// e garantir que suas propriedades sejam respeitadas:
+//-Mover um n vermelho para a esquerda
+//-Mover um n vermelho para a direita
+//-Arrumar o balanceamento
+
+//Funo auxiliar usada no rebalanceamento da rvore
+//Trata 3 situaes:
+//- Se o filho direito  vermelho: rotao  esquerda
+//- Se o filho esquerdo e o neto da esquerda so vermelhos: rotao  direita
+//- Se ambos os filhos so vermelhos: trocar a cor do pai e dos filhos
+struct NO* balancear(struct NO* H){
+    if(cor(H->dir) == RED)//n vermelho  sempre filho  esquerda
+        H = rotacionaEsquerda(H);
+
+    //Filho da esquerda e neto da esquerda so vermelhos
+    if(H->esq != NULL && cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireita(H);
+
+    //2 filhos Vermelhos: troca cor!
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        trocaCor(H);
+    return H;
+}
+
+//Funo auxiliar para mover um n vermelho para a esquerda e restabelecer o balanceamento da rvore
+//Essas funes movimentam um n vermelho para a subrvore esquerda ou direita, dependendo da situao em que se encontra
+struct NO* move2EsqRED(struct NO* H){
+    trocaCor(H); //Troca a cor do n e dos filhos
+    if(cor(H->dir->esq) == RED){ //Filho a esquerda do filho direito  vermelho
+        H->dir = rotacionaDireita(H->dir); //Aplica rotao  direita no filho direito
+        H = rotacionaEsquerda(H); //Rotao  esquerda no pai e seus filhos
+        trocaCor(H); //Troca a cor do n e dos filhos
+    }
+    return H;
+}
+
+//Funo auxiliar para mover um n vermelho para a direita e restabelecer o balanceamento da rvore
+//Essas funes movimentam um n vermelho para a subrvore esquerda ou direita, dependendo da situao em que se encontra
+struct NO* move2DirRED(struct NO* H){
+    trocaCor(H); //Troca a cor do n e dos filhos
+    if(cor(H->esq->esq) == RED){ //Filho a esquerda do filho esquerdo  vermelho
+        H = rotacionaDireita(H); //Aplicar rotao  direita no pai
+        trocaCor(H);//Troca a cor do n e dos filhos
+    }
+    return H;
+}
+
+//Remoo
+// Existem 3 tipos de remoo:
+//- N folha (sem filhos)
+//- N com 1 filho
+//- N com 2 filhos
+//Ao voltar na recurso, verificar as propriedades de cada subrvore e aplicar as rotaes e mudanas de cor necessrias
+
+struct NO* removerMenor(struct NO* H, Alocador<struct NO>* aloc){
+    if(H->esq == NULL){ //No tem filho  esquerda
+        desaloca_NO(aloc, H); //Devolve o n ao alocador
+        return NULL;
+    }
+    if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+        H = move2EsqRED(H);
+
+    H->esq = removerMenor(H->esq, aloc); //Indo pra esquerda
+    return balancear(H);
+}
+
+// Funo auxiliar que procura pelo n mais a esquerda (que  o menor n)
+struct NO* procuraMenor(struct NO* atual){
+    struct NO *no1 = atual;
+    struct NO *no2 = atual->esq;
+    while(no2 != NULL){
+        no1 = no2;
+        no2 = no2->esq;
+    }
+    return no1;
+}
+
+//Funo responsvel pela busca do n a ser removido
+struct NO* remove_NO(struct NO* H, int valor, Alocador<struct NO>* aloc){
+    if(valor < H->chave){ //Valor a ser removido  menor que o valor do pai?
+        if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+            H = move2EsqRED(H); //Move para esquerda
+
+        H->esq = remove_NO(H->esq, valor, aloc); //Vou para a subrvore da esquerda
+    }else{
+        if(cor(H->esq) == RED) //No esquerdo  vermelho,
+            H = rotacionaDireita(H);
+
+        if(valor == H->chave && (H->dir == NULL)){ //N folha. S remove o n
+            desaloca_NO(aloc, H); //Devolve o n ao alocador
+            return NULL;
+        }
+
+        if(cor(H->dir) == BLACK && cor(H->dir->esq) == BLACK)
+            H = move2DirRED(H); //Move para direita
+
+        if(valor == H->chave){
+            struct NO* x = procuraMenor(H->dir); //Menor n da subrvore da direita
+            H->chave = x->chave; //Troco de lugar com o n H
+            H->info = x->info; //A informao vai junto com a chave
+            H->dir = removerMenor(H->dir, aloc); //Remove o menor
+        }else
+            H->dir = remove_NO(H->dir, valor, aloc);
+    }
+    return balancear(H); //Antes de voltar na recurso, devemos balancear a rvore
+}
+
+//Funo de gerenciamento da remoo
+int remove_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(consulta_ArvLLRB(raiz,valor)){ //Verifica primeiro se existe o elemento a ser removido na rvore
+        struct NO* h = *raiz;
+        *raiz = remove_NO(h,valor,alocador_ArvLLRB(raiz)); //Funo responsvel pela busca do n a ser removido
+        if(*raiz != NULL)
+            (*raiz)->cor = BLACK; //Raiz deve ser preta
+        return 1; //Deu certo
+    }else
+        return 0; //Deu errado
+}
+
+//Imprime um percurso em-ordem para testes
+void emOrdem_ArvLLRB(ArvLLRB *raiz, int H){
+    if(raiz == NULL)
+        return;
+
+    if(*raiz != NULL){
+        emOrdem_ArvLLRB(&((*raiz)->esq),H+1);
+
+        if((*raiz)->cor == RED)
+            printf("R - Chave %d: - Valor: %d\n\n",(*raiz)->chave,(*raiz)->info);
+        else
+            printf("B - Chave %d: - Valor: %d\n\n",(*raiz)->chave,(*raiz)->info);
+
+        emOrdem_ArvLLRB(&((*raiz)->dir),H+1);
+    }
+}
+
+//Operaes da LLRB reunidas em uma struct, para as estruturas que recebem a rvore como parmetro de template (Comum/Particionado.h)
+struct MotorLLRB{
+    typedef ArvLLRB Arvore;
+    static ArvLLRB* cria(int modo){ return cria_ArvLLRB(modo); }
+    static void libera(ArvLLRB *raiz){ libera_ArvLLRB(raiz); }
+    static int insere(ArvLLRB *raiz, int chave, int valor){ return insere_ArvLLRB(raiz, chave, valor); }
+    static int consulta(ArvLLRB *raiz, int valor){ return consulta_ArvLLRB(raiz, valor); }
+    static int remove(ArvLLRB *raiz, int valor){ return remove_ArvLLRB(raiz, valor); }
+    static int atualiza(ArvLLRB *raiz, int chave, int valor){ return atualiza_ArvLLRB(raiz, chave, valor); }
+    template <class F>
+    static long long varre(ArvLLRB *raiz, int lo, int hi, F funcao){ return varre_ArvLLRB(raiz, lo, hi, funcao); }
+};
+
+#endif
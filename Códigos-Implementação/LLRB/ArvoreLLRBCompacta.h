@@ -0,0 +1,323 @@
+#ifndef ARVORELLRBCOMPACTA_H
+#define ARVORELLRBCOMPACTA_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+//Verso compacta da LLRB
+//Na ArvoreLLRB.h cada n tem dois ponteiros de 64 bits, info, chave e cor: com o alinhamento so 32 bytes para 8 bytes de dados
+//Aqui todos os ns ficam em um nico vetor contguo e os filhos so ndices de 32 bits dentro desse vetor
+//A cor ocupa s o bit mais alto do ndice do filho esquerdo
+//Assim cada n ocupa 16 bytes e cabem 4 ns em uma linha de cache (contra 2 na verso com ponteiros)
+//Os algoritmos so os mesmos da ArvoreLLRB.h, trocando ponteiros por ndices
+//O ndice 0 no  usado e faz o papel do NULL (que  preto)
+
+#define NULO_LLRBC 0u //ndice 0 equivale ao ponteiro NULL
+#define BIT_COR_LLRBC 0x80000000u //Bit ligado = n vermelho
+#define INDICE_LLRBC 0x7FFFFFFFu //Bits usados para o ndice do filho (at 2^31 - 1 ns)
+
+//Definio do n compacto
+struct NOLLRBCompacto{
+    int info; //Informao propriamente dita
+    int chave; //Chave associada  informao
+    uint32_t esq; //ndice do filho esquerdo + bit da cor do n
+    uint32_t dir; //ndice do filho direito
+};
+
+static_assert(sizeof(struct NOLLRBCompacto) == 16, "O no compacto deve ter 16 bytes");
+
+//A rvore  o vetor de ns mais o ndice da raiz
+struct ArvLLRBCompacta{
+    struct NOLLRBCompacto *nos; //Vetor contguo com todos os ns
+    uint32_t raiz; //ndice da raiz
+    uint32_t usados; //Prximo ndice ainda no usado do vetor
+    uint32_t capacidade; //Tamanho do vetor
+    uint32_t livres; //Lista de ns removidos, encadeada pelo campo dir
+};
+
+//Funes auxiliares para ler e escrever os filhos sem perder o bit da cor
+inline uint32_t esq_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){ return a->nos[H].esq & INDICE_LLRBC; }
+inline uint32_t dir_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){ return a->nos[H].dir; }
+inline void setaEsq_LLRBC(struct ArvLLRBCompacta *a, uint32_t H, uint32_t filho){ a->nos[H].esq = (a->nos[H].esq & BIT_COR_LLRBC) | filho; }
+inline void setaDir_LLRBC(struct ArvLLRBCompacta *a, uint32_t H, uint32_t filho){ a->nos[H].dir = filho; }
+
+//Funo auxiliar para retornar a cor do n. Todo n folha (NULO)  preto
+inline int cor_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    if(H == NULO_LLRBC)
+        return 0; //BLACK
+    return (a->nos[H].esq & BIT_COR_LLRBC) ? 1 : 0;
+}
+
+//Grava a cor do n (1 = vermelho, 0 = preto)
+inline void setaCor_LLRBC(struct ArvLLRBCompacta *a, uint32_t H, int cor){
+    a->nos[H].esq = (a->nos[H].esq & INDICE_LLRBC) | (cor ? BIT_COR_LLRBC : 0u);
+}
+
+//Cria a rvore vazia. capacidade  uma estimativa do nmero de ns (o vetor cresce sozinho se precisar)
+struct ArvLLRBCompacta* cria_ArvLLRBCompacta(uint32_t capacidade = 1024){
+    struct ArvLLRBCompacta *a = (struct ArvLLRBCompacta*) malloc(sizeof(struct ArvLLRBCompacta));
+    if(a == NULL) //Erro na alocao de memria
+        return NULL;
+    if(capacidade < 2)
+        capacidade = 2;
+    a->nos = (struct NOLLRBCompacto*) malloc(capacidade * sizeof(struct NOLLRBCompacto));
+    if(a->nos == NULL){
+        free(a);
+        return NULL;
+    }
+    a->nos[0].info = a->nos[0].chave = 0; //N 0 zerado: ler os filhos ou a cor do "NULL" no causa problema
+    a->nos[0].esq = a->nos[0].dir = NULO_LLRBC;
+    a->raiz = NULO_LLRBC;
+    a->usados = 1; //ndice 0 reservado para o NULL
+    a->capacidade = capacidade;
+    a->livres = NULO_LLRBC;
+    return a;
+}
+
+//Liberar toda a rvore: basta liberar o vetor de ns
+void libera_ArvLLRBCompacta(struct ArvLLRBCompacta *a){
+    if(a == NULL)
+        return;
+    free(a->nos);
+    free(a);
+}
+
+//Memria ocupada pelos ns, em bytes (usado para calcular bytes por n nos testes)
+size_t memoria_ArvLLRBCompacta(struct ArvLLRBCompacta *a){
+    return (size_t) a->capacidade * sizeof(struct NOLLRBCompacto);
+}
+
+//Retorna o ndice de um n novo, ou NULO_LLRBC se a alocao falhou
+//Cuidado: o vetor pode mudar de lugar (realloc), ento ningum deve guardar ponteiros para ns durante uma insero
+uint32_t alocaNO_LLRBC(struct ArvLLRBCompacta *a){
+    if(a->livres != NULO_LLRBC){ //Reaproveita um n removido
+        uint32_t H = a->livres;
+        a->livres = a->nos[H].dir;
+        return H;
+    }
+    if(a->usados == a->capacidade){ //Vetor cheio, dobra o tamanho
+        if(a->capacidade > INDICE_LLRBC / 2)
+            return NULO_LLRBC;
+        struct NOLLRBCompacto *novos = (struct NOLLRBCompacto*) realloc(a->nos, 2 * (size_t) a->capacidade * sizeof(struct NOLLRBCompacto));
+        if(novos == NULL)
+            return NULO_LLRBC;
+        a->nos = novos;
+        a->capacidade = 2 * a->capacidade;
+    }
+    return a->usados++;
+}
+
+//A consulta  idntica a uma rvore Binria, trocando os ponteiros por ndices
+int consulta_ArvLLRBCompacta(struct ArvLLRBCompacta *a, int valor){
+    if(a == NULL)
+        return 0;
+    uint32_t atual = a->raiz;
+    while(atual != NULO_LLRBC){
+        if(valor == a->nos[atual].chave) //Valor procurado est no n atual
+            return 1; //Encontrou
+        if(valor > a->nos[atual].chave)
+            atual = dir_LLRBC(a, atual);
+        else
+            atual = esq_LLRBC(a, atual);
+    }
+    return 0; //No encontrou
+}
+
+//Imprime um percurso em-ordem para testes
+void emOrdem_NOLLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    if(H == NULO_LLRBC)
+        return;
+    emOrdem_NOLLRBC(a, esq_LLRBC(a, H));
+    if(cor_LLRBC(a, H))
+        printf("R - Chave %d: - Valor: %d\n\n", a->nos[H].chave, a->nos[H].info);
+    else
+        printf("B - Chave %d: - Valor: %d\n\n", a->nos[H].chave, a->nos[H].info);
+    emOrdem_NOLLRBC(a, dir_LLRBC(a, H));
+}
+
+void emOrdem_ArvLLRBCompacta(struct ArvLLRBCompacta *a){
+    if(a == NULL)
+        return;
+    emOrdem_NOLLRBC(a, a->raiz);
+}
+
+//==================Implementao das rotaes==========================
+
+//Rotao  esquerda. Retorna a nova raiz da subrvore
+uint32_t rotacionaEsquerda_LLRBC(struct ArvLLRBCompacta *a, uint32_t A){
+    uint32_t B = dir_LLRBC(a, A); //N B como filho direito de A
+    setaDir_LLRBC(a, A, esq_LLRBC(a, B)); // Mover B para o lugar de A
+    setaEsq_LLRBC(a, B, A); //A se torna filho esquerdo de B
+    setaCor_LLRBC(a, B, cor_LLRBC(a, A)); //B recebe a cor de A
+    setaCor_LLRBC(a, A, 1); //Cor de A fica vermelha
+    return B;
+}
+
+//Rotao  direita. Retorna a nova raiz da subrvore
+uint32_t rotacionaDireita_LLRBC(struct ArvLLRBCompacta *a, uint32_t A){
+    uint32_t B = esq_LLRBC(a, A); //N B como filho esquerdo de A
+    setaEsq_LLRBC(a, A, dir_LLRBC(a, B)); // Mover B para o lugar de A
+    setaDir_LLRBC(a, B, A); //A se torna filho direito de B
+    setaCor_LLRBC(a, B, cor_LLRBC(a, A)); //B recebe a cor de A
+    setaCor_LLRBC(a, A, 1); //Cor de A fica vermelha
+    return B;
+}
+
+//Funo auxiliar para inverter a cor do pai e de seus filhos
+void trocaCor_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    a->nos[H].esq ^= BIT_COR_LLRBC; //Inverte a cor do pai
+    uint32_t e = esq_LLRBC(a, H), d = dir_LLRBC(a, H);
+    if(e != NULO_LLRBC)
+        a->nos[e].esq ^= BIT_COR_LLRBC;
+    if(d != NULO_LLRBC)
+        a->nos[d].esq ^= BIT_COR_LLRBC;
+}
+
+//Mesmos 3 casos da funo balancear da ArvoreLLRB.h
+uint32_t balancear_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    if(cor_LLRBC(a, dir_LLRBC(a, H))) //n vermelho  sempre filho  esquerda
+        H = rotacionaEsquerda_LLRBC(a, H);
+
+    uint32_t e = esq_LLRBC(a, H);
+    if(e != NULO_LLRBC && cor_LLRBC(a, e) && cor_LLRBC(a, esq_LLRBC(a, e))) //Filho da esquerda e neto da esquerda so vermelhos
+        H = rotacionaDireita_LLRBC(a, H);
+
+    if(cor_LLRBC(a, esq_LLRBC(a, H)) && cor_LLRBC(a, dir_LLRBC(a, H))) //2 filhos Vermelhos: troca cor!
+        trocaCor_LLRBC(a, H);
+    return H;
+}
+
+//Insero recursiva, igual  insereNO da ArvoreLLRB.h
+uint32_t insereNO_LLRBC(struct ArvLLRBCompacta *a, uint32_t H, int chave, int valor, int *resp){
+    if(H == NULO_LLRBC){ //rvore vazia ou estou em um n folha
+        uint32_t novo = alocaNO_LLRBC(a);
+        if(novo == NULO_LLRBC){ //Alocao de memria falhou
+            *resp = 0;
+            return NULO_LLRBC;
+        }
+        a->nos[novo].info = valor;
+        a->nos[novo].chave = chave;
+        a->nos[novo].esq = BIT_COR_LLRBC | NULO_LLRBC; //Novo n  sempre vermelho
+        a->nos[novo].dir = NULO_LLRBC;
+        *resp = 1;
+        return novo;
+    }
+
+    if(chave == a->nos[H].chave)
+        *resp = 0; // Valor duplicado
+    else if(chave < a->nos[H].chave){
+        uint32_t filho = insereNO_LLRBC(a, esq_LLRBC(a, H), chave, valor, resp);
+        setaEsq_LLRBC(a, H, filho); //Depois da chamada, o vetor pode ter mudado de lugar
+    }else{
+        uint32_t filho = insereNO_LLRBC(a, dir_LLRBC(a, H), chave, valor, resp);
+        setaDir_LLRBC(a, H, filho);
+    }
+
+    //n vermelho  sempre filho  esquerda
+    if(cor_LLRBC(a, dir_LLRBC(a, H)) && !cor_LLRBC(a, esq_LLRBC(a, H)))
+        H = rotacionaEsquerda_LLRBC(a, H);
+
+    //Filho e Neto so vermelhos
+    if(cor_LLRBC(a, esq_LLRBC(a, H)) && cor_LLRBC(a, esq_LLRBC(a, esq_LLRBC(a, H))))
+        H = rotacionaDireita_LLRBC(a, H);
+
+    //2 filhos Vermelhos: troca cor!
+    if(cor_LLRBC(a, esq_LLRBC(a, H)) && cor_LLRBC(a, dir_LLRBC(a, H)))
+        trocaCor_LLRBC(a, H);
+
+    return H;
+}
+
+//Funo de gerenciamento da insero
+int insere_ArvLLRBCompacta(struct ArvLLRBCompacta *a, int chave, int valor){
+    int resp;
+    a->raiz = insereNO_LLRBC(a, a->raiz, chave, valor, &resp);
+    if(a->raiz != NULO_LLRBC)
+        setaCor_LLRBC(a, a->raiz, 0); //Raiz  sempre preta
+    return resp;
+}
+
+//Move um n vermelho para a esquerda
+uint32_t move2EsqRED_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    trocaCor_LLRBC(a, H);
+    if(cor_LLRBC(a, esq_LLRBC(a, dir_LLRBC(a, H)))){ //Filho a esquerda do filho direito  vermelho
+        setaDir_LLRBC(a, H, rotacionaDireita_LLRBC(a, dir_LLRBC(a, H)));
+        H = rotacionaEsquerda_LLRBC(a, H);
+        trocaCor_LLRBC(a, H);
+    }
+    return H;
+}
+
+//Move um n vermelho para a direita
+uint32_t move2DirRED_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    trocaCor_LLRBC(a, H);
+    if(cor_LLRBC(a, esq_LLRBC(a, esq_LLRBC(a, H)))){ //Filho a esquerda do filho esquerdo  vermelho
+        H = rotacionaDireita_LLRBC(a, H);
+        trocaCor_LLRBC(a, H);
+    }
+    return H;
+}
+
+//Devolve o n para a lista de livres
+void liberaNO_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    a->nos[H].dir = a->livres;
+    a->livres = H;
+}
+
+uint32_t removerMenor_LLRBC(struct ArvLLRBCompacta *a, uint32_t H){
+    if(esq_LLRBC(a, H) == NULO_LLRBC){ //No tem filho  esquerda
+        liberaNO_LLRBC(a, H);
+        return NULO_LLRBC;
+    }
+    if(!cor_LLRBC(a, esq_LLRBC(a, H)) && !cor_LLRBC(a, esq_LLRBC(a, esq_LLRBC(a, H))))
+        H = move2EsqRED_LLRBC(a, H);
+
+    setaEsq_LLRBC(a, H, removerMenor_LLRBC(a, esq_LLRBC(a, H)));
+    return balancear_LLRBC(a, H);
+}
+
+//Funo responsvel pela busca do n a ser removido, igual  remove_NO da ArvoreLLRB.h
+uint32_t removeNO_LLRBC(struct ArvLLRBCompacta *a, uint32_t H, int valor){
+    if(valor < a->nos[H].chave){
+        if(!cor_LLRBC(a, esq_LLRBC(a, H)) && !cor_LLRBC(a, esq_LLRBC(a, esq_LLRBC(a, H))))
+            H = move2EsqRED_LLRBC(a, H);
+
+        setaEsq_LLRBC(a, H, removeNO_LLRBC(a, esq_LLRBC(a, H), valor));
+    }else{
+        if(cor_LLRBC(a, esq_LLRBC(a, H))) //N esquerdo  vermelho
+            H = rotacionaDireita_LLRBC(a, H);
+
+        if(valor == a->nos[H].chave && dir_LLRBC(a, H) == NULO_LLRBC){ //N folha. S remove o n
+            liberaNO_LLRBC(a, H);
+            return NULO_LLRBC;
+        }
+
+        if(!cor_LLRBC(a, dir_LLRBC(a, H)) && !cor_LLRBC(a, esq_LLRBC(a, dir_LLRBC(a, H))))
+            H = move2DirRED_LLRBC(a, H);
+
+        if(valor == a->nos[H].chave){
+            uint32_t x = dir_LLRBC(a, H); //Menor n da subrvore da direita
+            while(esq_LLRBC(a, x) != NULO_LLRBC)
+                x = esq_LLRBC(a, x);
+            a->nos[H].chave = a->nos[x].chave; //Troco de lugar com o n H
+            a->nos[H].info = a->nos[x].info;
+            setaDir_LLRBC(a, H, removerMenor_LLRBC(a, dir_LLRBC(a, H)));
+        }else
+            setaDir_LLRBC(a, H, removeNO_LLRBC(a, dir_LLRBC(a, H), valor));
+    }
+    return balancear_LLRBC(a, H);
+}
+
+//Funo de gerenciamento da remoo
+int remove_ArvLLRBCompacta(struct ArvLLRBCompacta *a, int valor){
+    if(consulta_ArvLLRBCompacta(a, valor)){ //Verifica primeiro se existe o elemento a ser removido na rvore
+        a->raiz = removeNO_LLRBC(a, a->raiz, valor);
+        if(a->raiz != NULO_LLRBC)
+            setaCor_LLRBC(a, a->raiz, 0); //Raiz deve ser preta
+        return 1;
+    }
+    return 0;
+}
+
+#endif
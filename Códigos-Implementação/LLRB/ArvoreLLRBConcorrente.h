@@ -0,0 +1,263 @@
+#ifndef ARVORELLRBCONCORRENTE_H
+#define ARVORELLRBCONCORRENTE_H
+
+#include "ArvoreLLRB.h"
+#include "../Comum/Epoca.h" //Recuperao dos ns removidos por pocas
+
+//LLRB com um escritor e vrios leitores
+//Os leitores buscam sem trava nenhuma (consultaLeitor_ArvLLRB), enquanto uma nica thread insere e remove
+//(insereEscritor_ArvLLRB e removeEscritor_ArvLLRB). Se houver mais de uma thread alterando, elas precisam de uma trava entre si
+//O escritor no altera ns que j esto na rvore: antes de cada rotao ou troca de cor, os ns alterados so copiados
+//(Comum/Epoca.h). A nova verso  montada ao lado e a nova raiz  publicada de uma vez
+//Cada leitor v ou a rvore antiga inteira ou a nova inteira
+//Os ns que saem da rvore (remove_NO e removerMenor) s voltam ao alocador quando nenhum leitor pode mais estar neles
+//A rvore s pode ser alterada pelas funes do escritor
+
+//Cabealho: comea igual ao da LLRB, ento alocador_ArvLLRB continua funcionando
+struct CabecaArvLLRBConcorrente{
+    struct NO* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns dessa rvore
+    struct Epoca<struct NO> ep; //pocas dos leitores e ns esperando para ser liberados
+};
+
+struct Epoca<struct NO>* epoca_ArvLLRB(ArvLLRB* raiz){
+    return &((struct CabecaArvLLRBConcorrente*) raiz)->ep;
+}
+
+//Cria a rvore vazia para uso concorrente
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvLLRB* criaConcorrente_ArvLLRB(int modo = ALOCA_MALLOC){
+    size_t tam = sizeof(struct CabecaArvLLRBConcorrente); //Mltiplo de 64 por causa dos lugares dos leitores
+    struct CabecaArvLLRBConcorrente* cab = (struct CabecaArvLLRBConcorrente*) aligned_alloc(alignof(struct CabecaArvLLRBConcorrente), tam);
+    if(cab == NULL)
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    if(!inicia_Epoca(&cab->ep, &cab->aloc)){
+        free(cab);
+        return NULL;
+    }
+    return &cab->raiz;
+}
+
+//Libera a rvore. Nenhum leitor pode estar ativo
+void liberaConcorrente_ArvLLRB(ArvLLRB* raiz){
+    if(raiz == NULL)
+        return;
+    libera_Epoca(epoca_ArvLLRB(raiz));
+    Alocador<struct NO>* aloc = alocador_ArvLLRB(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);
+    else
+        libera_NO(*raiz);
+    free(raiz);
+}
+
+//Cada thread leitora pede o seu nmero uma vez e o passa em todas as consultas. Retorna -1 se no h mais lugares
+int registraLeitor_ArvLLRB(ArvLLRB* raiz){
+    return registraLeitor_Epoca(epoca_ArvLLRB(raiz));
+}
+
+//Consulta sem trava, feita por uma thread leitora
+//A poca  anotada antes de ler a raiz e desmarcada no fim: enquanto isso nenhum n que o leitor pode ver  liberado
+int consultaLeitor_ArvLLRB(ArvLLRB *raiz, int leitor, int valor){
+    struct Epoca<struct NO>* e = epoca_ArvLLRB(raiz);
+    entra_Epoca(e, leitor);
+    struct NO* atual = __atomic_load_n(raiz, __ATOMIC_SEQ_CST);
+    int res = 0;
+    while(atual != NULL){
+        if(valor == atual->chave){
+            res = 1; //Encontrou
+            break;
+        }
+        if(valor > atual->chave)
+            atual = atual->dir;
+        else
+            atual = atual->esq;
+    }
+    sai_Epoca(e, leitor);
+    return res;
+}
+
+//==================Rotaes e troca de cor com cpia==========================
+//Copiam os ns que rotacionaEsquerda, rotacionaDireita e trocaCor alteram e depois chamam essas funes
+//Se faltar memria, as cpias so o n lixo da poca: a atualizao  cancelada no fim e nada publicado  alterado
+
+struct NO* rotacionaEsquerdaEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    H = escreve_Epoca(e, H);
+    H->dir = escreve_Epoca(e, H->dir);
+    return rotacionaEsquerda(H);
+}
+
+struct NO* rotacionaDireitaEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    H = escreve_Epoca(e, H);
+    H->esq = escreve_Epoca(e, H->esq);
+    return rotacionaDireita(H);
+}
+
+struct NO* trocaCorEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    H = escreve_Epoca(e, H);
+    if(H->esq != NULL)
+        H->esq = escreve_Epoca(e, H->esq);
+    if(H->dir != NULL)
+        H->dir = escreve_Epoca(e, H->dir);
+    trocaCor(H);
+    return H;
+}
+
+//Mesmas funes de rebalanceamento da LLRB, usando as verses com cpia
+struct NO* balancearEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    if(cor(H->dir) == RED)
+        H = rotacionaEsquerdaEscritor(H, e);
+    if(H->esq != NULL && cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireitaEscritor(H, e);
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        H = trocaCorEscritor(H, e);
+    return H;
+}
+
+struct NO* move2EsqREDEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    H = trocaCorEscritor(H, e);
+    if(cor(H->dir->esq) == RED){
+        H->dir = rotacionaDireitaEscritor(H->dir, e);
+        H = rotacionaEsquerdaEscritor(H, e);
+        H = trocaCorEscritor(H, e);
+    }
+    return H;
+}
+
+struct NO* move2DirREDEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    H = trocaCorEscritor(H, e);
+    if(cor(H->esq->esq) == RED){
+        H = rotacionaDireitaEscritor(H, e);
+        H = trocaCorEscritor(H, e);
+    }
+    return H;
+}
+
+//==================Insero e remoo com cpia==========================
+//Mesma lgica de insereNO, removerMenor e remove_NO. Os ns que saem da rvore vo para a poca (descarta_Epoca)
+//Todas param assim que falta memria (e->falhou): o que foi montado at ali  descartado
+
+struct NO* insereEscritor_NO(struct NO* H, int chave, int valor, int *resp, struct Epoca<struct NO>* e){
+    if(e->falhou)
+        return H;
+    if(H == NULL){
+        struct NO* novo = novo_Epoca(e);
+        novo->info = valor;
+        novo->chave = chave;
+        novo->cor = RED; //Novo n  sempre vermelho
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *resp = 1;
+        return novo;
+    }
+    if(chave == H->chave){
+        *resp = 0; //Valor duplicado: a subrvore no muda
+        return H;
+    }
+    H = escreve_Epoca(e, H);
+    if(chave < H->chave)
+        H->esq = insereEscritor_NO(H->esq, chave, valor, resp, e);
+    else
+        H->dir = insereEscritor_NO(H->dir, chave, valor, resp, e);
+    if(e->falhou || *resp == 0)
+        return H;
+
+    if(cor(H->dir) == RED && cor(H->esq) == BLACK)
+        H = rotacionaEsquerdaEscritor(H, e);
+    if(cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireitaEscritor(H, e);
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        H = trocaCorEscritor(H, e);
+    return H;
+}
+
+struct NO* removerMenorEscritor(struct NO* H, struct Epoca<struct NO>* e){
+    if(e->falhou)
+        return H;
+    if(H->esq == NULL){
+        descarta_Epoca(e, H); //Sai da rvore, mas s volta ao alocador depois das pocas
+        return NULL;
+    }
+    H = escreve_Epoca(e, H);
+    if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+        H = move2EsqREDEscritor(H, e);
+    H->esq = removerMenorEscritor(H->esq, e);
+    if(e->falhou)
+        return H;
+    return balancearEscritor(H, e);
+}
+
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n
+struct NO* removeEscritor_NO(struct NO* H, int valor, struct Epoca<struct NO>* e){
+    if(e->falhou)
+        return H;
+    H = escreve_Epoca(e, H);
+    if(valor < H->chave){
+        if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+            H = move2EsqREDEscritor(H, e);
+        H->esq = removeEscritor_NO(H->esq, valor, e);
+    }else{
+        if(cor(H->esq) == RED)
+            H = rotacionaDireitaEscritor(H, e);
+        if(valor == H->chave && (H->dir == NULL)){
+            descarta_Epoca(e, H);
+            return NULL;
+        }
+        if(cor(H->dir) == BLACK && cor(H->dir->esq) == BLACK)
+            H = move2DirREDEscritor(H, e);
+        if(valor == H->chave){
+            struct NO* x = procuraMenor(H->dir);
+            H->chave = x->chave;
+            H->info = x->info;
+            H->dir = removerMenorEscritor(H->dir, e);
+        }else
+            H->dir = removeEscritor_NO(H->dir, valor, e);
+    }
+    if(e->falhou)
+        return H;
+    return balancearEscritor(H, e);
+}
+
+//Insere pelo escritor. Monta a nova verso da rvore e publica a nova raiz
+//Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insereEscritor_ArvLLRB(ArvLLRB* raiz, int chave, int valor){
+    struct Epoca<struct NO>* e = epoca_ArvLLRB(raiz);
+    int resp = 0;
+    inicia_Atualizacao(e, *raiz); //S o escritor altera a raiz, ento ele pode l-la sem cuidado
+    struct NO* nova = insereEscritor_NO(*raiz, chave, valor, &resp, e);
+    if(!e->falhou && resp == 1 && nova->cor != BLACK){
+        nova = escreve_Epoca(e, nova);
+        nova->cor = BLACK; //Raiz  sempre preta
+    }
+    if(e->falhou || resp == 0){
+        cancela_Atualizacao(e);
+        return 0;
+    }
+    __atomic_store_n(raiz, nova, __ATOMIC_SEQ_CST); //Publica: daqui em diante os leitores pegam a nova raiz
+    confirma_Atualizacao(e);
+    return 1;
+}
+
+//Remove pelo escritor. Retorna 1 se removeu ou 0 (no encontrou ou falta de memria)
+int removeEscritor_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(!consulta_ArvLLRB(raiz, valor)) //No copia nada se a chave no existe
+        return 0;
+    struct Epoca<struct NO>* e = epoca_ArvLLRB(raiz);
+    inicia_Atualizacao(e, *raiz);
+    struct NO* nova = removeEscritor_NO(*raiz, valor, e);
+    if(!e->falhou && nova != NULL && nova->cor != BLACK){
+        nova = escreve_Epoca(e, nova);
+        nova->cor = BLACK; //Raiz deve ser preta
+    }
+    if(e->falhou){
+        cancela_Atualizacao(e);
+        return 0;
+    }
+    __atomic_store_n(raiz, nova, __ATOMIC_SEQ_CST);
+    confirma_Atualizacao(e);
+    return 1;
+}
+
+#endif
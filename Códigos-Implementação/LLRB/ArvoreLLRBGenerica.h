@@ -0,0 +1,298 @@
+#ifndef ARVORELLRBGENERICA_H
+#define ARVORELLRBGENERICA_H
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+#include "../Comum/Chave.h" //Comparao das chaves
+
+//Verso genrica da LLRB
+//Mesma rvore de ArvoreLLRB.h, mas o tipo da chave, o da informao e a comparao so parmetros de template:
+//ArvLLRBGenerica<long long, double>, ArvLLRBGenerica<ChaveFixa<16>, int, ComparaChaveFixa<16> >...
+//Com <int, int> as comparaes so as mesmas da LLRB com int (Comum/Chave.h), ento o desempenho  o mesmo
+//A informao  movida para dentro do n (std::forward), nunca copiada sem necessidade
+//Os ns vm do alocador da rvore e so construdos e destrudos no lugar, ento chave e informao podem ter
+//construtor e destrutor (std::string, std::vector...)
+//Na remoo de um n com 2 filhos, o sucessor  religado no lugar do n, em vez de ter a chave e a informao copiadas
+//As cores RED e BLACK so as mesmas de ArvoreLLRB.h
+
+#ifndef RED
+#define RED 1
+#define BLACK 0
+#endif
+
+template <class Chave, class Valor>
+struct NOLLRBGenerico{
+    Chave chave; //Chave associada  informao
+    Valor info; //Informao propriamente dita
+    struct NOLLRBGenerico *esq; //Filho esquerdo
+    struct NOLLRBGenerico *dir; //Filho direito
+    int cor; //Cor do n
+};
+
+template <class Chave, class Valor, class Compara = std::less<Chave> >
+struct ArvLLRBGenerica{
+    typedef Chave TipoChave;
+    typedef Valor TipoValor;
+    typedef struct NOLLRBGenerico<Chave, Valor> No;
+    No *raiz;
+    Alocador<No> aloc; //De onde saem os ns dessa rvore
+    Compara comp;
+};
+
+//Cria a rvore vazia
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+template <class Chave, class Valor, class Compara = std::less<Chave> >
+struct ArvLLRBGenerica<Chave, Valor, Compara>* cria_ArvLLRBGenerica(int modo = ALOCA_MALLOC, const Compara& comp = Compara()){
+    struct ArvLLRBGenerica<Chave, Valor, Compara>* arv = (struct ArvLLRBGenerica<Chave, Valor, Compara>*) malloc(sizeof(struct ArvLLRBGenerica<Chave, Valor, Compara>));
+    if(arv == NULL) //Erro na alocao de memria
+        return NULL;
+    arv->raiz = NULL;
+    inicia_Alocador(&arv->aloc, modo);
+    new (&arv->comp) Compara(comp);
+    return arv;
+}
+
+//Destri a chave e a informao e devolve o n ao alocador
+template <class No>
+void destroi_LLRBG(Alocador<No>* aloc, No* no){
+    no->~No();
+    desaloca_NO(aloc, no);
+}
+
+//Destri todos os ns da subrvore
+template <class No>
+void libera_LLRBG(Alocador<No>* aloc, No* no){
+    while(no != NULL){
+        libera_LLRBG(aloc, no->esq);
+        No* dir = no->dir;
+        destroi_LLRBG(aloc, no);
+        no = dir;
+    }
+}
+
+//Libera toda a rvore
+//Na arena, se os ns no tm destrutor, os blocos so liberados de uma vez sem visitar os ns
+template <class Chave, class Valor, class Compara>
+void libera_ArvLLRBGenerica(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv){
+    typedef typename ArvLLRBGenerica<Chave, Valor, Compara>::No No;
+    if(arv == NULL)
+        return;
+    if(arv->aloc.modo == ALOCA_ARENA){
+        if(!std::is_trivially_destructible<No>::value)
+            libera_LLRBG(&arv->aloc, arv->raiz); //Chama os destrutores antes de liberar os blocos
+        libera_Alocador(&arv->aloc);
+    }else
+        libera_LLRBG(&arv->aloc, arv->raiz);
+    arv->comp.~Compara();
+    free(arv);
+}
+
+//Busca o n com a chave, ou NULL
+template <class Chave, class Valor, class Compara>
+struct NOLLRBGenerico<Chave, Valor>* procura_LLRBG(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, const Chave& chave){
+    struct NOLLRBGenerico<Chave, Valor>* atual = arv->raiz;
+    while(atual != NULL){
+        int c = compara_Chave(arv->comp, chave, atual->chave);
+        if(c == 0)
+            return atual; //Encontrou
+        if(c > 0) //Se a chave procurada for maior que a do n atual, procurar na subvore direita
+            atual = atual->dir;
+        else
+            atual = atual->esq;
+    }
+    return NULL;
+}
+
+//Retorna 1 se encontrou a chave ou 0 caso contrrio
+template <class Chave, class Valor, class Compara>
+int consulta_ArvLLRBGenerica(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, const typename ArvLLRBGenerica<Chave, Valor, Compara>::TipoChave& chave){
+    if(arv == NULL)
+        return 0;
+    return procura_LLRBG(arv, chave) != NULL;
+}
+
+//Retorna um ponteiro para a informao guardada com a chave (pode ser alterada no lugar), ou NULL se no encontrou
+template <class Chave, class Valor, class Compara>
+Valor* busca_ArvLLRBGenerica(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, const typename ArvLLRBGenerica<Chave, Valor, Compara>::TipoChave& chave){
+    if(arv == NULL)
+        return NULL;
+    struct NOLLRBGenerico<Chave, Valor>* no = procura_LLRBG(arv, chave);
+    return no != NULL ? &no->info : NULL;
+}
+
+//==================Rotaes e cores==========================
+//As mesmas de ArvoreLLRB.h
+
+template <class No>
+No* rotacionaEsquerda_LLRBG(No* A){
+    No* B = A->dir;
+    A->dir = B->esq;
+    B->esq = A;
+    B->cor = A->cor;
+    A->cor = RED;
+    return B;
+}
+
+template <class No>
+No* rotacionaDireita_LLRBG(No* A){
+    No* B = A->esq;
+    A->esq = B->dir;
+    B->dir = A;
+    B->cor = A->cor;
+    A->cor = RED;
+    return B;
+}
+
+template <class No>
+inline int cor_LLRBG(No* H){
+    if(H == NULL)
+        return BLACK; //Todo n folha (NULL)  preto
+    return H->cor;
+}
+
+template <class No>
+void trocaCor_LLRBG(No* H){
+    H->cor = !H->cor;
+    if(H->esq != NULL)
+        H->esq->cor = !H->esq->cor;
+    if(H->dir != NULL)
+        H->dir->cor = !H->dir->cor;
+}
+
+template <class No>
+No* balancear_LLRBG(No* H){
+    if(cor_LLRBG(H->dir) == RED)
+        H = rotacionaEsquerda_LLRBG(H);
+    if(H->esq != NULL && cor_LLRBG(H->esq) == RED && cor_LLRBG(H->esq->esq) == RED)
+        H = rotacionaDireita_LLRBG(H);
+    if(cor_LLRBG(H->esq) == RED && cor_LLRBG(H->dir) == RED)
+        trocaCor_LLRBG(H);
+    return H;
+}
+
+template <class No>
+No* move2EsqRED_LLRBG(No* H){
+    trocaCor_LLRBG(H);
+    if(cor_LLRBG(H->dir->esq) == RED){
+        H->dir = rotacionaDireita_LLRBG(H->dir);
+        H = rotacionaEsquerda_LLRBG(H);
+        trocaCor_LLRBG(H);
+    }
+    return H;
+}
+
+template <class No>
+No* move2DirRED_LLRBG(No* H){
+    trocaCor_LLRBG(H);
+    if(cor_LLRBG(H->esq->esq) == RED){
+        H = rotacionaDireita_LLRBG(H);
+        trocaCor_LLRBG(H);
+    }
+    return H;
+}
+//==================================================
+
+//Mesma insero de insereNO. A informao s  construda (movida) se a chave ainda no existe
+template <class Chave, class Valor, class Compara, class V>
+struct NOLLRBGenerico<Chave, Valor>* insere_LLRBG(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, struct NOLLRBGenerico<Chave, Valor>* H, const Chave& chave, V&& valor, int *resp){
+    typedef struct NOLLRBGenerico<Chave, Valor> No;
+    if(H == NULL){
+        No *novo = aloca_NO(&arv->aloc);
+        if(novo == NULL){
+            *resp = 0; //Alocao de memria falhou
+            return NULL;
+        }
+        new (novo) No{chave, Valor(std::forward<V>(valor)), NULL, NULL, RED}; //Novo n  sempre vermelho
+        *resp = 1;
+        return novo;
+    }
+    int c = compara_Chave(arv->comp, chave, H->chave);
+    if(c == 0)
+        *resp = 0; //Chave duplicada
+    else if(c < 0)
+        H->esq = insere_LLRBG(arv, H->esq, chave, std::forward<V>(valor), resp);
+    else
+        H->dir = insere_LLRBG(arv, H->dir, chave, std::forward<V>(valor), resp);
+
+    if(cor_LLRBG(H->dir) == RED && cor_LLRBG(H->esq) == BLACK)
+        H = rotacionaEsquerda_LLRBG(H);
+    if(cor_LLRBG(H->esq) == RED && cor_LLRBG(H->esq->esq) == RED)
+        H = rotacionaDireita_LLRBG(H);
+    if(cor_LLRBG(H->esq) == RED && cor_LLRBG(H->dir) == RED)
+        trocaCor_LLRBG(H);
+    return H;
+}
+
+//Insere a chave com a informao. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+//Passando a informao com std::move ela  movida para o n. Se no inseriu, ela no  tocada
+template <class Chave, class Valor, class Compara, class V>
+int insere_ArvLLRBGenerica(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, const typename ArvLLRBGenerica<Chave, Valor, Compara>::TipoChave& chave, V&& valor){
+    if(arv == NULL)
+        return 0;
+    int resp;
+    arv->raiz = insere_LLRBG(arv, arv->raiz, chave, std::forward<V>(valor), &resp);
+    if(arv->raiz != NULL)
+        arv->raiz->cor = BLACK; //Raiz  sempre preta
+    return resp;
+}
+
+//Tira da subrvore o n mais  esquerda e o guarda em *menor, rebalanceando o caminho
+template <class No>
+No* removerMenor_LLRBG(No* H, No** menor){
+    if(H->esq == NULL){
+        *menor = H;
+        return NULL;
+    }
+    if(cor_LLRBG(H->esq) == BLACK && cor_LLRBG(H->esq->esq) == BLACK)
+        H = move2EsqRED_LLRBG(H);
+    H->esq = removerMenor_LLRBG(H->esq, menor);
+    return balancear_LLRBG(H);
+}
+
+//Mesma remoo de remove_NO. No caso de 2 filhos, o sucessor sai da subrvore da direita e ocupa o lugar do n
+//A chave tem que estar na rvore
+template <class Chave, class Valor, class Compara>
+struct NOLLRBGenerico<Chave, Valor>* remove_LLRBG(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, struct NOLLRBGenerico<Chave, Valor>* H, const Chave& chave){
+    typedef struct NOLLRBGenerico<Chave, Valor> No;
+    if(compara_Chave(arv->comp, chave, H->chave) < 0){
+        if(cor_LLRBG(H->esq) == BLACK && cor_LLRBG(H->esq->esq) == BLACK)
+            H = move2EsqRED_LLRBG(H);
+        H->esq = remove_LLRBG(arv, H->esq, chave);
+    }else{
+        if(cor_LLRBG(H->esq) == RED)
+            H = rotacionaDireita_LLRBG(H);
+        if(H->dir == NULL && compara_Chave(arv->comp, chave, H->chave) == 0){ //N folha. S remove o n
+            destroi_LLRBG(&arv->aloc, H);
+            return NULL;
+        }
+        if(cor_LLRBG(H->dir) == BLACK && cor_LLRBG(H->dir->esq) == BLACK)
+            H = move2DirRED_LLRBG(H);
+        if(compara_Chave(arv->comp, chave, H->chave) == 0){
+            No* sucessor;
+            H->dir = removerMenor_LLRBG(H->dir, &sucessor);
+            sucessor->esq = H->esq;
+            sucessor->dir = H->dir;
+            sucessor->cor = H->cor;
+            destroi_LLRBG(&arv->aloc, H);
+            H = sucessor;
+        }else
+            H->dir = remove_LLRBG(arv, H->dir, chave);
+    }
+    return balancear_LLRBG(H);
+}
+
+//Remove a chave. Retorna 1 se removeu ou 0 se no encontrou
+template <class Chave, class Valor, class Compara>
+int remove_ArvLLRBGenerica(struct ArvLLRBGenerica<Chave, Valor, Compara>* arv, const typename ArvLLRBGenerica<Chave, Valor, Compara>::TipoChave& chave){
+    if(arv == NULL || procura_LLRBG(arv, chave) == NULL) //Verifica primeiro se a chave existe
+        return 0;
+    arv->raiz = remove_LLRBG(arv, arv->raiz, chave);
+    if(arv->raiz != NULL)
+        arv->raiz->cor = BLACK; //Raiz deve ser preta
+    return 1;
+}
+
+#endif
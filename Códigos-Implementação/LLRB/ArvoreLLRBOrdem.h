@@ -0,0 +1,267 @@
+#ifndef ARVORELLRBORDEM_H
+#define ARVORELLRBORDEM_H
+
+#include "ArvoreLLRB.h"
+
+//LLRB com estatsticas de ordem: cada n guarda quantos ns tem a sua subrvore (campo tam)
+//Com isso, "quantas chaves so menores que k" (posicao_ArvLLRB), "qual  a i-sima chave" (seleciona_ArvLLRB) e
+//"quantas chaves esto entre lo e hi" (contaIntervalo_ArvLLRB) custam O(log N), em vez de percorrer a rvore em ordem
+//O tamanho  mantido nas rotaes e na volta da recurso da insero e da remoo, o que tem um custo (DicLLRBxMAP-Ordem.cpp)
+//Por isso o modo  opcional: tam ocupa o mesmo espao de versao/refs, ento no pode ser usado junto com o modo
+//concorrente nem com o persistente, e o n continua com o mesmo tamanho
+//As trocas de cor no mudam nenhuma subrvore, ento s as rotaes precisam de verses novas
+//A rvore  criada com cria_ArvLLRB e s pode ser alterada pelas funes daqui. Uma rvore montada de outra forma
+//(carregaOrdenado_ArvLLRB, por exemplo) passa a valer para este modo depois de ligaOrdem_ArvLLRB
+//Consulta, consulta em lote e percurso so os mesmos da LLRB
+
+//Funo auxiliar que retorna o tamanho da subrvore de um n
+unsigned int tam_NO(struct NO* no){
+    if(no == NULL)
+        return 0;
+    return no->tam;
+}
+
+//Recalcula o tamanho de um n a partir dos filhos
+void atualizaTam_NO(struct NO* no){
+    no->tam = tam_NO(no->esq) + tam_NO(no->dir) + 1;
+}
+
+//Calcula o tamanho de todos os ns da subrvore, em ps-ordem. Retorna o tamanho da subrvore
+unsigned int calculaTam_NO(struct NO* no){
+    if(no == NULL)
+        return 0;
+    no->tam = calculaTam_NO(no->esq) + calculaTam_NO(no->dir) + 1;
+    return no->tam;
+}
+
+//Liga as estatsticas de ordem em uma rvore j montada, em O(N)
+void ligaOrdem_ArvLLRB(ArvLLRB *raiz){
+    if(raiz != NULL)
+        calculaTam_NO(*raiz);
+}
+
+//Quantidade de chaves da rvore, em O(1)
+int tamanho_ArvLLRB(ArvLLRB *raiz){
+    if(raiz == NULL)
+        return 0;
+    return tam_NO(*raiz);
+}
+
+//==================Rotaes com tamanho==========================
+//A subrvore rotacionada continua com os mesmos ns: a nova raiz fica com o tamanho da antiga,
+//e s a raiz antiga, que desceu, precisa ser recalculada
+
+struct NO* rotacionaEsquerdaOrdem(struct NO* A){
+    unsigned int t = A->tam;
+    struct NO* B = rotacionaEsquerda(A);
+    atualizaTam_NO(A);
+    B->tam = t;
+    return B;
+}
+
+struct NO* rotacionaDireitaOrdem(struct NO* A){
+    unsigned int t = A->tam;
+    struct NO* B = rotacionaDireita(A);
+    atualizaTam_NO(A);
+    B->tam = t;
+    return B;
+}
+
+//Mesmas funes de rebalanceamento da LLRB, usando as rotaes com tamanho
+struct NO* balancearOrdem(struct NO* H){
+    if(cor(H->dir) == RED)
+        H = rotacionaEsquerdaOrdem(H);
+    if(H->esq != NULL && cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireitaOrdem(H);
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        trocaCor(H);
+    return H;
+}
+
+struct NO* move2EsqREDOrdem(struct NO* H){
+    trocaCor(H);
+    if(cor(H->dir->esq) == RED){
+        H->dir = rotacionaDireitaOrdem(H->dir);
+        H = rotacionaEsquerdaOrdem(H);
+        trocaCor(H);
+    }
+    return H;
+}
+
+struct NO* move2DirREDOrdem(struct NO* H){
+    trocaCor(H);
+    if(cor(H->esq->esq) == RED){
+        H = rotacionaDireitaOrdem(H);
+        trocaCor(H);
+    }
+    return H;
+}
+//==================================================
+
+//Mesma insero de insereNO. Na volta da recurso o tamanho do n  recalculado antes das rotaes
+struct NO* insereOrdemNO(struct NO* H, int chave, int valor, int *resp, Alocador<struct NO>* aloc){
+    if(H == NULL){
+        struct NO *novo = aloca_NO(aloc);
+        if(novo == NULL){
+            *resp = 0;
+            return NULL;
+        }
+        novo->info = valor;
+        novo->chave = chave;
+        novo->cor = RED; //Novo n  sempre vermelho
+        novo->tam = 1;
+        novo->dir = NULL;
+        novo->esq = NULL;
+        *resp = 1;
+        return novo;
+    }
+
+    if(chave == H->chave){
+        *resp = 0; //Valor duplicado: nada muda abaixo daqui
+        return H;
+    }
+    if(chave < H->chave)
+        H->esq = insereOrdemNO(H->esq, chave, valor, resp, aloc);
+    else
+        H->dir = insereOrdemNO(H->dir, chave, valor, resp, aloc);
+    H->tam += *resp;
+
+    if(cor(H->dir) == RED && cor(H->esq) == BLACK)
+        H = rotacionaEsquerdaOrdem(H);
+    if(cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireitaOrdem(H);
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        trocaCor(H);
+    return H;
+}
+
+//Insere mantendo os tamanhos. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int insereOrdem_ArvLLRB(ArvLLRB* raiz, int chave, int valor){
+    if(raiz == NULL)
+        return 0;
+    int resp;
+    *raiz = insereOrdemNO(*raiz, chave, valor, &resp, alocador_ArvLLRB(raiz));
+    if((*raiz) != NULL)
+        (*raiz)->cor = BLACK; //Raiz  sempre preta
+    return resp;
+}
+
+struct NO* removerMenorOrdem(struct NO* H, Alocador<struct NO>* aloc){
+    if(H->esq == NULL){
+        desaloca_NO(aloc, H);
+        return NULL;
+    }
+    if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+        H = move2EsqREDOrdem(H);
+    H->esq = removerMenorOrdem(H->esq, aloc);
+    H->tam--;
+    return balancearOrdem(H);
+}
+
+//Mesma remoo de remove_NO. A chave tem que estar na rvore, ento todo n do caminho perde 1 no tamanho
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n
+struct NO* removeOrdem_NO(struct NO* H, int valor, Alocador<struct NO>* aloc){
+    if(valor < H->chave){
+        if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+            H = move2EsqREDOrdem(H);
+        H->esq = removeOrdem_NO(H->esq, valor, aloc);
+    }else{
+        if(cor(H->esq) == RED)
+            H = rotacionaDireitaOrdem(H);
+        if(valor == H->chave && (H->dir == NULL)){
+            desaloca_NO(aloc, H);
+            return NULL;
+        }
+        if(cor(H->dir) == BLACK && cor(H->dir->esq) == BLACK)
+            H = move2DirREDOrdem(H);
+        if(valor == H->chave){
+            struct NO* x = procuraMenor(H->dir);
+            H->chave = x->chave;
+            H->info = x->info;
+            H->dir = removerMenorOrdem(H->dir, aloc);
+        }else
+            H->dir = removeOrdem_NO(H->dir, valor, aloc);
+    }
+    H->tam--;
+    return balancearOrdem(H);
+}
+
+//Remove mantendo os tamanhos. Retorna 1 se removeu ou 0 (no encontrou)
+int removeOrdem_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(!consulta_ArvLLRB(raiz, valor)) //Verifica primeiro se existe o elemento a ser removido na rvore
+        return 0;
+    *raiz = removeOrdem_NO(*raiz, valor, alocador_ArvLLRB(raiz));
+    if(*raiz != NULL)
+        (*raiz)->cor = BLACK; //Raiz deve ser preta
+    return 1;
+}
+
+//==================Consultas de ordem==========================
+//Todas descem uma vez da raiz at uma folha: O(log N)
+
+//Posio (rank): quantas chaves da rvore so menores que valor. valor no precisa estar na rvore
+int posicao_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    int menores = 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor <= atual->chave)
+            atual = atual->esq;
+        else{ //O n e toda a subrvore esquerda so menores
+            menores += tam_NO(atual->esq) + 1;
+            atual = atual->dir;
+        }
+    }
+    return menores;
+}
+
+//Quantas chaves da rvore so menores ou iguais a valor
+int posicaoAte_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    int menores = 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor < atual->chave)
+            atual = atual->esq;
+        else{
+            menores += tam_NO(atual->esq) + 1;
+            atual = atual->dir;
+        }
+    }
+    return menores;
+}
+
+//Seleo (select): a i-sima menor chave, contando a partir de 0, e a informao guardada com ela
+//Retorna 1 se encontrou ou 0 se i est fora de 0..tamanho-1. chave e valor podem ser NULL
+int seleciona_ArvLLRB(ArvLLRB *raiz, int i, int *chave, int *valor){
+    if(raiz == NULL || i < 0)
+        return 0;
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        int esq = tam_NO(atual->esq);
+        if(i < esq)
+            atual = atual->esq;
+        else if(i == esq){
+            if(chave != NULL)
+                *chave = atual->chave;
+            if(valor != NULL)
+                *valor = atual->info;
+            return 1;
+        }else{
+            i -= esq + 1; //Pula a subrvore esquerda e o n
+            atual = atual->dir;
+        }
+    }
+    return 0;
+}
+
+//Quantas chaves esto no intervalo [lo, hi]
+int contaIntervalo_ArvLLRB(ArvLLRB *raiz, int lo, int hi){
+    if(lo > hi)
+        return 0;
+    return posicaoAte_ArvLLRB(raiz, hi) - posicao_ArvLLRB(raiz, lo);
+}
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef ARVORELLRBPERSISTENTE_H
+#define ARVORELLRBPERSISTENTE_H
+
+#include "ArvoreLLRB.h"
+#include "../Comum/Persistente.h" //Contagem de referncias e cpia dos ns compartilhados
+
+//LLRB persistente: cada alterao gera uma nova verso e as verses antigas continuam valendo
+//Antes de cada rotao ou troca de cor, os ns alterados so copiados se forem compartilhados com alguma verso guardada
+//(Comum/Persistente.h). Assim s O(log N) ns so copiados por operao
+//A rvore tem uma verso atual, alterada por inserePersistente_ArvLLRB e removePersistente_ArvLLRB.
+//guardaVersao_ArvLLRB tira uma foto dela em O(1): a foto pode ser percorrida ou consultada (consulta_ArvLLRB(&versao, ...))
+//enquanto a verso atual continua mudando, inclusive por outras threads, sem trava nenhuma
+//insereVersao_ArvLLRB e removeVersao_ArvLLRB criam uma verso nova a partir de qualquer verso guardada
+//Toda verso guardada deve ser solta (soltaVersao_ArvLLRB) pela thread dona da rvore
+//A rvore s pode ser alterada pelas funes daqui
+
+//Cabealho: comea igual ao da LLRB, ento alocador_ArvLLRB continua funcionando
+struct CabecaArvLLRBPersistente{
+    struct NO* raiz; //Verso atual. Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns de todas as verses
+    struct Versoes<struct NO> ver; //Reserva de ns e contagem dos ns vivos
+};
+
+struct Versoes<struct NO>* versoes_ArvLLRB(ArvLLRB* raiz){
+    return &((struct CabecaArvLLRBPersistente*) raiz)->ver;
+}
+
+//Cria a rvore vazia no modo persistente
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvLLRB* criaPersistente_ArvLLRB(int modo = ALOCA_MALLOC){
+    struct CabecaArvLLRBPersistente* cab = (struct CabecaArvLLRBPersistente*) malloc(sizeof(struct CabecaArvLLRBPersistente));
+    if(cab == NULL)
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    inicia_Versoes(&cab->ver, &cab->aloc);
+    return &cab->raiz;
+}
+
+//Libera a verso atual e o cabealho. As verses guardadas devem ter sido soltas antes
+//(na arena, as que sobrarem so liberadas junto com os blocos)
+void liberaPersistente_ArvLLRB(ArvLLRB* raiz){
+    if(raiz == NULL)
+        return;
+    struct Versoes<struct NO>* v = versoes_ArvLLRB(raiz);
+    Alocador<struct NO>* aloc = alocador_ArvLLRB(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);
+    else{
+        solta_Versoes(v, *raiz);
+        libera_Versoes(v);
+    }
+    free(raiz);
+}
+
+//Ns vivos, somando a verso atual e todas as guardadas
+size_t nosPersistente_ArvLLRB(ArvLLRB* raiz){
+    return versoes_ArvLLRB(raiz)->nos;
+}
+
+//==================Rotaes e troca de cor com cpia==========================
+//Tornam alterveis os ns que rotacionaEsquerda, rotacionaDireita e trocaCor mexem e depois chamam essas funes
+
+struct NO* rotacionaEsquerdaPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    H = escreve_Versoes(v, H);
+    H->dir = escreve_Versoes(v, H->dir);
+    return rotacionaEsquerda(H);
+}
+
+struct NO* rotacionaDireitaPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    H = escreve_Versoes(v, H);
+    H->esq = escreve_Versoes(v, H->esq);
+    return rotacionaDireita(H);
+}
+
+struct NO* trocaCorPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    H = escreve_Versoes(v, H);
+    if(H->esq != NULL)
+        H->esq = escreve_Versoes(v, H->esq);
+    if(H->dir != NULL)
+        H->dir = escreve_Versoes(v, H->dir);
+    trocaCor(H);
+    return H;
+}
+
+//Mesmas funes de rebalanceamento da LLRB, usando as verses com cpia
+struct NO* balancearPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    if(cor(H->dir) == RED)
+        H = rotacionaEsquerdaPersistente(H, v);
+    if(H->esq != NULL && cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireitaPersistente(H, v);
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        H = trocaCorPersistente(H, v);
+    return H;
+}
+
+struct NO* move2EsqREDPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    H = trocaCorPersistente(H, v);
+    if(cor(H->dir->esq) == RED){
+        H->dir = rotacionaDireitaPersistente(H->dir, v);
+        H = rotacionaEsquerdaPersistente(H, v);
+        H = trocaCorPersistente(H, v);
+    }
+    return H;
+}
+
+struct NO* move2DirREDPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    H = trocaCorPersistente(H, v);
+    if(cor(H->esq->esq) == RED){
+        H = rotacionaDireitaPersistente(H, v);
+        H = trocaCorPersistente(H, v);
+    }
+    return H;
+}
+
+//==================Insero e remoo com cpia==========================
+//Mesma lgica de insereNO, removerMenor e remove_NO. Cada funo recebe um n apontado pela verso em construo
+//e retorna quem fica no lugar dele. Os ns que saem da verso perdem a referncia (solta_Versoes)
+
+//A chave no pode estar na rvore
+struct NO* inserePersistente_NO(struct NO* H, int chave, int valor, struct Versoes<struct NO>* v){
+    if(H == NULL){
+        struct NO* novo = novo_Versoes(v);
+        novo->info = valor;
+        novo->chave = chave;
+        novo->cor = RED; //Novo n  sempre vermelho
+        novo->esq = NULL;
+        novo->dir = NULL;
+        return novo;
+    }
+    H = escreve_Versoes(v, H);
+    if(chave < H->chave)
+        H->esq = inserePersistente_NO(H->esq, chave, valor, v);
+    else
+        H->dir = inserePersistente_NO(H->dir, chave, valor, v);
+
+    if(cor(H->dir) == RED && cor(H->esq) == BLACK)
+        H = rotacionaEsquerdaPersistente(H, v);
+    if(cor(H->esq) == RED && cor(H->esq->esq) == RED)
+        H = rotacionaDireitaPersistente(H, v);
+    if(cor(H->esq) == RED && cor(H->dir) == RED)
+        H = trocaCorPersistente(H, v);
+    return H;
+}
+
+struct NO* removerMenorPersistente(struct NO* H, struct Versoes<struct NO>* v){
+    if(H->esq == NULL){
+        solta_Versoes(v, H); //Sai dessa verso. S volta ao alocador se nenhuma outra verso o usa
+        return NULL;
+    }
+    H = escreve_Versoes(v, H);
+    if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+        H = move2EsqREDPersistente(H, v);
+    H->esq = removerMenorPersistente(H->esq, v);
+    return balancearPersistente(H, v);
+}
+
+//No caso de 2 filhos, a chave e a informao do sucessor so copiadas para o n. A chave tem que estar na rvore
+struct NO* removePersistente_NO(struct NO* H, int valor, struct Versoes<struct NO>* v){
+    H = escreve_Versoes(v, H);
+    if(valor < H->chave){
+        if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
+            H = move2EsqREDPersistente(H, v);
+        H->esq = removePersistente_NO(H->esq, valor, v);
+    }else{
+        if(cor(H->esq) == RED)
+            H = rotacionaDireitaPersistente(H, v);
+        if(valor == H->chave && (H->dir == NULL)){
+            solta_Versoes(v, H);
+            return NULL;
+        }
+        if(cor(H->dir) == BLACK && cor(H->dir->esq) == BLACK)
+            H = move2DirREDPersistente(H, v);
+        if(valor == H->chave){
+            struct NO* x = procuraMenor(H->dir);
+            H->chave = x->chave;
+            H->info = x->info;
+            H->dir = removerMenorPersistente(H->dir, v);
+        }else
+            H->dir = removePersistente_NO(H->dir, valor, v);
+    }
+    return balancearPersistente(H, v);
+}
+
+//Insere em uma verso (raiz aponta para ela). A chave no pode estar na rvore
+void insereRaizPersistente(ArvLLRB* raiz, int chave, int valor, struct Versoes<struct NO>* v){
+    *raiz = inserePersistente_NO(*raiz, chave, valor, v);
+    if((*raiz)->cor != BLACK){
+        *raiz = escreve_Versoes(v, *raiz);
+        (*raiz)->cor = BLACK; //Raiz  sempre preta
+    }
+}
+
+//Remove de uma verso (raiz aponta para ela). A chave tem que estar na rvore
+void removeRaizPersistente(ArvLLRB* raiz, int valor, struct Versoes<struct NO>* v){
+    *raiz = removePersistente_NO(*raiz, valor, v);
+    if(*raiz != NULL && (*raiz)->cor != BLACK){
+        *raiz = escreve_Versoes(v, *raiz);
+        (*raiz)->cor = BLACK; //Raiz deve ser preta
+    }
+}
+
+//Insere na verso atual. Retorna 1 se inseriu ou 0 (chave repetida ou falta de memria)
+int inserePersistente_ArvLLRB(ArvLLRB* raiz, int chave, int valor){
+    if(raiz == NULL)
+        return 0;
+    struct Versoes<struct NO>* v = versoes_ArvLLRB(raiz);
+    if(consulta_ArvLLRB(raiz, chave) || !reserva_Versoes(v)) //No copia nada se a chave j existe
+        return 0;
+    insereRaizPersistente(raiz, chave, valor, v);
+    return 1;
+}
+
+//Remove da verso atual. Retorna 1 se removeu ou 0 (no encontrou ou falta de memria)
+int removePersistente_ArvLLRB(ArvLLRB *raiz, int valor){
+    if(raiz == NULL)
+        return 0;
+    struct Versoes<struct NO>* v = versoes_ArvLLRB(raiz);
+    if(!consulta_ArvLLRB(raiz, valor) || !reserva_Versoes(v))
+        return 0;
+    removeRaizPersistente(raiz, valor, v);
+    return 1;
+}
+
+//Guarda a verso atual em O(1). A verso devolvida no muda mais, e deve ser solta com soltaVersao_ArvLLRB
+ArvLLRB guardaVersao_ArvLLRB(ArvLLRB *raiz){
+    return guarda_Versoes(*raiz);
+}
+
+//Solta uma verso guardada. Os ns que s ela usava voltam para o alocador
+void soltaVersao_ArvLLRB(ArvLLRB *raiz, ArvLLRB versao){
+    solta_Versoes(versoes_ArvLLRB(raiz), versao);
+}
+
+//Retorna uma nova verso: versao com a chave inserida. versao continua valendo
+//Se a chave j existe ou faltou memria, a nova verso tem o mesmo contedo. As duas devem ser soltas
+ArvLLRB insereVersao_ArvLLRB(ArvLLRB *raiz, ArvLLRB versao, int chave, int valor){
+    struct Versoes<struct NO>* v = versoes_ArvLLRB(raiz);
+    ArvLLRB nova = guarda_Versoes(versao);
+    if(!consulta_ArvLLRB(&nova, chave) && reserva_Versoes(v))
+        insereRaizPersistente(&nova, chave, valor, v);
+    return nova;
+}
+
+//Retorna uma nova verso: versao sem a chave. versao continua valendo
+ArvLLRB removeVersao_ArvLLRB(ArvLLRB *raiz, ArvLLRB versao, int valor){
+    struct Versoes<struct NO>* v = versoes_ArvLLRB(raiz);
+    ArvLLRB nova = guarda_Versoes(versao);
+    if(consulta_ArvLLRB(&nova, valor) && reserva_Versoes(v))
+        removeRaizPersistente(&nova, valor, v);
+    return nova;
+}
+
+#endif
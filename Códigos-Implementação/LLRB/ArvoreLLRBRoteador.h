@@ -0,0 +1,370 @@
+#ifndef ARVORELLRBROTEADOR_H
+#define ARVORELLRBROTEADOR_H
+
+#include <cstdlib>
+#include <cstdint>
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+
+//Tabela de rotas dinmica sobre a LLRB, com busca pelo prefixo mais longo (longest-prefix match), insero e remoo
+//de prefixos em O(log N) (artigo "O(log n) Dynamic Router-Tables", em Artigos com Aplicaes/Rubro-Negra)
+//Um prefixo p/t cobre o intervalo de endereos [inicio, fim]: inicio  p com os bits depois dos t primeiros zerados,
+//e fim  p com esses bits em 1. Dois prefixos ou so disjuntos ou um contm o outro
+//A rvore  ordenada por (inicio, tamanho) e cada n guarda o maior fim da sua subrvore (maxFim), como na AVL de intervalos
+//Nessa ordem, os prefixos que contm um endereo a esto todos entre os que comeam at a, e o mais longo deles  o ltimo.
+//Ento a busca : o ltimo n (em ordem) com inicio <= a e fim >= a. Descemos uma vez procurando a, guardando os ns em que
+//fomos para a direita (o n e sua subrvore esquerda comeam at a), e depois, do mais fundo para o mais raso, olhamos o n e,
+//se o maxFim da subrvore esquerda chega em a, descemos nela uma vez buscando o ltimo n que chega em a: O(log N)
+//Insero e remoo so as mesmas de insereNO e remove_NO (ArvoreLLRB.h), com o maxFim recalculado nas rotaes e na volta
+//da recurso. O endereo  parmetro de template: uint32_t para IPv4 e unsigned __int128 para IPv6
+//As cores RED e BLACK so as mesmas de ArvoreLLRB.h
+
+#ifndef RED
+#define RED 1
+#define BLACK 0
+#endif
+
+//Altura mxima da LLRB com menos de 2^32 ns (pilha da busca)
+#define ALTURA_MAX_ROTAS 64
+
+template <class Endereco>
+struct NORota{
+    Endereco inicio; //Primeiro endereo do prefixo
+    Endereco maxFim; //Maior ltimo endereo entre os prefixos da subrvore
+    int tamanho; //Quantidade de bits do prefixo (0 = rota padro)
+    int salto; //Prximo salto (informao associada ao prefixo)
+    struct NORota *esq; //Filho esquerdo
+    struct NORota *dir; //Filho direito
+    int cor; //Cor do n
+};
+
+template <class Endereco>
+struct TabRotas{
+    struct NORota<Endereco> *raiz;
+    Alocador<struct NORota<Endereco> > aloc; //De onde saem os ns dessa tabela
+};
+
+//Quantidade de bits do endereo (32 no IPv4, 128 no IPv6)
+template <class Endereco>
+int bits_Endereco(){
+    return (int) sizeof(Endereco) * 8;
+}
+
+//Bits do endereo que ficam fora de um prefixo de tamanho t (os ltimos bits - t bits em 1)
+template <class Endereco>
+Endereco sufixo_Endereco(int t){
+    if(t >= bits_Endereco<Endereco>())
+        return 0;
+    return ((Endereco) ~(Endereco) 0) >> t;
+}
+
+//ltimo endereo coberto pelo prefixo do n
+template <class Endereco>
+Endereco fim_NORota(struct NORota<Endereco>* no){
+    return no->inicio | sufixo_Endereco<Endereco>(no->tamanho);
+}
+
+//Cria a tabela vazia
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+template <class Endereco>
+struct TabRotas<Endereco>* cria_TabRotas(int modo = ALOCA_MALLOC){
+    struct TabRotas<Endereco>* tab = (struct TabRotas<Endereco>*) malloc(sizeof(struct TabRotas<Endereco>));
+    if(tab == NULL) //Erro na alocao de memria
+        return NULL;
+    tab->raiz = NULL;
+    inicia_Alocador(&tab->aloc, modo);
+    return tab;
+}
+
+//Libera os ns da subrvore, um a um (modo malloc)
+template <class Endereco>
+void libera_NORota(struct NORota<Endereco>* no){
+    if(no == NULL)
+        return;
+    libera_NORota(no->esq);
+    libera_NORota(no->dir);
+    free(no);
+}
+
+//Libera toda a tabela. Na arena os blocos so liberados de uma vez
+template <class Endereco>
+void libera_TabRotas(struct TabRotas<Endereco>* tab){
+    if(tab == NULL)
+        return;
+    if(tab->aloc.modo == ALOCA_ARENA)
+        libera_Alocador(&tab->aloc);
+    else
+        libera_NORota(tab->raiz);
+    free(tab);
+}
+
+//Funo auxiliar que retorna o maior fim da subrvore. Subrvore vazia: 0 (e a busca tambm confere o incio)
+template <class Endereco>
+Endereco maxFim_NORota(struct NORota<Endereco>* no){
+    if(no == NULL)
+        return 0;
+    return no->maxFim;
+}
+
+//Recalcula o maior fim do n a partir do prprio prefixo e dos filhos
+template <class Endereco>
+void atualizaMax_NORota(struct NORota<Endereco>* no){
+    Endereco m = fim_NORota(no);
+    if(no->esq != NULL && no->esq->maxFim > m)
+        m = no->esq->maxFim;
+    if(no->dir != NULL && no->dir->maxFim > m)
+        m = no->dir->maxFim;
+    no->maxFim = m;
+}
+
+//Ordem dos prefixos na rvore: primeiro pelo incio, depois pelo tamanho
+//Retorna < 0, 0 ou > 0 se (inicio, tamanho) vem antes,  igual ou vem depois do prefixo do n
+template <class Endereco>
+int compara_NORota(Endereco inicio, int tamanho, struct NORota<Endereco>* no){
+    if(inicio != no->inicio)
+        return (inicio < no->inicio) ? -1 : 1;
+    return tamanho - no->tamanho;
+}
+
+//==================Rotaes e cores==========================
+//As mesmas de ArvoreLLRB.h. A raiz antiga desce e  recalculada primeiro; depois a nova raiz
+
+template <class Endereco>
+struct NORota<Endereco>* rotacionaEsquerda_NORota(struct NORota<Endereco>* A){
+    struct NORota<Endereco>* B = A->dir;
+    A->dir = B->esq;
+    B->esq = A;
+    B->cor = A->cor;
+    A->cor = RED;
+    atualizaMax_NORota(A);
+    atualizaMax_NORota(B);
+    return B;
+}
+
+template <class Endereco>
+struct NORota<Endereco>* rotacionaDireita_NORota(struct NORota<Endereco>* A){
+    struct NORota<Endereco>* B = A->esq;
+    A->esq = B->dir;
+    B->dir = A;
+    B->cor = A->cor;
+    A->cor = RED;
+    atualizaMax_NORota(A);
+    atualizaMax_NORota(B);
+    return B;
+}
+
+template <class Endereco>
+int cor_NORota(struct NORota<Endereco>* H){
+    if(H == NULL)
+        return BLACK;
+    return H->cor;
+}
+
+template <class Endereco>
+void trocaCor_NORota(struct NORota<Endereco>* H){
+    H->cor = !H->cor;
+    if(H->esq != NULL)
+        H->esq->cor = !H->esq->cor;
+    if(H->dir != NULL)
+        H->dir->cor = !H->dir->cor;
+}
+
+template <class Endereco>
+struct NORota<Endereco>* balancear_NORota(struct NORota<Endereco>* H){
+    if(cor_NORota(H->dir) == RED)
+        H = rotacionaEsquerda_NORota(H);
+    if(H->esq != NULL && cor_NORota(H->esq) == RED && cor_NORota(H->esq->esq) == RED)
+        H = rotacionaDireita_NORota(H);
+    if(cor_NORota(H->esq) == RED && cor_NORota(H->dir) == RED)
+        trocaCor_NORota(H);
+    return H;
+}
+
+template <class Endereco>
+struct NORota<Endereco>* move2EsqRED_NORota(struct NORota<Endereco>* H){
+    trocaCor_NORota(H);
+    if(cor_NORota(H->dir->esq) == RED){
+        H->dir = rotacionaDireita_NORota(H->dir);
+        H = rotacionaEsquerda_NORota(H);
+        trocaCor_NORota(H);
+    }
+    return H;
+}
+
+template <class Endereco>
+struct NORota<Endereco>* move2DirRED_NORota(struct NORota<Endereco>* H){
+    trocaCor_NORota(H);
+    if(cor_NORota(H->esq->esq) == RED){
+        H = rotacionaDireita_NORota(H);
+        trocaCor_NORota(H);
+    }
+    return H;
+}
+//==================================================
+
+//Mesma insero de insereNO. Na volta da recurso o maior fim do n  recalculado antes das rotaes
+template <class Endereco>
+struct NORota<Endereco>* insere_NORota(struct NORota<Endereco>* H, Endereco inicio, int tamanho, int salto, int *resp, Alocador<struct NORota<Endereco> >* aloc){
+    if(H == NULL){
+        struct NORota<Endereco> *novo = aloca_NO(aloc);
+        if(novo == NULL){ //Alocao de memria falhou
+            *resp = 0;
+            return NULL;
+        }
+        novo->inicio = inicio;
+        novo->tamanho = tamanho;
+        novo->salto = salto;
+        novo->maxFim = fim_NORota(novo);
+        novo->cor = RED; //Novo n  sempre vermelho
+        novo->esq = NULL;
+        novo->dir = NULL;
+        *resp = 1;
+        return novo;
+    }
+
+    int c = compara_NORota(inicio, tamanho, H);
+    if(c == 0){
+        *resp = 0; //Prefixo j est na tabela
+        return H;
+    }
+    if(c < 0)
+        H->esq = insere_NORota(H->esq, inicio, tamanho, salto, resp, aloc);
+    else
+        H->dir = insere_NORota(H->dir, inicio, tamanho, salto, resp, aloc);
+    atualizaMax_NORota(H);
+
+    if(cor_NORota(H->dir) == RED && cor_NORota(H->esq) == BLACK)
+        H = rotacionaEsquerda_NORota(H);
+    if(cor_NORota(H->esq) == RED && cor_NORota(H->esq->esq) == RED)
+        H = rotacionaDireita_NORota(H);
+    if(cor_NORota(H->esq) == RED && cor_NORota(H->dir) == RED)
+        trocaCor_NORota(H);
+    return H;
+}
+
+//Insere o prefixo/tamanho com o prximo salto. Os bits do prefixo depois do tamanho so ignorados
+//Retorna 1 se inseriu ou 0 (tamanho invlido, prefixo j na tabela ou falta de memria). Para trocar o salto, remova e insira de novo
+template <class Endereco>
+int insere_TabRotas(struct TabRotas<Endereco>* tab, Endereco prefixo, int tamanho, int salto){
+    if(tab == NULL || tamanho < 0 || tamanho > bits_Endereco<Endereco>())
+        return 0;
+    int resp;
+    tab->raiz = insere_NORota(tab->raiz, prefixo & ~sufixo_Endereco<Endereco>(tamanho), tamanho, salto, &resp, &tab->aloc);
+    if(tab->raiz != NULL)
+        tab->raiz->cor = BLACK; //Raiz  sempre preta
+    return resp;
+}
+
+template <class Endereco>
+struct NORota<Endereco>* removerMenor_NORota(struct NORota<Endereco>* H, Alocador<struct NORota<Endereco> >* aloc){
+    if(H->esq == NULL){
+        desaloca_NO(aloc, H);
+        return NULL;
+    }
+    if(cor_NORota(H->esq) == BLACK && cor_NORota(H->esq->esq) == BLACK)
+        H = move2EsqRED_NORota(H);
+    H->esq = removerMenor_NORota(H->esq, aloc);
+    atualizaMax_NORota(H);
+    return balancear_NORota(H);
+}
+
+//Mesma remoo de remove_NO. O prefixo tem que estar na tabela
+//No caso de 2 filhos, o prefixo e o salto do sucessor so copiados para o n
+template <class Endereco>
+struct NORota<Endereco>* remove_NORota(struct NORota<Endereco>* H, Endereco inicio, int tamanho, Alocador<struct NORota<Endereco> >* aloc){
+    if(compara_NORota(inicio, tamanho, H) < 0){
+        if(cor_NORota(H->esq) == BLACK && cor_NORota(H->esq->esq) == BLACK)
+            H = move2EsqRED_NORota(H);
+        H->esq = remove_NORota(H->esq, inicio, tamanho, aloc);
+    }else{
+        if(cor_NORota(H->esq) == RED)
+            H = rotacionaDireita_NORota(H);
+        if(compara_NORota(inicio, tamanho, H) == 0 && H->dir == NULL){
+            desaloca_NO(aloc, H);
+            return NULL;
+        }
+        if(cor_NORota(H->dir) == BLACK && cor_NORota(H->dir->esq) == BLACK)
+            H = move2DirRED_NORota(H);
+        if(compara_NORota(inicio, tamanho, H) == 0){
+            struct NORota<Endereco>* x = H->dir; //Menor n da subrvore da direita
+            while(x->esq != NULL)
+                x = x->esq;
+            H->inicio = x->inicio;
+            H->tamanho = x->tamanho;
+            H->salto = x->salto;
+            H->dir = removerMenor_NORota(H->dir, aloc);
+        }else
+            H->dir = remove_NORota(H->dir, inicio, tamanho, aloc);
+    }
+    atualizaMax_NORota(H);
+    return balancear_NORota(H);
+}
+
+//Procura o n do prefixo exato, ou NULL
+template <class Endereco>
+struct NORota<Endereco>* procura_NORota(struct NORota<Endereco>* no, Endereco inicio, int tamanho){
+    while(no != NULL){
+        int c = compara_NORota(inicio, tamanho, no);
+        if(c == 0)
+            return no;
+        no = (c < 0) ? no->esq : no->dir;
+    }
+    return NULL;
+}
+
+//Remove o prefixo/tamanho. Retorna 1 se removeu ou 0 (no estava na tabela)
+template <class Endereco>
+int remove_TabRotas(struct TabRotas<Endereco>* tab, Endereco prefixo, int tamanho){
+    if(tab == NULL || tamanho < 0 || tamanho > bits_Endereco<Endereco>())
+        return 0;
+    Endereco inicio = prefixo & ~sufixo_Endereco<Endereco>(tamanho);
+    if(procura_NORota(tab->raiz, inicio, tamanho) == NULL) //Verifica primeiro se o prefixo est na tabela
+        return 0;
+    tab->raiz = remove_NORota(tab->raiz, inicio, tamanho, &tab->aloc);
+    if(tab->raiz != NULL)
+        tab->raiz->cor = BLACK; //Raiz deve ser preta
+    return 1;
+}
+
+//Busca pelo prefixo mais longo que contm o endereo
+//Retorna 1 e copia o prximo salto e o tamanho do prefixo para *salto e *tamanho (que podem ser NULL), ou 0 se nenhum prefixo contm o endereo
+template <class Endereco>
+int busca_TabRotas(struct TabRotas<Endereco>* tab, Endereco endereco, int *salto, int *tamanho){
+    if(tab == NULL)
+        return 0;
+    struct NORota<Endereco>* candidatos[ALTURA_MAX_ROTAS]; //Ns com inicio <= endereo em que a descida foi para a direita
+    int topo = 0;
+    struct NORota<Endereco>* no = tab->raiz;
+    while(no != NULL){
+        if(no->inicio <= endereco){
+            candidatos[topo++] = no;
+            no = no->dir;
+        }else
+            no = no->esq;
+    }
+    struct NORota<Endereco>* resp = NULL;
+    while(topo > 0 && resp == NULL){ //Do ltimo candidato (em ordem) para o primeiro
+        struct NORota<Endereco>* c = candidatos[--topo];
+        if(fim_NORota(c) >= endereco)
+            resp = c;
+        else if(c->esq != NULL && c->esq->maxFim >= endereco){ //A resposta est na subrvore esquerda: ltimo n que chega no endereo
+            no = c->esq;
+            while(resp == NULL){
+                if(no->dir != NULL && no->dir->maxFim >= endereco)
+                    no = no->dir;
+                else if(fim_NORota(no) >= endereco)
+                    resp = no;
+                else
+                    no = no->esq;
+            }
+        }
+    }
+    if(resp == NULL)
+        return 0;
+    if(salto != NULL)
+        *salto = resp->salto;
+    if(tamanho != NULL)
+        *tamanho = resp->tamanho;
+    return 1;
+}
+
+#endif
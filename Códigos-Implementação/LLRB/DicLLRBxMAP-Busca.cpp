@@ -19,330 +19,9 @@ private:
 };
 
 
-//Usei como referncia as aulas do professor Andr Backes, disponveis em http://www.facom.ufu.br/~backes/
-//Foi implementado uma variao da rvore Rubro-Negra para faciliar
-//rvore Rubro-Negra Cada Para a Esquerda - Left-Leaning Redblack (LLRB), proposta por Robert Sedgewick (2008)
-//Propriedades da rvore Rubro-Negra:
-//- Todo n deve ser preto ou vermelho (esquema de colorao para manter o balanceamento da rvore)
-//- A raiz  sempre preta
-//- Todo n folha (NULL)  preto (como toda folha possui dois ponteiros NULL, pode-se ignorar isso para representar a rvore fins prticos e didticos)
-//- Se um n  vemelho, ento os seus filhos so pretos (no existem ns vermelhos consecutivos)
-//- Todos os caminhos de um n para os ns folhas descendentes contm o mesmo nmero de ns pretos
-//- Permite rebalanceamento local para manter as propriedades da rvore (rotaes e ajuste de cores)
-//- No pior caso, os algoritmos das operaes sero O(log(n))
-
-// A LLRB atender a todas essas propriedades, adicionando-se mais uma:
-//- Se um n  vermelho, ento ele ser filho esquerdo do seu pai
-// Dessa forma camos na implementao de uma rvore 2-3 (no  uma rvore binria)
-// Na rvore 2-3, cada n pode armazenar um ou dois valores e, dependendo da quantidade de valores armazenados, ter dois (um valor) ou trs (dois valores) filhos
-// Funcionamento semelhante a rvore binria, agora possuindo tambm um subarvore do meio, onde estaro os elementos
-// maiores do que o primeiro, mas menores que o segundo valor do n pai
-// A implementao corresponde a implementao de uma rvore 2-3 se considerarmos que o n vemelho ser sempre o valor menor
-// de um n contendo dois valores e trs subrvores
-// Assim, balancear a rvore rubro-negra equivale a manipular uma rvore 2-3, uma tarefa muito mais simples do que manipular uma rvore AVL ou uma rubro-negra convencional
-// Com exceo da "insero" e da "remoo", as demais funes (criar, liberar e buscar) da LLRB so idnticas a de uma rvore Binria
-
-// As operaes de busca, insero e remoo de elementos possuem complexidade O(log N), no qual N  o nmero de elementos da rvore), que so aplicados a rvore de busca binria
-
-//Definio das cores
-#define RED 1
-#define BLACK 0
-
-typedef struct NO* ArvLLRB;
-
-//Definio do n do dicionrio. Tipo de dado armazenado
-struct NO{
-    int info; //Informao propriamente dita
-    int chave; //Chave associada  informao
-    struct NO *esq; //Filho esquerdo
-    struct NO *dir; //Filho direito
-    int cor; //Cor do n
-};
-
-//Cria a rvore alocando o n raiz e retornando o ponteiro (ponteiro para ponteiro, fica mais fcil mudar quem  a raiz da rvore, se necessrio)
-//Idntica  rvore binria
-ArvLLRB* cria_ArvLLRB(){
-    ArvLLRB* raiz = (ArvLLRB*) malloc(sizeof(ArvLLRB));
-    if(raiz != NULL){//Erro na alocao de memria
-        *raiz = NULL;
-    }
-    return raiz;
-}
-
-//Liberar um n
-void libera_NO(struct NO* no){
-    if(no == NULL) //Se j est vazia, no tem nada a fazer.
-        return;
-    libera_NO(no->esq); //Caso contrrio libera recursivamente todos os ns.
-    libera_NO(no->dir);
-    free(no); //Como usei malloc, usar o free ao invs de delete.
-    no = NULL;
-}
-
-//Liberar toda a rvore, utilizando a funo libera_NO. Igual da rvore binria
-void libera_ArvLLRB(ArvLLRB* raiz){
-    if(raiz == NULL)
-        return;
-    libera_NO(*raiz);//libera cada n
-    free(raiz);//libera a raiz
-}
-
-//A consulta  idntica a uma rvore Binria. Por padro vamos buscar pela chave
-int consulta_ArvLLRB(ArvLLRB *raiz, int valor){
-    if(raiz == NULL) //rvopre vazia?
-        return 0;//No encontrou
-    struct NO* atual = *raiz;
-    while(atual != NULL){
-        if(valor == atual->chave){ //Valor procurado est no n atual
-            return 1; //Encontrou
-        }
-        if(valor > atual->chave) //Se o valor procurado for maior que o n atual, procurar na subvore direita
-            atual = atual->dir;
-        else
-            atual = atual->esq; //Se o valor procurado for menor que o n atual, procurar na subvore esquerda
-    }
-    return 0; //No encontrou
-}
-
-//==================Implementao das rotaes==========================
-//Diferente da AVL, s temos dois tipos de rotao:  esquerda e  direita
-//Dado um conjunto de trs ns, a rotao visa deslocar um n vermelho que esteja  esquerda para  direita e vice-versa
-
-//Rotao  esquerda
-//Apenas rotaciona, no trata a violao de dois filhos vermelhos consecutivos, por exemplo
-struct NO* rotacionaEsquerda(struct NO* A){
-    struct NO* B = A->dir; //N B como filho direito de A
-    A->dir = B->esq; // Mover B para o lugar de A
-    B->esq = A; //A se torna filho esquerdo de B
-    B->cor = A->cor; //B recebe a cor de A
-    A->cor = RED; //Cor de A fica vermelha
-    return B;
-}
-
-//Rotao  direita. No trata outras violaes da LLRB
-struct NO* rotacionaDireita(struct NO* A){
-    struct NO* B = A->esq; //N B como filho esquerdo de A
-    A->esq = B->dir; // Mover B para o lugar de A
-    B->dir = A; //A se torna filho direito de B
-    B->cor = A->cor; //B recebe a cor de A
-    A->cor = RED; //Cor de A fica vermelha
-    return B;
-}
-//Funo auxiliar para retornar a cor do n
-int cor(struct NO* H){
-    if(H == NULL)
-        return BLACK; //Propriedade da rvore Rubro-Negra. Todo n folha (NULL)  preto
-    else
-        return H->cor;
-}
-
-//Funo auxiliar para inverter a cor do pai e de seus filhos
-void trocaCor(struct NO* H){
-    H->cor = !H->cor; //Inverte a cor do pai
-    if(H->esq != NULL) //Inverte a cor do filho da esquerda
-        H->esq->cor = !H->esq->cor;
-    if(H->dir != NULL)//Inverte a cor do filho da direita
-        H->dir->cor = !H->dir->cor;
-}
-
-// Funo auxiliar utilizada na funo insere_ArvLLRB
-// Trata dos seguintes casos:
-//-Se a raiz  NULL: insira o n
-//-Se o valor  menor do que a raiz: v para a subrvore  esquerda
-//-Se o valor  maior que a raiz: v para a subrvore  direita
-//Aplique o mtodo recursivamente
-//Ao voltar na recursso, verificar as propriedades de cada subrvore e aplicar as rotaes ou mudana de cor
-//necessrias caso alguma propriedade foi violada
-struct NO* insereNO(struct NO* H, int chave, int valor, int *resp){
-    if(H == NULL){ //vore vazia ou estou em um n folha
-        struct NO *novo; //Crio o novo n
-        novo = (struct NO*)malloc(sizeof(struct NO)); //Alocao de memria
-        if(novo == NULL){ //Verificao da alocao de memria
-            *resp = 0;
-            return NULL;
-        }
-        //Preenche o novo n com as informaes
-        novo->info = valor;
-        novo->chave = chave;
-        novo->cor = RED; //Novo n  sempre vermelho
-        novo->dir = NULL; //Como  um n folha, esq=NULL e dir=NULL
-        novo->esq = NULL;
-        *resp = 1; //Deu certo a insero
-        return novo;
-    }
-
-    if(chave == H->chave)
-        *resp = 0;// Valor duplicado. No faz nada e informa que no deu certo a insero
-    else{
-        if(chave < H->chave)
-            H->esq = insereNO(H->esq,chave,valor,resp); //Valor  menor que o pai, vou pra subrvore da esquerda
-        else
-            H->dir = insereNO(H->dir,chave,valor,resp); //Valor  maior que o pai, vou pra subrvore da direita
-    }
-
-    //Voltando da recurso verifico se as propriedades da rvore se mantm
-
-    //n vermelho  sempre filho  esquerda (LLRB)
-    if(cor(H->dir) == RED && cor(H->esq) == BLACK)
-        H = rotacionaEsquerda(H); //Rotao  esquerda
-
-    //Filho e Neto so vermelhos
-    //Filho vira pai de 2 ns vermelhos
-    if(cor(H->esq) == RED && cor(H->esq->esq) == RED)
-        H = rotacionaDireita(H); //Rotao  direita
-
-    //2 filhos Vermelhos: troca cor!
-    if(cor(H->esq) == RED && cor(H->dir) == RED)
-        trocaCor(H); //Troca a cor do pai e dos filhos
-
-    return H;
-}
-
-//Funo de gerenciamento da insero
-int insere_ArvLLRB(ArvLLRB* raiz, int chave, int valor){
-    int resp; //Guarda a resposta da insero passada como parmetro e usada na recurso
-    *raiz = insereNO(*raiz,chave,valor,&resp); //Funo responsvel pela busca do local de insero do n
-    if((*raiz) != NULL) //rvore est vazia.
-        (*raiz)->cor = BLACK; //Raiz  sempre preta
-
-    return resp;
-}
-
-//Temos necessidade de outras 3 funes (alm das rotaes) para restabelecer o balanceamento da rvore
-// e garantir que suas propriedades sejam respeitadas:
-//-Mover um n vermelho para a esquerda
-//-Mover um n vermelho para a direita
-//-Arrumar o balanceamento
-
-//Funo auxiliar usada no rebalanceamento da rvore
-//Trata 3 situaes:
-//- Se o filho direito  vermelho: rotao  esquerda
-//- Se o filho esquerdo e o neto da esquerda so vermelhos: rotao  direita
-//- Se ambos os filhos so vermelhos: trocar a cor do pai e dos filhos
-struct NO* balancear(struct NO* H){
-    if(cor(H->dir) == RED)//n vermelho  sempre filho  esquerda
-        H = rotacionaEsquerda(H);
-
-    //Filho da esquerda e neto da esquerda so vermelhos
-    if(H->esq != NULL && cor(H->esq) == RED && cor(H->esq->esq) == RED)
-        H = rotacionaDireita(H);
-
-    //2 filhos Vermelhos: troca cor!
-    if(cor(H->esq) == RED && cor(H->dir) == RED)
-        trocaCor(H);
-    return H;
-}
-
-//Funo auxiliar para mover um n vermelho para a esquerda e restabelecer o balanceamento da rvore
-//Essas funes movimentam um n vermelho para a subrvore esquerda ou direita, dependendo da situao em que se encontra
-struct NO* move2EsqRED(struct NO* H){
-    trocaCor(H); //Troca a cor do n e dos filhos
-    if(cor(H->dir->esq) == RED){ //Filho a esquerda do filho direito  vermelho
-        H->dir = rotacionaDireita(H->dir); //Aplica rotao  direita no filho direito
-        H = rotacionaEsquerda(H); //Rotao  esquerda no pai e seus filhos
-        trocaCor(H); //Troca a cor do n e dos filhos
-    }
-    return H;
-}
-
-//Funo auxiliar para mover um n vermelho para a direita e restabelecer o balanceamento da rvore
-//Essas funes movimentam um n vermelho para a subrvore esquerda ou direita, dependendo da situao em que se encontra
-struct NO* move2DirRED(struct NO* H){
-    trocaCor(H); //Troca a cor do n e dos filhos
-    if(cor(H->esq->esq) == RED){ //Filho a esquerda do filho esquerdo  vermelho
-        H = rotacionaDireita(H); //Aplicar rotao  direita no pai
-        trocaCor(H);//Troca a cor do n e dos filhos
-    }
-    return H;
-}
-
-//Remoo
-// Existem 3 tipos de remoo:
-//- N folha (sem filhos)
-//- N com 1 filho
-//- N com 2 filhos
-//Ao voltar na recurso, verificar as propriedades de cada subrvore e aplicar as rotaes e mudanas de cor necessrias
-
-struct NO* removerMenor(struct NO* H){
-    if(H->esq == NULL){ //No tem filho  esquerda
-        free(H);
-        return NULL;
-    }
-    if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
-        H = move2EsqRED(H);
-
-    H->esq = removerMenor(H->esq); //Indo pra esquerda
-    return balancear(H);
-}
-
-// Funo auxiliar que procura pelo n mais a esquerda (que  o menor n)
-struct NO* procuraMenor(struct NO* atual){
-    struct NO *no1 = atual;
-    struct NO *no2 = atual->esq;
-    while(no2 != NULL){
-        no1 = no2;
-        no2 = no2->esq;
-    }
-    return no1;
-}
-
-//Funo responsvel pela busca do n a ser removido
-struct NO* remove_NO(struct NO* H, int valor){
-    if(valor < H->chave){ //Valor a ser removido  menor que o valor do pai?
-        if(cor(H->esq) == BLACK && cor(H->esq->esq) == BLACK)
-            H = move2EsqRED(H); //Move para esquerda
-
-        H->esq = remove_NO(H->esq, valor); //Vou para a subrvore da esquerda
-    }else{
-        if(cor(H->esq) == RED) //No esquerdo  vermelho,
-            H = rotacionaDireita(H);
-
-        if(valor == H->chave && (H->dir == NULL)){ //N folha. S remove o n
-            free(H);
-            return NULL;
-        }
-
-        if(cor(H->dir) == BLACK && cor(H->dir->esq) == BLACK)
-            H = move2DirRED(H); //Move para direita
-
-        if(valor == H->chave){
-            struct NO* x = procuraMenor(H->dir); //Menor n da subrvore da direita
-            H->chave = x->chave; //Troco de lugar com o n H
-            H->dir = removerMenor(H->dir); //Remove o menor
-        }else
-            H->dir = remove_NO(H->dir, valor);
-    }
-    return balancear(H); //Antes de voltar na recurso, devemos balancear a rvore
-}
-
-//Funo de gerenciamento da remoo
-int remove_ArvLLRB(ArvLLRB *raiz, int valor){
-    if(consulta_ArvLLRB(raiz,valor)){ //Verifica primeiro se existe o elemento a ser removido na rvore
-        struct NO* h = *raiz;
-        *raiz = remove_NO(h,valor); //Funo responsvel pela busca do n a ser removido
-        if(*raiz != NULL)
-            (*raiz)->cor = BLACK; //Raiz deve ser preta
-        return 1; //Deu certo
-    }else
-        return 0; //Deu errado
-}
-
-//Imprime um percurso em-ordem para testes
-void emOrdem_ArvLLRB(ArvLLRB *raiz, int H){
-    if(raiz == NULL)
-        return;
-
-    if(*raiz != NULL){
-        emOrdem_ArvLLRB(&((*raiz)->esq),H+1);
-
-        if((*raiz)->cor == RED)
-            printf("R - Chave %d: - Valor: %d\n\n",(*raiz)->chave,(*raiz)->info);
-        else
-            printf("B - Chave %d: - Valor: %d\n\n",(*raiz)->chave,(*raiz)->info);
-
-        emOrdem_ArvLLRB(&((*raiz)->dir),H+1);
-    }
-}
+#include "ArvoreLLRB.h" //Implementao da LLRB (compartilhada pelos programas de teste)
+#include "ArvoreLLRBGenerica.h" //Verso genrica (tipos da chave e da informao como parmetros de template)
+#include "../Comum/GeraChaves.h" //Permutao que sorteia as chaves das consultas
 
 //Exemplo de uso
 int main(){
@@ -351,6 +30,8 @@ int main(){
     double t = tmr.elapsed(); //Tempo de execuo do trecho de cdigo em segundos (s)
     int N = 11000000; //Nmero de ns da rvore/Mapa. Range 500.000-15.000.000
     int num_rodadas = 500000; //Nmero de rodadas para pegar a mdia de tempos e diminuir distores
+    int modo_alocacao = ALOCA_MALLOC; //Alocao dos ns da rvore: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int carga_ordenada = 0; //1: monta a rvore de uma vez a partir do vetor ordenado 0..N-1 (carregaOrdenado_ArvLLRB) em vez de N inseres
     double somaMAPA = 0.0, somaLLRB = 0.0; //Tempos para cada implementao
     double *tempo_LLRB, *tempo_MAPA;
     tempo_LLRB = (double *)malloc(N * sizeof(double)); //Vetores para armazenar os tempos de insero de cada valor
@@ -358,6 +39,13 @@ int main(){
     int res; //Resposta se a insero ocorreu corretamente (1) ou no (0)
     std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
     std::cout<<std::endl;
+    //Chaves das consultas: num_rodadas chaves distintas de 0..N-1 em ordem aleatria, as mesmas para todas as implementaes
+    //Em sequncia (0, 1, 2...), chaves vizinhas dividem linhas de cache e o caminho na rvore, o que favorece principalmente os lotes
+    int *consultas = (int *)malloc(num_rodadas * sizeof(int));
+    struct Permutacao permutacao;
+    inicia_Permutacao(&permutacao, N, 42);
+    for(int j=0;j<num_rodadas;j++)
+        consultas[j] = (int) aplica_Permutacao(&permutacao, j);
 
     //=============================Mapa============================================
     std::map<int, int> Mapa; //Para comparar com a implementao de rvore LLRB
@@ -374,7 +62,7 @@ int main(){
     {
         tmr.reset();
         //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
-        if(Mapa.find(j)!= Mapa.end())
+        if(Mapa.find(consultas[j])!= Mapa.end())
         {
         //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
             t = tmr.elapsed();
@@ -391,12 +79,20 @@ int main(){
     std::cout << "Tempo medio para encontrar elemento no Mapa com " << N << " nos = " << somaMAPA/num_rodadas << " segundos" << std::endl; //Exibe na tela os valores
     std::cout<<std::endl;
     //=============================LLRB============================================
-    ArvLLRB *llrb = cria_ArvLLRB();//Cria rvore LLRB
+    ArvLLRB *llrb = cria_ArvLLRB(modo_alocacao);//Cria rvore LLRB
     std::cout<<"Inserindo elementos na LLRB..."<<std::endl;
     std::cout<<std::endl;
-    for(int i=0;i<N;i++) //Insere elementos na rvore
-    {
-        res = insere_ArvLLRB(llrb,i,i);
+    if(carga_ordenada){ //Construo em O(N), sem rotaes
+        int *chaves = (int *)malloc(N * sizeof(int));
+        for(int i=0;i<N;i++)
+            chaves[i] = i;
+        res = carregaOrdenado_ArvLLRB(llrb,chaves,chaves,N); //Chave e informao iguais, como nas inseres
+        free(chaves);
+    }else{
+        for(int i=0;i<N;i++) //Insere elementos na rvore
+        {
+            res = insere_ArvLLRB(llrb,i,i);
+        }
     }
 
     std::cout<<"Buscando elementos e calculando tempo..."<<std::endl;
@@ -405,7 +101,7 @@ int main(){
     {
         tmr.reset();
         //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
-        if(consulta_ArvLLRB(llrb,j)== 1) //Zero no encontrou, 1 encontrou
+        if(consulta_ArvLLRB(llrb,consultas[j])== 1) //Zero no encontrou, 1 encontrou
         {
         //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
             t = tmr.elapsed();
@@ -414,6 +110,26 @@ int main(){
         tempo_LLRB[j] = t;
     }
 
+    //Mesmas chaves, mas consultadas em lotes de TAM_LOTE com consultaLote_ArvLLRB (buscas intercaladas com prefetch)
+    //Mede o tempo de cada lote e divide pelo total de chaves no final
+    const int TAM_LOTE = 256; //Nosso caminho de leitura recebe as consultas em lotes de centenas
+    int chaves_lote[TAM_LOTE], resultados_lote[TAM_LOTE];
+    double somaLote = 0.0;
+    int encontrouLote = 1;
+    for(int j=0;j<num_rodadas;j+=TAM_LOTE)
+    {
+        int n = (num_rodadas - j < TAM_LOTE) ? num_rodadas - j : TAM_LOTE;
+        for(int i=0;i<n;i++)
+            chaves_lote[i] = consultas[j + i];
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = consultaLote_ArvLLRB(llrb,chaves_lote,n,resultados_lote);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        somaLote = somaLote + tmr.elapsed();
+        if(res != n)
+            encontrouLote = 0; //Alguma chave do lote no foi encontrada
+    }
+
     libera_ArvLLRB(llrb);
 
     for(int j=0;j<num_rodadas;j++) //Calcula o tempo total para encontrar o elemento em num_rodadas rodadas
@@ -421,10 +137,77 @@ int main(){
         somaLLRB = somaLLRB + tempo_LLRB[j];
     }
     std::cout << "Tempo medio para encontrar elemento na LLRB com " << N << " nos = " << somaLLRB/num_rodadas << " segundos" << std::endl; //Exibe na tela
+    std::cout << "Tempo medio para encontrar elemento na LLRB (lotes de " << TAM_LOTE << ") com " << N << " nos = " << somaLote/num_rodadas << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================LLRB genrica=================================
+    //Mesmas buscas na verso genrica com <int, int>: o tempo deve ser o mesmo da LLRB com int
+    struct ArvLLRBGenerica<int, int> *generica = cria_ArvLLRBGenerica<int, int>(modo_alocacao);
+    for(int i=0;i<N;i++)
+        insere_ArvLLRBGenerica(generica,i,i);
+    double somaGenerica = 0.0;
+    int encontrouGenerica = 1;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = consulta_ArvLLRBGenerica(generica,consultas[j]);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        somaGenerica = somaGenerica + tmr.elapsed();
+        if(res != 1)
+            encontrouGenerica = 0;
+    }
+    libera_ArvLLRBGenerica(generica);
+    std::cout << "Tempo medio para encontrar elemento na LLRB generica <int, int> com " << N << " nos = " << somaGenerica/num_rodadas << " segundos" << std::endl;
+    std::cout<<std::endl;
+    //=============================LLRB congelada=================================
+    //Cpia congelada (vetor na ordem de Eytzinger, sem ponteiros) em vrios tamanhos, comparada com a prpria LLRB
+    //Para cada N a LLRB  montada e congelada, e as duas recebem as mesmas num_rodadas consultas, sorteadas em 0..N-1
+    int tamanhos[] = {500000, 1000000, 2000000, 5000000, 10000000, 15000000};
+    int num_tamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    int encontrouCongelada = 1;
+    std::cout<<"Buscando elementos na LLRB e na LLRB congelada para cada N..."<<std::endl;
+    for(int k=0;k<num_tamanhos;k++)
+    {
+        int n = tamanhos[k];
+        ArvLLRB *arv = cria_ArvLLRB(modo_alocacao);
+        for(int i=0;i<n;i++)
+            insere_ArvLLRB(arv,i,i);
+        inicia_Permutacao(&permutacao, n, 42);
+        for(int j=0;j<num_rodadas;j++)
+            consultas[j] = (int) aplica_Permutacao(&permutacao, j);
+        double somaArvore = 0.0, somaCongelada = 0.0;
+        for(int j=0;j<num_rodadas;j++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = consulta_ArvLLRB(arv,consultas[j]);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            somaArvore = somaArvore + tmr.elapsed();
+            if(res != 1)
+                encontrouCongelada = 0;
+        }
+        tmr.reset();
+        struct ArvCongelada *congelada = congela_ArvLLRB(arv);
+        double tempo_congela = tmr.elapsed(); //Tempo para criar a cpia
+        for(int j=0;j<num_rodadas;j++)
+        {
+            tmr.reset();
+            //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+            res = consulta_ArvCongelada(congelada,consultas[j]);
+            //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            somaCongelada = somaCongelada + tmr.elapsed();
+            if(res != 1)
+                encontrouCongelada = 0;
+        }
+        libera_ArvCongelada(congelada);
+        libera_ArvLLRB(arv);
+        std::cout << "N = " << n << ": LLRB = " << somaArvore/num_rodadas << " s, LLRB congelada = " << somaCongelada/num_rodadas << " s (congelar: " << tempo_congela << " s)" << std::endl;
+    }
     std::cout<<std::endl;
     free(tempo_LLRB); //Libera o vetor
+    free(consultas);
 
-    if((encontrouLLRB==0)||(encontrouMapa==0))
+    if((encontrouLLRB==0)||(encontrouMapa==0)||(encontrouLote==0)||(encontrouCongelada==0)||(encontrouGenerica==0))
         std::cout << "Elemento nao encontrado. Desconsiderar dados!!!" << std::endl;
 
     return 0;
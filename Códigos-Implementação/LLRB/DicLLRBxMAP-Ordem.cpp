@@ -0,0 +1,177 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <algorithm>
+#include <iterator>
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore LLRB
+
+//Teste das estatsticas de ordem da LLRB (LLRB/ArvoreLLRBOrdem.h)
+//1) Custo de manter o tamanho das subrvores: insere e remove N chaves em ordem aleatria na LLRB normal e na LLRB
+//   com estatsticas de ordem, para decidir se vale a pena ligar o modo
+//2) Consultas de ordem: posio (rank), seleo (select) e contagem de intervalo na rvore com as chaves 0, 2, 4...2(N-1),
+//   comparadas com o std::map, que precisa andar elemento por elemento (std::distance, std::next): O(N) por consulta
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreLLRB.h" //Implementao da LLRB (compartilhada pelos programas de teste)
+#include "ArvoreLLRBOrdem.h" //Estatsticas de ordem
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int N = 1000000; //Nmero de chaves. Range 500.000-15.000.000
+    int num_rodadas = 1000000; //Nmero de consultas de ordem na LLRB
+    int num_rodadas_mapa = 100; //Nmero de consultas de ordem no Mapa (cada uma custa O(N))
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    long long ok; //Operaes que deram certo
+    std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
+    std::cout<<std::endl;
+
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chaves 0, 2, 4...2(N-1) embaralhadas
+    for(int i=0;i<N;i++)
+        chaves[i] = 2 * i;
+    std::mt19937 gerador(42);
+    std::shuffle(chaves, chaves + N, gerador);
+
+    //=============================Custo de manter o tamanho=======================
+    std::cout<<"Custo de manter o tamanho das subarvores"<<std::endl;
+    ArvLLRB* llrb = cria_ArvLLRB(modo_alocacao);
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += insere_ArvLLRB(llrb, chaves[i], chaves[i]);
+    double base_insere = tmr.elapsed();
+    if(ok != N) erro = 1;
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += remove_ArvLLRB(llrb, chaves[i]);
+    double base_remove = tmr.elapsed();
+    if(ok != N) erro = 1;
+    libera_ArvLLRB(llrb);
+    std::cout << "LLRB - tempo: insercao = " << base_insere << " s, remocao = " << base_remove << " s" << std::endl;
+
+    llrb = cria_ArvLLRB(modo_alocacao);
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += insereOrdem_ArvLLRB(llrb, chaves[i], chaves[i]);
+    double tempo_insere = tmr.elapsed();
+    if(ok != N || tamanho_ArvLLRB(llrb) != N) erro = 1;
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += removeOrdem_ArvLLRB(llrb, chaves[i]);
+    double tempo_remove = tmr.elapsed();
+    if(ok != N || tamanho_ArvLLRB(llrb) != 0) erro = 1;
+    libera_ArvLLRB(llrb);
+    std::cout << "LLRB com estatisticas de ordem - tempo: insercao = " << tempo_insere << " s (" << tempo_insere / base_insere << "x), remocao = " << tempo_remove << " s (" << tempo_remove / base_remove << "x)" << std::endl;
+    std::cout<<std::endl;
+
+    //=============================Consultas de ordem==============================
+    std::cout<<"Consultas de ordem"<<std::endl;
+    llrb = cria_ArvLLRB(modo_alocacao);
+    std::map<int, int> Mapa;
+    for(int i=0;i<N;i++){
+        insereOrdem_ArvLLRB(llrb, chaves[i], chaves[i]);
+        Mapa.insert(std::pair<int, int>(chaves[i], chaves[i]));
+    }
+    int *consultas = (int *)malloc(num_rodadas * sizeof(int)); //Valores entre 0 e 2N: metade est na rvore
+    std::uniform_int_distribution<int> sorteio(0, 2 * N);
+    for(int j=0;j<num_rodadas;j++)
+        consultas[j] = sorteio(gerador);
+
+    //Posio: quantas chaves so menores que x. Com as chaves pares, so (x + 1) / 2
+    long long soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++)
+        soma += posicao_ArvLLRB(llrb, consultas[j]);
+    double tempo_posicao = tmr.elapsed() / num_rodadas;
+    long long esperado = 0;
+    for(int j=0;j<num_rodadas;j++)
+        esperado += (consultas[j] + 1) / 2;
+    if(soma != esperado) erro = 1;
+
+    //Seleo: a i-sima chave  2i
+    int chave, valor;
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++){
+        seleciona_ArvLLRB(llrb, consultas[j] / 2 % N, &chave, &valor);
+        soma += chave;
+    }
+    double tempo_seleciona = tmr.elapsed() / num_rodadas;
+    esperado = 0;
+    for(int j=0;j<num_rodadas;j++)
+        esperado += 2LL * (consultas[j] / 2 % N);
+    if(soma != esperado) erro = 1;
+
+    //Contagem de intervalo: chaves pares em [lo, lo + 1000]
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas;j++)
+        soma += contaIntervalo_ArvLLRB(llrb, consultas[j], consultas[j] + 1000);
+    double tempo_intervalo = tmr.elapsed() / num_rodadas;
+    esperado = 0;
+    for(int j=0;j<num_rodadas;j++){
+        int lo = consultas[j], hi = std::min(consultas[j] + 1000, 2 * (N - 1));
+        if(lo <= hi)
+            esperado += hi / 2 - (lo + 1) / 2 + 1;
+    }
+    if(soma != esperado) erro = 1;
+    std::cout << "LLRB - tempo medio: posicao = " << tempo_posicao << " s, selecao = " << tempo_seleciona << " s, intervalo = " << tempo_intervalo << " s" << std::endl;
+
+    //Mapa: mesmas consultas (s as primeiras num_rodadas_mapa)
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas_mapa;j++)
+        soma += std::distance(Mapa.begin(), Mapa.lower_bound(consultas[j]));
+    double mapa_posicao = tmr.elapsed() / num_rodadas_mapa;
+    for(int j=0;j<num_rodadas_mapa;j++)
+        soma -= (consultas[j] + 1) / 2;
+    if(soma != 0) erro = 1;
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas_mapa;j++)
+        soma += std::next(Mapa.begin(), consultas[j] / 2 % N)->first;
+    double mapa_seleciona = tmr.elapsed() / num_rodadas_mapa;
+    for(int j=0;j<num_rodadas_mapa;j++)
+        soma -= 2LL * (consultas[j] / 2 % N);
+    if(soma != 0) erro = 1;
+    soma = 0;
+    tmr.reset();
+    for(int j=0;j<num_rodadas_mapa;j++)
+        soma += std::distance(Mapa.lower_bound(consultas[j]), Mapa.upper_bound(consultas[j] + 1000));
+    double mapa_intervalo = tmr.elapsed() / num_rodadas_mapa;
+    for(int j=0;j<num_rodadas_mapa;j++)
+        soma -= contaIntervalo_ArvLLRB(llrb, consultas[j], consultas[j] + 1000);
+    if(soma != 0) erro = 1;
+    std::cout << "Mapa - tempo medio: posicao = " << mapa_posicao << " s, selecao = " << mapa_seleciona << " s, intervalo = " << mapa_intervalo << " s" << std::endl;
+    std::cout<<std::endl;
+
+    libera_ArvLLRB(llrb);
+    free(consultas);
+    free(chaves);
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
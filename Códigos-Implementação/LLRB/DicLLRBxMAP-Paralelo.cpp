@@ -0,0 +1,219 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore rubro-negra
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <random>
+#include <algorithm>
+
+//Teste com vrias threads: dicionrio particionado em vrias LLRBs (Comum/Particionado.h), cada uma com a sua trava,
+//contra um nico Mapa protegido por uma trava s
+//Para cada quantidade de threads (1, 2, 4... max_threads) mede quantas operaes por segundo (somando todas as threads)
+//cada estrutura faz ao inserir, buscar e remover N chaves em ordem aleatria
+//Depois, o modo com um escritor e vrios leitores (LLRB/ArvoreLLRBConcorrente.h): T threads buscam sem trava enquanto
+//uma thread insere e remove sem parar, contra o Mapa com uma trava de leitura e escrita (std::shared_mutex)
+//Importante utilizar as flags -O3 e -pthread
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreLLRB.h" //Implementao da rvore LLRB (compartilhada pelos programas de teste)
+#include "../Comum/Particionado.h" //Dicionrio particionado com uma trava por parte
+#include "ArvoreLLRBConcorrente.h" //Modo com um escritor e vrios leitores
+
+//Divide as posies 0..N-1 do vetor de chaves entre num_threads threads e executa op(ini, fim) em cada uma
+//Retorna o tempo at a ltima thread terminar
+template <class F>
+double executa(int num_threads, int N, F op){
+    Timer tmr;
+    std::vector<std::thread> threads;
+    for(int t=0;t<num_threads;t++)
+        threads.push_back(std::thread(op, (int)((long long)N * t / num_threads), (int)((long long)N * (t + 1) / num_threads)));
+    for(size_t t=0;t<threads.size();t++)
+        threads[t].join();
+    return tmr.elapsed();
+}
+
+//Exemplo de uso
+int main(){
+    int N = 4000000; //Nmero de chaves. Range 500.000-15.000.000
+    int max_threads = 8; //Nmero mximo de threads. O teste  feito com 1, 2, 4... max_threads
+    int num_particoes = 64; //Nmero de partes (rvores) do dicionrio particionado. Mais partes que threads diminui a disputa pelas travas
+    int modo_alocacao = ALOCA_MALLOC; //Alocao dos ns das rvores: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    std::cout<<"N = "<<N<<" - Particoes = "<<num_particoes<<" - Nucleos = "<<std::thread::hardware_concurrency()<<std::endl;
+    std::cout<<std::endl;
+
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chaves 0..N-1 embaralhadas, para que as threads acessem todas as partes
+    for(int i=0;i<N;i++)
+        chaves[i] = i;
+    std::mt19937 gerador(42);
+    std::shuffle(chaves, chaves + N, gerador);
+
+    for(int T=1;T<=max_threads;T*=2)
+    {
+        std::cout<<"Threads = "<<T<<std::endl;
+        std::atomic<long long> contador(0); //Quantas operaes deram certo, somando todas as threads
+        //=============================Mapa============================================
+        std::map<int, int> Mapa;
+        std::mutex trava_mapa; //Uma trava para o Mapa inteiro
+        contador = 0;
+        double tempo_insere = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++){
+                std::lock_guard<std::mutex> trava(trava_mapa);
+                ok += Mapa.insert(std::pair<int, int>(chaves[i], chaves[i])).second;
+            }
+            contador += ok;
+        });
+        if(contador != N) erro = 1;
+        contador = 0;
+        double tempo_busca = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++){
+                std::lock_guard<std::mutex> trava(trava_mapa);
+                ok += (Mapa.find(chaves[i]) != Mapa.end());
+            }
+            contador += ok;
+        });
+        if(contador != N) erro = 1;
+        contador = 0;
+        double tempo_remove = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++){
+                std::lock_guard<std::mutex> trava(trava_mapa);
+                ok += Mapa.erase(chaves[i]);
+            }
+            contador += ok;
+        });
+        if(contador != N) erro = 1;
+        std::cout << "Mapa (1 trava) - operacoes por segundo: insercao = " << N/tempo_insere << ", busca = " << N/tempo_busca << ", remocao = " << N/tempo_remove << std::endl;
+
+        //============================LLRB particionada===============================
+        struct DicParticionado<MotorLLRB> *dic = cria_DicParticionado<MotorLLRB>(num_particoes, 0, N - 1, modo_alocacao);
+        contador = 0;
+        tempo_insere = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++)
+                ok += insere_DicParticionado(dic, chaves[i], chaves[i]);
+            contador += ok;
+        });
+        if(contador != N) erro = 1;
+        contador = 0;
+        tempo_busca = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++)
+                ok += consulta_DicParticionado(dic, chaves[i]);
+            contador += ok;
+        });
+        if(contador != N) erro = 1;
+        contador = 0;
+        tempo_remove = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++)
+                ok += remove_DicParticionado(dic, chaves[i]);
+            contador += ok;
+        });
+        if(contador != N) erro = 1;
+        libera_DicParticionado(dic);
+        std::cout << "LLRB (" << num_particoes << " partes) - operacoes por segundo: insercao = " << N/tempo_insere << ", busca = " << N/tempo_busca << ", remocao = " << N/tempo_remove << std::endl;
+        std::cout<<std::endl;
+    }
+
+    //======================Um escritor e vrios leitores==========================
+    //As chaves pares 2*chaves[i] ficam sempre na estrutura: os leitores buscam todas elas (N buscas, divididas entre as T threads)
+    //O escritor insere uma chave mpar aleatria e a remove em seguida, sem parar, at os leitores terminarem
+    std::cout<<"Um escritor e varios leitores"<<std::endl;
+    std::map<int, int> Mapa;
+    std::shared_mutex trava_mapa; //Leitores entram juntos, o escritor entra sozinho
+    ArvLLRB* arv = criaConcorrente_ArvLLRB(modo_alocacao);
+    for(int i=0;i<N;i++){
+        Mapa.insert(std::pair<int, int>(2 * chaves[i], chaves[i]));
+        insereEscritor_ArvLLRB(arv, 2 * chaves[i], chaves[i]);
+    }
+    for(int T=1;T<=max_threads;T*=2)
+    {
+        std::atomic<long long> contador(0); //Buscas que encontraram a chave
+        std::atomic<int> lendo(T); //Leitores que ainda no terminaram
+        long long atualizacoes = 0; //Inseres e remoes feitas pelo escritor
+        std::thread escritor([&](){
+            std::mt19937 gerador_escritor(T);
+            int chave = 1; //Inserida na vez par e removida na vez mpar
+            while(lendo > 0){
+                if(atualizacoes % 2 == 0)
+                    chave = 2 * (int)(gerador_escritor() % N) + 1; //Gera fora da trava
+                std::unique_lock<std::shared_mutex> trava(trava_mapa);
+                if(atualizacoes % 2 == 0)
+                    Mapa.insert(std::pair<int, int>(chave, chave));
+                else
+                    Mapa.erase(chave);
+                atualizacoes++;
+            }
+        });
+        double tempo_busca = executa(T, N, [&](int ini, int fim){
+            long long ok = 0;
+            for(int i=ini;i<fim;i++){
+                std::shared_lock<std::shared_mutex> trava(trava_mapa);
+                ok += (Mapa.find(2 * chaves[i]) != Mapa.end());
+            }
+            contador += ok;
+            lendo--;
+        });
+        escritor.join();
+        if(contador != N) erro = 1;
+        std::cout << "Leitores = " << T << std::endl;
+        std::cout << "Mapa (shared_mutex) - buscas por segundo = " << N/tempo_busca << ", atualizacoes por segundo = " << atualizacoes/tempo_busca << std::endl;
+
+        contador = 0;
+        lendo = T;
+        atualizacoes = 0;
+        escritor = std::thread([&](){
+            std::mt19937 gerador_escritor(T);
+            int chave = 1; //Inserida na vez par e removida na vez mpar
+            while(lendo > 0){
+                if(atualizacoes % 2 == 0){
+                    chave = 2 * (int)(gerador_escritor() % N) + 1;
+                    insereEscritor_ArvLLRB(arv, chave, chave);
+                }else
+                    removeEscritor_ArvLLRB(arv, chave);
+                atualizacoes++;
+            }
+        });
+        tempo_busca = executa(T, N, [&](int ini, int fim){
+            int leitor = registraLeitor_ArvLLRB(arv);
+            long long ok = 0;
+            for(int i=ini;i<fim;i++)
+                ok += consultaLeitor_ArvLLRB(arv, leitor, 2 * chaves[i]);
+            contador += ok;
+            lendo--;
+        });
+        escritor.join();
+        if(contador != N) erro = 1;
+        std::cout << "LLRB (sem trava) - buscas por segundo = " << N/tempo_busca << ", atualizacoes por segundo = " << atualizacoes/tempo_busca << std::endl;
+        std::cout<<std::endl;
+    }
+    liberaConcorrente_ArvLLRB(arv);
+    free(chaves);
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
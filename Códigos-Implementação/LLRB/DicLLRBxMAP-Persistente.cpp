@@ -0,0 +1,152 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <algorithm>
+
+//Teste do modo persistente da LLRB (LLRB/ArvoreLLRBPersistente.h)
+//1) Custo por atualizao: insere e remove N chaves em ordem aleatria na LLRB normal (alterao no lugar),
+//   na persistente sem verses guardadas (nada  copiado) e na persistente guardando a verso antes de cada
+//   atualizao (o caminho inteiro  copiado toda vez)
+//2) Memria de K verses vivas: a partir de uma rvore com N chaves, faz N atualizaes guardando uma verso a cada N/K.
+//   Mostra os ns vivos somando todas as verses, comparados com K+1 cpias inteiras da rvore (a atual e as guardadas)
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreLLRB.h" //Implementao da rvore LLRB (compartilhada pelos programas de teste)
+#include "ArvoreLLRBPersistente.h" //Modo persistente
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int N = 1000000; //Nmero de chaves. Range 500.000-15.000.000
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    long long ok; //Operaes que deram certo
+    std::cout<<"N = "<<N<<std::endl;
+    std::cout<<std::endl;
+
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chaves 0..N-1 embaralhadas
+    for(int i=0;i<N;i++)
+        chaves[i] = i;
+    std::mt19937 gerador(42);
+    std::shuffle(chaves, chaves + N, gerador);
+
+    //=============================Custo por atualizao===========================
+    std::cout<<"Custo por atualizacao"<<std::endl;
+    //LLRB normal: alterao no lugar
+    ArvLLRB* llrb = cria_ArvLLRB(modo_alocacao);
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += insere_ArvLLRB(llrb, chaves[i], chaves[i]);
+    double tempo_insere = tmr.elapsed();
+    if(ok != N) erro = 1;
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += remove_ArvLLRB(llrb, chaves[i]);
+    double tempo_remove = tmr.elapsed();
+    if(ok != N) erro = 1;
+    libera_ArvLLRB(llrb);
+    std::cout << "LLRB (no lugar) - tempo: insercao = " << tempo_insere << " s, remocao = " << tempo_remove << " s" << std::endl;
+    double base_insere = tempo_insere, base_remove = tempo_remove;
+
+    //LLRB persistente sem verses guardadas: todos os ns tm uma referncia e so alterados no lugar
+    llrb = criaPersistente_ArvLLRB(modo_alocacao);
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += inserePersistente_ArvLLRB(llrb, chaves[i], chaves[i]);
+    tempo_insere = tmr.elapsed();
+    if(ok != N) erro = 1;
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        ok += removePersistente_ArvLLRB(llrb, chaves[i]);
+    tempo_remove = tmr.elapsed();
+    if(ok != N || nosPersistente_ArvLLRB(llrb) != 0) erro = 1;
+    std::cout << "LLRB persistente (sem versoes guardadas) - tempo: insercao = " << tempo_insere << " s (" << tempo_insere / base_insere << "x), remocao = " << tempo_remove << " s (" << tempo_remove / base_remove << "x)" << std::endl;
+
+    //LLRB persistente guardando a verso antes de cada atualizao (e soltando a anterior): o caminho  sempre copiado
+    ok = 0;
+    ArvLLRB versao = NULL;
+    tmr.reset();
+    for(int i=0;i<N;i++){
+        soltaVersao_ArvLLRB(llrb, versao);
+        versao = guardaVersao_ArvLLRB(llrb);
+        ok += inserePersistente_ArvLLRB(llrb, chaves[i], chaves[i]);
+    }
+    tempo_insere = tmr.elapsed();
+    if(ok != N) erro = 1;
+    ok = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++){
+        soltaVersao_ArvLLRB(llrb, versao);
+        versao = guardaVersao_ArvLLRB(llrb);
+        ok += removePersistente_ArvLLRB(llrb, chaves[i]);
+    }
+    tempo_remove = tmr.elapsed();
+    soltaVersao_ArvLLRB(llrb, versao);
+    if(ok != N || nosPersistente_ArvLLRB(llrb) != 0) erro = 1;
+    std::cout << "LLRB persistente (versao guardada a cada atualizacao) - tempo: insercao = " << tempo_insere << " s (" << tempo_insere / base_insere << "x), remocao = " << tempo_remove << " s (" << tempo_remove / base_remove << "x)" << std::endl;
+    liberaPersistente_ArvLLRB(llrb);
+    std::cout<<std::endl;
+
+    //=============================Memria de K verses vivas======================
+    //Cada atualizao troca uma chave: remove chaves[i] e insere chaves[i] + N
+    std::cout<<"Memoria de K versoes vivas ("<<N<<" atualizacoes, uma versao guardada a cada N/K)"<<std::endl;
+    int quant_versoes[5] = {1, 10, 100, 1000, 10000};
+    ArvLLRB *versoes = (ArvLLRB *)malloc(10000 * sizeof(ArvLLRB));
+    for(int q=0;q<5;q++)
+    {
+        int K = quant_versoes[q];
+        llrb = criaPersistente_ArvLLRB(modo_alocacao);
+        for(int i=0;i<N;i++)
+            inserePersistente_ArvLLRB(llrb, chaves[i], chaves[i]);
+        int guardadas = 0;
+        ok = 0;
+        tmr.reset();
+        for(int i=0;i<N;i++){
+            if(i % (N / K) == 0 && guardadas < K) //Distribui as K verses ao longo das atualizaes
+                versoes[guardadas++] = guardaVersao_ArvLLRB(llrb);
+            ok += removePersistente_ArvLLRB(llrb, chaves[i]);
+            ok += inserePersistente_ArvLLRB(llrb, chaves[i] + N, chaves[i]);
+        }
+        double tempo = tmr.elapsed();
+        if(ok != 2LL * N) erro = 1;
+        for(int k=0;k<guardadas;k++) //Cada verso guardada continua com N chaves
+            if(!consulta_ArvLLRB(&versoes[k], chaves[N - 1]))
+                erro = 1;
+        size_t nos = nosPersistente_ArvLLRB(llrb); //Verso atual mais as K guardadas
+        std::cout << "K = " << K << " - nos vivos = " << nos << " (" << (double) nos / N << " arvores), MB = " << (double) nos * sizeof(struct NO) / (1024 * 1024)
+                  << ", K+1 copias inteiras = " << (double)(K + 1) * N * sizeof(struct NO) / (1024 * 1024) << " MB, tempo = " << tempo << " s" << std::endl;
+        for(int k=0;k<guardadas;k++)
+            soltaVersao_ArvLLRB(llrb, versoes[k]);
+        if(nosPersistente_ArvLLRB(llrb) != (size_t) N) erro = 1; //S sobra a verso atual
+        liberaPersistente_ArvLLRB(llrb);
+    }
+    free(versoes);
+    free(chaves);
+    std::cout<<std::endl;
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
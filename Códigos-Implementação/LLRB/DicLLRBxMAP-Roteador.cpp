@@ -0,0 +1,293 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <map> //Biblioteca padro para comparar com a tabela de rotas na LLRB
+
+//Teste da tabela de rotas na LLRB (LLRB/ArvoreLLRBRoteador.h): busca pelo prefixo mais longo, insero e remoo de prefixos
+//Para IPv4 e IPv6 geramos uma tabela sinttica de N prefixos, com a distribuio de tamanhos parecida com a de uma
+//tabela BGP (a maioria /24 no IPv4 e /48 no IPv6), e uma sequncia de endereos para consultar: 90% caem dentro de
+//algum prefixo sorteado e 10% so endereos quaisquer
+//Comparamos com trs solues comuns:
+//  Trie binria: um n por bit do prefixo, a busca desce bit a bit guardando o ltimo prefixo visto (O(W), W = bits do endereo)
+//  Mapa por tamanho: um std::map por tamanho de prefixo, consultados do mais longo para o mais curto (O(W log N))
+//  Varredura linear: percorre todos os prefixos (O(N)), s para poucas consultas
+//Todas as respostas so conferidas entre si, antes e depois de remover metade dos prefixos
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreLLRBRoteador.h" //Tabela de rotas na LLRB
+
+//==================Trie binria==========================
+//Os ns ficam num vetor e os filhos so ndices (0 = no tem filho, o n 0  a raiz)
+struct NOTrie{
+    int filho[2];
+    int salto; //-1 se nenhum prefixo termina neste n
+};
+
+struct Trie{
+    struct NOTrie *nos;
+    int quant, capacidade;
+};
+
+void cria_Trie(struct Trie *t){
+    t->capacidade = 1 << 20;
+    t->nos = (struct NOTrie *)malloc(t->capacidade * sizeof(struct NOTrie));
+    t->nos[0].filho[0] = t->nos[0].filho[1] = 0;
+    t->nos[0].salto = -1;
+    t->quant = 1;
+}
+
+//Bit i do endereo, contando a partir do mais significativo
+template <class Endereco>
+int bit_Endereco(Endereco a, int i){
+    return (int) ((a >> (bits_Endereco<Endereco>() - 1 - i)) & 1);
+}
+
+//Procura o n do prefixo, criando os que faltam no caminho
+template <class Endereco>
+int no_Trie(struct Trie *t, Endereco prefixo, int tamanho){
+    int no = 0;
+    for(int i=0;i<tamanho;i++){
+        int b = bit_Endereco(prefixo, i);
+        if(t->nos[no].filho[b] == 0){
+            if(t->quant == t->capacidade){
+                t->capacidade *= 2;
+                t->nos = (struct NOTrie *)realloc(t->nos, t->capacidade * sizeof(struct NOTrie));
+            }
+            t->nos[t->quant].filho[0] = t->nos[t->quant].filho[1] = 0;
+            t->nos[t->quant].salto = -1;
+            t->nos[no].filho[b] = t->quant++;
+        }
+        no = t->nos[no].filho[b];
+    }
+    return no;
+}
+
+//Insere o prefixo. Retorna 1 se inseriu ou 0 se ele j estava na trie
+template <class Endereco>
+int insere_Trie(struct Trie *t, Endereco prefixo, int tamanho, int salto){
+    int no = no_Trie(t, prefixo, tamanho);
+    if(t->nos[no].salto >= 0)
+        return 0;
+    t->nos[no].salto = salto;
+    return 1;
+}
+
+//Remove o prefixo s desmarcando o n (os ns do caminho continuam na trie). Retorna 1 se removeu
+template <class Endereco>
+int remove_Trie(struct Trie *t, Endereco prefixo, int tamanho){
+    int no = no_Trie(t, prefixo, tamanho);
+    if(t->nos[no].salto < 0)
+        return 0;
+    t->nos[no].salto = -1;
+    return 1;
+}
+
+//Prefixo mais longo: desce pelos bits do endereo guardando o ltimo salto encontrado
+template <class Endereco>
+int busca_Trie(struct Trie *t, Endereco endereco){
+    int no = 0, salto = t->nos[0].salto;
+    for(int i=0;i<bits_Endereco<Endereco>();i++){
+        no = t->nos[no].filho[bit_Endereco(endereco, i)];
+        if(no == 0)
+            break;
+        if(t->nos[no].salto >= 0)
+            salto = t->nos[no].salto;
+    }
+    return salto;
+}
+//==================================================
+
+//Endereo aleatrio, 32 bits por vez
+template <class Endereco>
+Endereco sorteia_Endereco(std::mt19937 &gerador){
+    Endereco a = 0;
+    for(int i=0;i<(int) sizeof(Endereco) / 4;i++)
+        a = ((a << 16) << 16) | (Endereco) gerador();
+    return a;
+}
+
+//Uma rodada completa para um tipo de endereo
+//pesos[t]  a chance relativa de um prefixo ter tamanho t. Os endereos sorteados recebem os bits fixos de "topo" (2000::/3 no IPv6)
+template <class Endereco>
+void testa_Roteador(const char *nome, int N, int num_rodadas, int num_rodadas_linear, const double *pesos, Endereco topo, int bits_topo, int modo_alocacao, int *erro){
+    Timer tmr;
+    int W = bits_Endereco<Endereco>();
+    std::mt19937 gerador(42);
+    std::discrete_distribution<int> sorteio_tamanho(pesos, pesos + W + 1);
+    Endereco *prefixos = (Endereco *)malloc(N * sizeof(Endereco));
+    int *tamanhos = (int *)malloc(N * sizeof(int));
+    for(int i=0;i<N;i++){
+        tamanhos[i] = sorteio_tamanho(gerador);
+        Endereco a = (sorteia_Endereco<Endereco>(gerador) & sufixo_Endereco<Endereco>(bits_topo)) | topo;
+        prefixos[i] = a & ~sufixo_Endereco<Endereco>(tamanhos[i]);
+    }
+    Endereco *consultas = (Endereco *)malloc(num_rodadas * sizeof(Endereco));
+    std::uniform_int_distribution<int> sorteio_prefixo(0, N - 1);
+    for(int j=0;j<num_rodadas;j++){
+        Endereco a = sorteia_Endereco<Endereco>(gerador);
+        if(gerador() % 10 != 0){ //Endereo dentro de um prefixo da tabela
+            int i = sorteio_prefixo(gerador);
+            a = prefixos[i] | (a & sufixo_Endereco<Endereco>(tamanhos[i]));
+        }
+        consultas[j] = a;
+    }
+    std::cout << nome << ": N = " << N << " prefixos - Numero de consultas = " << num_rodadas << std::endl;
+
+    //=============================Insero=======================================
+    //Prefixos repetidos so recusados por todas as estruturas; o salto de cada prefixo  a posio em que ele foi sorteado
+    struct TabRotas<Endereco>* tab = cria_TabRotas<Endereco>(modo_alocacao);
+    int inseridos = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        inseridos += insere_TabRotas(tab, prefixos[i], tamanhos[i], i);
+    double llrb_insere = tmr.elapsed();
+
+    struct Trie trie;
+    cria_Trie(&trie);
+    int inseridos_trie = 0;
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        inseridos_trie += insere_Trie(&trie, prefixos[i], tamanhos[i], i);
+    double trie_insere = tmr.elapsed();
+
+    std::map<Endereco, int> *Mapas = new std::map<Endereco, int>[W + 1]; //Mapas[t]: prefixos de tamanho t
+    tmr.reset();
+    for(int i=0;i<N;i++)
+        Mapas[tamanhos[i]].insert(std::pair<Endereco, int>(prefixos[i], i));
+    double mapa_insere = tmr.elapsed();
+    if(inseridos != inseridos_trie) *erro = 1;
+    std::cout << "Prefixos distintos = " << inseridos << ", nos da trie = " << trie.quant << std::endl;
+    std::cout << "Tempo de insercao: LLRB = " << llrb_insere << " s, Trie = " << trie_insere << " s, Mapa por tamanho = " << mapa_insere << " s" << std::endl;
+
+    //=============================Consultas======================================
+    //Duas vezes: com a tabela cheia e depois de remover metade dos prefixos. A soma dos saltos encontrados
+    //(-1 para quem no tem rota) confere as estruturas entre si
+    for(int fase=0;fase<2;fase++){
+        if(fase == 1){
+            int removidos = 0, removidos_trie = 0;
+            tmr.reset();
+            for(int i=0;i<N;i+=2)
+                removidos += remove_TabRotas(tab, prefixos[i], tamanhos[i]);
+            double llrb_remove = tmr.elapsed();
+            tmr.reset();
+            for(int i=0;i<N;i+=2)
+                removidos_trie += remove_Trie(&trie, prefixos[i], tamanhos[i]);
+            double trie_remove = tmr.elapsed();
+            tmr.reset();
+            for(int i=0;i<N;i+=2)
+                Mapas[tamanhos[i]].erase(prefixos[i]);
+            double mapa_remove = tmr.elapsed();
+            if(removidos != removidos_trie) *erro = 1;
+            std::cout << "Tempo de remocao de metade dos prefixos: LLRB = " << llrb_remove << " s, Trie = " << trie_remove
+                      << " s, Mapa por tamanho = " << mapa_remove << " s" << std::endl;
+        }
+
+        long long soma_llrb = 0, soma_trie = 0, soma_mapa = 0;
+        int salto, tamanho, achou = 0;
+        tmr.reset();
+        for(int j=0;j<num_rodadas;j++){
+            if(busca_TabRotas(tab, consultas[j], &salto, &tamanho)){
+                soma_llrb += salto;
+                achou++;
+            }else
+                soma_llrb--;
+        }
+        double llrb_busca = tmr.elapsed() / num_rodadas;
+
+        tmr.reset();
+        for(int j=0;j<num_rodadas;j++)
+            soma_trie += busca_Trie(&trie, consultas[j]);
+        double trie_busca = tmr.elapsed() / num_rodadas;
+
+        tmr.reset();
+        for(int j=0;j<num_rodadas;j++){
+            int resp = -1;
+            for(int t=W;t>=0 && resp < 0;t--){ //Do tamanho mais longo para o mais curto
+                if(Mapas[t].empty())
+                    continue;
+                typename std::map<Endereco, int>::iterator m = Mapas[t].find(consultas[j] & ~sufixo_Endereco<Endereco>(t));
+                if(m != Mapas[t].end())
+                    resp = m->second;
+            }
+            soma_mapa += resp;
+        }
+        double mapa_busca = tmr.elapsed() / num_rodadas;
+
+        //Varredura linear: o prefixo mais longo entre todos os que esto na tabela (os de posio mpar depois da remoo)
+        //Com prefixos repetidos, a remoo pode tirar da tabela um prefixo que a varredura ainda v, ento ela s confere a tabela cheia
+        long long soma_linear = 0, soma_llrb_linear = 0;
+        tmr.reset();
+        for(int j=0;j<num_rodadas_linear;j++){
+            int resp = -1, maior = -1;
+            for(int i=fase;i<N;i+=fase+1)
+                if(tamanhos[i] > maior && (consultas[j] & ~sufixo_Endereco<Endereco>(tamanhos[i])) == prefixos[i]){
+                    maior = tamanhos[i];
+                    resp = i;
+                }
+            soma_linear += resp;
+        }
+        double linear_busca = tmr.elapsed() / num_rodadas_linear;
+        for(int j=0;j<num_rodadas_linear;j++)
+            soma_llrb_linear += busca_TabRotas(tab, consultas[j], &salto, NULL) ? salto : -1;
+
+        if(soma_llrb != soma_trie || soma_llrb != soma_mapa || (soma_linear != soma_llrb_linear && (fase == 0 || inseridos == N))) *erro = 1;
+        std::cout << (fase == 0 ? "Tabela cheia" : "Metade da tabela") << " (" << 100.0 * achou / num_rodadas << "% com rota) - tempo medio de busca: LLRB = "
+                  << llrb_busca << " s, Trie = " << trie_busca << " s, Mapa por tamanho = " << mapa_busca << " s, Linear = " << linear_busca << " s" << std::endl;
+    }
+    std::cout << std::endl;
+
+    free(prefixos);
+    free(tamanhos);
+    free(consultas);
+    delete [] Mapas;
+    free(trie.nos);
+    libera_TabRotas(tab);
+}
+
+//Exemplo de uso
+int main(){
+    int N = 1000000; //Nmero de prefixos. Range 500.000-2.000.000
+    int num_rodadas = 1000000; //Nmero de consultas na LLRB, na trie e nos mapas
+    int num_rodadas_linear = 100; //Nmero de consultas na varredura linear (cada uma custa O(N)). Tambm conferem a LLRB
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+
+    //Tamanhos dos prefixos, com pesos parecidos com os de uma tabela BGP
+    double pesos4[33] = {0};
+    for(int t=8;t<=15;t++)
+        pesos4[t] = 0.2;
+    pesos4[16] = 3; pesos4[17] = 2; pesos4[18] = 3; pesos4[19] = 5; pesos4[20] = 6;
+    pesos4[21] = 6; pesos4[22] = 10; pesos4[23] = 10; pesos4[24] = 55;
+    for(int t=25;t<=32;t++)
+        pesos4[t] = 0.5;
+    double pesos6[129] = {0};
+    for(int t=16;t<=64;t++)
+        pesos6[t] = 0.5;
+    pesos6[29] = 3; pesos6[32] = 10; pesos6[36] = 4; pesos6[40] = 6; pesos6[44] = 8;
+    pesos6[46] = 3; pesos6[47] = 3; pesos6[48] = 40; pesos6[56] = 5; pesos6[64] = 5;
+
+    testa_Roteador<uint32_t>("IPv4", N, num_rodadas, num_rodadas_linear, pesos4, 0, 0, modo_alocacao, &erro);
+    testa_Roteador<unsigned __int128>("IPv6", N, num_rodadas, num_rodadas_linear, pesos6, ((unsigned __int128) 1) << 125, 3, modo_alocacao, &erro); //2000::/3
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <random>
+#include <algorithm>
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore LLRB
+
+//Teste dos iteradores e da varredura de intervalo da LLRB (Comum/Iterador.h)
+//1) Percurso completo em ordem crescente e decrescente, comparado com begin()..end() e rbegin()..rend() do std::map
+//2) Varreduras de intervalos [lo, lo + largura] sorteados, comparadas com lower_bound() seguido de ++ no std::map
+//As chaves so 0, 2, 4...2(N-1), inseridas em ordem aleatria, ento a soma das chaves visitadas  conhecida. A informao de
+//cada chave  chave + 1: a varredura tambm soma as informaes, que tm que dar a soma das chaves + as chaves visitadas
+//Antes dos testes as chaves mpares entram e saem de novo, para que a remoo de ns com dois filhos (que os preenche com o
+//sucessor) tambm seja conferida
+//Importante utilizar a flag -O3 para otimizar o cdigo e obter resultados coerentes
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreLLRB.h" //Implementao da LLRB (compartilhada pelos programas de teste)
+
+//Soma das chaves pares em [lo, hi], limitadas a 0..2(N-1)
+long long somaPares(long long lo, long long hi, int N){
+    if(lo < 0) lo = 0;
+    if(hi > 2LL * (N - 1)) hi = 2LL * (N - 1);
+    long long a = (lo + 1) / 2, b = hi / 2; //Chaves 2a..2b
+    if(a > b)
+        return 0;
+    return (a + b) * (b - a + 1);
+}
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int N = 1000000; //Nmero de chaves. Range 500.000-15.000.000
+    int num_percursos = 10; //Nmero de percursos completos em cada sentido
+    int num_varreduras = 1000; //Nmero de varreduras de intervalo
+    int largura = 20000; //Largura de cada intervalo (largura / 2 chaves por varredura)
+    int modo_alocacao = ALOCA_ARENA; //Alocao dos ns: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    int erro = 0; //Vira 1 se alguma operao no deu o resultado esperado
+    std::cout<<"N = "<<N<<" - Numero de varreduras = "<<num_varreduras<<" - Largura = "<<largura<<std::endl;
+    std::cout<<std::endl;
+
+    int *chaves = (int *)malloc(N * sizeof(int)); //Chaves 0, 2, 4...2(N-1) embaralhadas
+    for(int i=0;i<N;i++)
+        chaves[i] = 2 * i;
+    std::mt19937 gerador(42);
+    std::shuffle(chaves, chaves + N, gerador);
+
+    ArvLLRB* llrb = cria_ArvLLRB(modo_alocacao);
+    std::map<int, int> Mapa;
+    for(int i=0;i<N;i++){
+        insere_ArvLLRB(llrb, chaves[i], chaves[i] + 1);
+        Mapa.insert(std::pair<int, int>(chaves[i], chaves[i] + 1));
+    }
+    for(int i=0;i<N;i++) //Chaves mpares, na mesma ordem aleatria
+        insere_ArvLLRB(llrb, chaves[i] + 1, -1);
+    for(int i=0;i<N;i++)
+        if(remove_ArvLLRB(llrb, chaves[i] + 1) != 1) erro = 1;
+    long long total = somaPares(0, 2LL * (N - 1), N); //Soma de todas as chaves
+
+    //=============================Percurso completo===============================
+    std::cout<<"Percurso completo"<<std::endl;
+    struct Iterador<struct NO> it;
+    long long soma = 0;
+    tmr.reset();
+    for(int r=0;r<num_percursos;r++){
+        int anterior = -1;
+        iterador_ArvLLRB(llrb, &it);
+        for(struct NO* no = atual_Iterador(&it); no != NULL; avanca_Iterador(&it), no = atual_Iterador(&it)){
+            if(no->chave <= anterior) erro = 1; //Fora de ordem
+            anterior = no->chave;
+            soma += no->chave;
+        }
+    }
+    double llrb_crescente = tmr.elapsed() / num_percursos;
+    if(soma != total * num_percursos) erro = 1;
+
+    soma = 0;
+    tmr.reset();
+    for(int r=0;r<num_percursos;r++){
+        int anterior = 2 * N;
+        iterador_ArvLLRB(llrb, &it, 1);
+        for(struct NO* no = atual_Iterador(&it); no != NULL; avanca_Iterador(&it), no = atual_Iterador(&it)){
+            if(no->chave >= anterior) erro = 1;
+            anterior = no->chave;
+            soma += no->chave;
+        }
+    }
+    double llrb_decrescente = tmr.elapsed() / num_percursos;
+    if(soma != total * num_percursos) erro = 1;
+    std::cout << "LLRB - tempo medio: crescente = " << llrb_crescente << " s, decrescente = " << llrb_decrescente << " s" << std::endl;
+
+    soma = 0;
+    tmr.reset();
+    for(int r=0;r<num_percursos;r++)
+        for(std::map<int, int>::iterator m = Mapa.begin(); m != Mapa.end(); ++m)
+            soma += m->first;
+    double mapa_crescente = tmr.elapsed() / num_percursos;
+    if(soma != total * num_percursos) erro = 1;
+    soma = 0;
+    tmr.reset();
+    for(int r=0;r<num_percursos;r++)
+        for(std::map<int, int>::reverse_iterator m = Mapa.rbegin(); m != Mapa.rend(); ++m)
+            soma += m->first;
+    double mapa_decrescente = tmr.elapsed() / num_percursos;
+    if(soma != total * num_percursos) erro = 1;
+    std::cout << "Mapa - tempo medio: crescente = " << mapa_crescente << " s, decrescente = " << mapa_decrescente << " s" << std::endl;
+    std::cout<<std::endl;
+
+    //=============================Varredura de intervalo==========================
+    std::cout<<"Varredura de intervalo"<<std::endl;
+    int *inicios = (int *)malloc(num_varreduras * sizeof(int));
+    std::uniform_int_distribution<int> sorteio(0, 2 * N);
+    long long esperado = 0;
+    for(int j=0;j<num_varreduras;j++){
+        inicios[j] = sorteio(gerador);
+        esperado += somaPares(inicios[j], (long long)inicios[j] + largura, N);
+    }
+
+    soma = 0;
+    long long soma_info = 0, visitados = 0;
+    tmr.reset();
+    for(int j=0;j<num_varreduras;j++)
+        visitados += varre_ArvLLRB(llrb, inicios[j], inicios[j] + largura, [&soma, &soma_info](int chave, int info){ soma += chave; soma_info += info; });
+    double llrb_varre = tmr.elapsed();
+    if(soma != esperado || soma_info != soma + visitados) erro = 1;
+    std::cout << "LLRB - tempo: " << llrb_varre << " s (" << visitados / llrb_varre << " chaves/s)" << std::endl;
+
+    soma = 0;
+    soma_info = 0;
+    visitados = 0;
+    tmr.reset();
+    for(int j=0;j<num_varreduras;j++){
+        std::map<int, int>::iterator fim = Mapa.upper_bound(inicios[j] + largura);
+        for(std::map<int, int>::iterator m = Mapa.lower_bound(inicios[j]); m != fim; ++m){
+            soma += m->first;
+            soma_info += m->second;
+            visitados++;
+        }
+    }
+    double mapa_varre = tmr.elapsed();
+    if(soma != esperado || soma_info != soma + visitados) erro = 1;
+    std::cout << "Mapa - tempo: " << mapa_varre << " s (" << visitados / mapa_varre << " chaves/s)" << std::endl;
+    std::cout<<std::endl;
+
+    libera_ArvLLRB(llrb);
+    free(inicios);
+    free(chaves);
+
+    if(erro)
+        std::cout << "Alguma operacao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,476 @@
+#ifndef ARVORERB_H
+#define ARVORERB_H
+
+#include <cstdio>
+#include <cstdlib>
+#include "../Comum/Alocador.h" //Alocador de ns (malloc ou arena)
+#include "../Comum/ConsultaLote.h" //Consulta em lote com prefetch
+#include "../Comum/ArvoreCongelada.h" //Cpia somente leitura na ordem de Eytzinger
+#include "../Comum/Iterador.h" //Iteradores em ordem e varredura de intervalo
+#include "../Comum/ConsultaVizinho.h" //Consultas pela chave mais prxima
+
+//rvore Rubro-Negra clssica (Cormen et al., "Algoritmos: Teoria e Prtica", captulo 13)
+// a mesma variao usada pelo std::map, ento serve para ver quanto a simplicidade da LLRB custa em desempenho
+//Propriedades da rvore Rubro-Negra:
+//- Todo n deve ser preto ou vermelho
+//- A raiz  sempre preta
+//- Todo n folha (NULL)  preto
+//- Se um n  vemelho, ento os seus filhos so pretos (no existem ns vermelhos consecutivos)
+//- Todos os caminhos de um n para os ns folhas descendentes contm o mesmo nmero de ns pretos
+//Diferenas para a LLRB:
+//- Cada n guarda um ponteiro para o pai, ento insero e remoo so feitas sem recurso
+//- O balanceamento  feito de baixo para cima e s enquanto houver violao: nada  feito no resto do caminho
+//- Ns vermelhos podem ser filhos  direita, o que evita as rotaes que a LLRB faz s para manter os vermelhos  esquerda
+//- Insero faz no mximo 2 rotaes e remoo no mximo 3. As trocas de cor so O(1) amortizado
+
+//Definio das cores
+#define RED 1
+#define BLACK 0
+
+typedef struct NO* ArvRB;
+
+//Definio do n do dicionrio
+struct NO{
+    int info; //Informao propriamente dita
+    int chave; //Chave associada  informao
+    int cor; //Cor do n
+    struct NO *esq; //Filho esquerdo
+    struct NO *dir; //Filho direito
+    struct NO *pai; //Pai do n (NULL na raiz)
+};
+
+//Cabealho da rvore: ponteiro para a raiz seguido do alocador dos ns
+//O ArvRB* devolvido por cria_ArvRB aponta para o campo raiz, ento as funes continuam recebendo um ponteiro para ponteiro
+struct CabecaArvRB{
+    struct NO* raiz; //Tem que ser o primeiro campo
+    Alocador<struct NO> aloc; //De onde saem os ns dessa rvore
+};
+
+//Retorna o alocador da rvore a partir do ponteiro para a raiz
+Alocador<struct NO>* alocador_ArvRB(ArvRB* raiz){
+    return &((struct CabecaArvRB*) raiz)->aloc;
+}
+
+//Cria a rvore vazia
+//modo escolhe como os ns sero alocados: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+ArvRB* cria_ArvRB(int modo = ALOCA_MALLOC){
+    struct CabecaArvRB* cab = (struct CabecaArvRB*) malloc(sizeof(struct CabecaArvRB));
+    if(cab == NULL)//Erro na alocao de memria
+        return NULL;
+    cab->raiz = NULL;
+    inicia_Alocador(&cab->aloc, modo);
+    return &cab->raiz;
+}
+
+//Liberar um n
+void libera_NO(struct NO* no){
+    if(no == NULL) //Se j est vazia, no tem nada a fazer.
+        return;
+    libera_NO(no->esq); //Caso contrrio libera recursivamente todos os ns.
+    libera_NO(no->dir);
+    free(no);
+}
+
+//Liberar toda a rvore. Na arena no  preciso visitar os ns: os blocos so liberados de uma vez
+void libera_ArvRB(ArvRB* raiz){
+    if(raiz == NULL)
+        return;
+    Alocador<struct NO>* aloc = alocador_ArvRB(raiz);
+    if(aloc->modo == ALOCA_ARENA)
+        libera_Alocador(aloc);//libera todos os blocos
+    else
+        libera_NO(*raiz);//libera cada n
+    free(raiz);//libera a raiz (o cabealho comea no campo raiz)
+}
+
+//A consulta  idntica a uma rvore Binria
+int consulta_ArvRB(ArvRB *raiz, int valor){
+    if(raiz == NULL)
+        return 0;//No encontrou
+    struct NO* atual = *raiz;
+    while(atual != NULL){
+        if(valor == atual->chave) //Valor procurado est no n atual
+            return 1; //Encontrou
+        if(valor > atual->chave)
+            atual = atual->dir;
+        else
+            atual = atual->esq;
+    }
+    return 0; //No encontrou
+}
+
+//Consulta vrias chaves de uma vez, avanando as buscas em paralelo e usando prefetch (Comum/ConsultaLote.h)
+//resultados[i] recebe 1 se encontrou valores[i] ou 0 caso contrrio. Retorna quantas chaves foram encontradas
+int consultaLote_ArvRB(ArvRB *raiz, const int valores[], int n, int resultados[]){
+    if(raiz == NULL)
+        return 0;
+    return consultaLote_NO(*raiz, valores, n, resultados);
+}
+
+//Cria uma cpia somente leitura da rvore em um vetor na ordem de Eytzinger (Comum/ArvoreCongelada.h)
+//As buscas na cpia (consulta_ArvCongelada) no seguem ponteiros. Alteraes na rvore depois disso no aparecem na cpia
+struct ArvCongelada* congela_ArvRB(ArvRB *raiz){
+    if(raiz == NULL)
+        return NULL;
+    return congela_Arvore(*raiz);
+}
+
+//Iterador em ordem sem recurso nem alocao (Comum/Iterador.h). Com reverso = 1 vai da maior para a menor chave
+//Uso: for(struct NO* no = atual_Iterador(&it); no != NULL; avanca_Iterador(&it), no = atual_Iterador(&it))
+void iterador_ArvRB(ArvRB *raiz, struct Iterador<struct NO> *it, int reverso = 0){
+    inicia_Iterador(it, (raiz == NULL) ? NULL : *raiz, reverso);
+}
+
+//Iterador que comea na primeira chave >= valor (ou na ltima chave <= valor, se reverso)
+void iteradorEm_ArvRB(ArvRB *raiz, struct Iterador<struct NO> *it, int valor, int reverso = 0){
+    iniciaEm_Iterador(it, (raiz == NULL) ? NULL : *raiz, valor, reverso);
+}
+
+//Varredura do intervalo [lo, hi]: chama funcao(chave, info) em ordem crescente. Retorna quantas chaves foram visitadas
+template <class F>
+long long varre_ArvRB(ArvRB *raiz, int lo, int hi, F funcao){
+    if(raiz == NULL)
+        return 0;
+    return varre_NO(*raiz, lo, hi, funcao);
+}
+
+//Consultas pela chave mais prxima (Comum/ConsultaVizinho.h), em uma descida s
+//Todas retornam 1 se encontraram uma chave e copiam a chave e a informao dela para *chave e *info (que podem ser NULL)
+//Retornam 0 se no existe chave que atenda  condio
+
+//Chave igual a valor. Diferente de consulta_ArvRB, devolve tambm a informao guardada
+int busca_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(busca_NO(*raiz, valor), chave, info);
+}
+
+//Troca a informao guardada na chave valor, sem mexer na forma da rvore. Retorna 1 ou 0 (chave no est na rvore)
+int atualiza_ArvRB(ArvRB *raiz, int valor, int info){
+    if(raiz == NULL)
+        return 0;
+    struct NO* no = busca_NO(*raiz, valor);
+    if(no == NULL)
+        return 0;
+    no->info = info;
+    return 1;
+}
+
+//Menor chave >= valor (lower_bound)
+int limiteInferior_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(primeiroMaior_NO(*raiz, valor, 1), chave, info);
+}
+
+//Menor chave > valor (upper_bound)
+int limiteSuperior_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(primeiroMaior_NO(*raiz, valor, 0), chave, info);
+}
+
+//Maior chave <= valor (floor)
+int piso_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(ultimoMenor_NO(*raiz, valor, 1), chave, info);
+}
+
+//Menor chave >= valor (ceiling). Mesma resposta de limiteInferior_ArvRB
+int teto_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    return limiteInferior_ArvRB(raiz, valor, chave, info);
+}
+
+//Maior chave < valor (predecessor). valor no precisa estar na rvore
+int antecessor_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    if(raiz == NULL)
+        return 0;
+    return resposta_NO(ultimoMenor_NO(*raiz, valor, 0), chave, info);
+}
+
+//Menor chave > valor (successor). Mesma resposta de limiteSuperior_ArvRB
+int sucessor_ArvRB(ArvRB *raiz, int valor, int *chave, int *info){
+    return limiteSuperior_ArvRB(raiz, valor, chave, info);
+}
+
+//Funo auxiliar para retornar a cor do n
+int cor(struct NO* H){
+    if(H == NULL)
+        return BLACK; //Todo n folha (NULL)  preto
+    else
+        return H->cor;
+}
+
+//==================Implementao das rotaes==========================
+//Alm dos filhos, as rotaes acertam os ponteiros para o pai
+//No mexem nas cores: quem chama decide as cores de acordo com o caso
+
+//Troca a subrvore que tinha raiz em "velho" pela subrvore "novo" no pai de "velho"
+void substitui_NO(ArvRB *raiz, struct NO* velho, struct NO* novo){
+    if(velho->pai == NULL)
+        *raiz = novo;
+    else if(velho == velho->pai->esq)
+        velho->pai->esq = novo;
+    else
+        velho->pai->dir = novo;
+    if(novo != NULL)
+        novo->pai = velho->pai;
+}
+
+//Rotao  esquerda: o filho direito de A sobe para o lugar de A
+void rotacionaEsquerda(ArvRB *raiz, struct NO* A){
+    struct NO* B = A->dir;
+    A->dir = B->esq;
+    if(B->esq != NULL)
+        B->esq->pai = A;
+    substitui_NO(raiz, A, B);
+    B->esq = A;
+    A->pai = B;
+}
+
+//Rotao  direita: o filho esquerdo de A sobe para o lugar de A
+void rotacionaDireita(ArvRB *raiz, struct NO* A){
+    struct NO* B = A->esq;
+    A->esq = B->dir;
+    if(B->dir != NULL)
+        B->dir->pai = A;
+    substitui_NO(raiz, A, B);
+    B->dir = A;
+    A->pai = B;
+}
+//==================================================
+
+//Conserta as propriedades depois de inserir o n vermelho H
+//S continua subindo no caso em que o tio  vermelho (apenas troca de cores)
+//Nos outros casos faz uma ou duas rotaes e termina
+void corrigeInsercao(ArvRB *raiz, struct NO* H){
+    while(cor(H->pai) == RED){ //Pai vermelho: dois vermelhos seguidos
+        struct NO* pai = H->pai;
+        struct NO* avo = pai->pai; //Existe, pois a raiz  preta
+        if(pai == avo->esq){
+            struct NO* tio = avo->dir;
+            if(cor(tio) == RED){ //Caso 1: tio vermelho. Troca cores e sobe dois nveis
+                pai->cor = BLACK;
+                tio->cor = BLACK;
+                avo->cor = RED;
+                H = avo;
+            }else{
+                if(H == pai->dir){ //Caso 2: H  filho "interno". Vira o caso 3
+                    H = pai;
+                    rotacionaEsquerda(raiz, H);
+                    pai = H->pai;
+                }
+                pai->cor = BLACK; //Caso 3: H  filho "externo"
+                avo->cor = RED;
+                rotacionaDireita(raiz, avo);
+            }
+        }else{ //Simtrico: pai  filho direito do av
+            struct NO* tio = avo->esq;
+            if(cor(tio) == RED){
+                pai->cor = BLACK;
+                tio->cor = BLACK;
+                avo->cor = RED;
+                H = avo;
+            }else{
+                if(H == pai->esq){
+                    H = pai;
+                    rotacionaDireita(raiz, H);
+                    pai = H->pai;
+                }
+                pai->cor = BLACK;
+                avo->cor = RED;
+                rotacionaEsquerda(raiz, avo);
+            }
+        }
+    }
+    (*raiz)->cor = BLACK; //Raiz  sempre preta
+}
+
+//Insero sem recurso: desce como na rvore binria, insere um n vermelho e conserta de baixo para cima
+int insere_ArvRB(ArvRB* raiz, int chave, int valor){
+    struct NO* pai = NULL;
+    struct NO* atual = *raiz;
+    while(atual != NULL){ //Procura o local de insero
+        if(chave == atual->chave)
+            return 0; //Valor duplicado. No faz nada e informa que no deu certo a insero
+        pai = atual;
+        if(chave < atual->chave)
+            atual = atual->esq;
+        else
+            atual = atual->dir;
+    }
+
+    struct NO* novo = aloca_NO(alocador_ArvRB(raiz)); //Alocao de memria (malloc ou arena)
+    if(novo == NULL)
+        return 0;
+    novo->info = valor;
+    novo->chave = chave;
+    novo->cor = RED; //Novo n  sempre vermelho
+    novo->esq = NULL;
+    novo->dir = NULL;
+    novo->pai = pai;
+    if(pai == NULL)
+        *raiz = novo; //rvore estava vazia
+    else if(chave < pai->chave)
+        pai->esq = novo;
+    else
+        pai->dir = novo;
+
+    corrigeInsercao(raiz, novo);
+    return 1; //Deu certo a insero
+}
+
+//Conserta as propriedades depois de remover um n preto
+//H ocupa o lugar do n removido e tem um preto "a mais". Como H pode ser NULL, o pai  passado separado
+//S continua subindo no caso em que o irmo e os sobrinhos so pretos (apenas troca de cor)
+//Nos outros casos faz no mximo 3 rotaes no total e termina
+void corrigeRemocao(ArvRB *raiz, struct NO* H, struct NO* pai){
+    while(H != *raiz && cor(H) == BLACK){
+        if(H == pai->esq){
+            struct NO* irmao = pai->dir; //Existe, pois o lado de H tem um preto a menos
+            if(cor(irmao) == RED){ //Caso 1: irmo vermelho. Rotao para ter um irmo preto
+                irmao->cor = BLACK;
+                pai->cor = RED;
+                rotacionaEsquerda(raiz, pai);
+                irmao = pai->dir;
+            }
+            if(cor(irmao->esq) == BLACK && cor(irmao->dir) == BLACK){ //Caso 2: sobrinhos pretos. Troca cor e sobe
+                irmao->cor = RED;
+                H = pai;
+                pai = H->pai;
+            }else{
+                if(cor(irmao->dir) == BLACK){ //Caso 3: s o sobrinho "interno"  vermelho. Vira o caso 4
+                    irmao->esq->cor = BLACK;
+                    irmao->cor = RED;
+                    rotacionaDireita(raiz, irmao);
+                    irmao = pai->dir;
+                }
+                irmao->cor = pai->cor; //Caso 4: sobrinho "externo" vermelho. Uma rotao resolve
+                pai->cor = BLACK;
+                irmao->dir->cor = BLACK;
+                rotacionaEsquerda(raiz, pai);
+                H = *raiz; //Termina
+            }
+        }else{ //Simtrico: H  filho direito
+            struct NO* irmao = pai->esq;
+            if(cor(irmao) == RED){
+                irmao->cor = BLACK;
+                pai->cor = RED;
+                rotacionaDireita(raiz, pai);
+                irmao = pai->esq;
+            }
+            if(cor(irmao->esq) == BLACK && cor(irmao->dir) == BLACK){
+                irmao->cor = RED;
+                H = pai;
+                pai = H->pai;
+            }else{
+                if(cor(irmao->esq) == BLACK){
+                    irmao->dir->cor = BLACK;
+                    irmao->cor = RED;
+                    rotacionaEsquerda(raiz, irmao);
+                    irmao = pai->esq;
+                }
+                irmao->cor = pai->cor;
+                pai->cor = BLACK;
+                irmao->esq->cor = BLACK;
+                rotacionaDireita(raiz, pai);
+                H = *raiz;
+            }
+        }
+    }
+    if(H != NULL)
+        H->cor = BLACK;
+}
+
+// Funo auxiliar que procura pelo n mais a esquerda (que  o menor n)
+struct NO* procuraMenor(struct NO* atual){
+    while(atual->esq != NULL)
+        atual = atual->esq;
+    return atual;
+}
+
+//Remoo sem recurso
+// Existem 3 tipos de remoo:
+//- N folha (sem filhos)
+//- N com 1 filho
+//- N com 2 filhos: o sucessor (menor n da subrvore da direita) ocupa o lugar do n removido
+//Os ns so religados, e no copiados, ento chave e info continuam juntas
+//Se o n que saiu do seu lugar era preto, conserta as propriedades de baixo para cima
+int remove_ArvRB(ArvRB *raiz, int valor){
+    struct NO* Z = *raiz;
+    while(Z != NULL && Z->chave != valor){ //Procura o n a ser removido
+        if(valor < Z->chave)
+            Z = Z->esq;
+        else
+            Z = Z->dir;
+    }
+    if(Z == NULL)
+        return 0; //No existe o elemento a ser removido na rvore
+
+    struct NO* H; //N que ocupa a posio que ficou vazia (pode ser NULL)
+    struct NO* paiH; //Pai de H depois da remoo
+    int corRemovida = Z->cor;
+    if(Z->esq == NULL){ //N com 0 ou 1 filho ( direita)
+        H = Z->dir;
+        paiH = Z->pai;
+        substitui_NO(raiz, Z, Z->dir);
+    }else if(Z->dir == NULL){ //N com 1 filho ( esquerda)
+        H = Z->esq;
+        paiH = Z->pai;
+        substitui_NO(raiz, Z, Z->esq);
+    }else{ //N com 2 filhos
+        struct NO* Y = procuraMenor(Z->dir); //Sucessor de Z. No tem filho  esquerda
+        corRemovida = Y->cor;
+        H = Y->dir;
+        if(Y->pai == Z)
+            paiH = Y;
+        else{
+            paiH = Y->pai;
+            substitui_NO(raiz, Y, Y->dir); //Tira Y do seu lugar
+            Y->dir = Z->dir;
+            Y->dir->pai = Y;
+        }
+        substitui_NO(raiz, Z, Y); //Y ocupa o lugar de Z, com a cor de Z
+        Y->esq = Z->esq;
+        Y->esq->pai = Y;
+        Y->cor = Z->cor;
+    }
+    desaloca_NO(alocador_ArvRB(raiz), Z); //Devolve o n ao alocador
+
+    if(corRemovida == BLACK) //Remover um n vermelho no viola nenhuma propriedade
+        corrigeRemocao(raiz, H, paiH);
+    return 1;
+}
+
+//Imprime um percurso em-ordem para testes
+void emOrdem_ArvRB(ArvRB *raiz, int H){
+    if(raiz == NULL)
+        return;
+
+    if(*raiz != NULL){
+        emOrdem_ArvRB(&((*raiz)->esq),H+1);
+
+        if((*raiz)->cor == RED)
+            printf("R - Chave %d: - Valor: %d\n\n",(*raiz)->chave,(*raiz)->info);
+        else
+            printf("B - Chave %d: - Valor: %d\n\n",(*raiz)->chave,(*raiz)->info);
+
+        emOrdem_ArvRB(&((*raiz)->dir),H+1);
+    }
+}
+
+//Operaes da Rubro-Negra reunidas em uma struct, para as estruturas que recebem a rvore como parmetro de template (Comum/Particionado.h)
+struct MotorRB{
+    typedef ArvRB Arvore;
+    static ArvRB* cria(int modo){ return cria_ArvRB(modo); }
+    static void libera(ArvRB *raiz){ libera_ArvRB(raiz); }
+    static int insere(ArvRB *raiz, int chave, int valor){ return insere_ArvRB(raiz, chave, valor); }
+    static int consulta(ArvRB *raiz, int valor){ return consulta_ArvRB(raiz, valor); }
+    static int remove(ArvRB *raiz, int valor){ return remove_ArvRB(raiz, valor); }
+    static int atualiza(ArvRB *raiz, int chave, int valor){ return atualiza_ArvRB(raiz, chave, valor); }
+    template <class F>
+    static long long varre(ArvRB *raiz, int lo, int hi, F funcao){ return varre_ArvRB(raiz, lo, hi, funcao); }
+};
+
+#endif
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore rubro-negra (o std::map tambm  uma rubro-negra clssica)
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreRB.h" //Implementao da rvore Rubro-Negra clssica (compartilhada pelos programas de teste)
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    int encontrouMapa=0, encontrouRB=0; //Variveis de controle
+    double t = tmr.elapsed(); //Tempo de execuo do trecho de cdigo em segundos (s)
+    int N = 11000000; //Nmero de ns da rvore/Mapa. Range 500.000-15.000.000
+    int num_rodadas = 500000; //Nmero de rodadas para pegar a mdia de tempos e diminuir distores
+    int modo_alocacao = ALOCA_MALLOC; //Alocao dos ns da rvore: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    double somaMAPA = 0.0, somaRB = 0.0; //Tempos para cada implementao
+    double *tempo_RB, *tempo_MAPA;
+    tempo_RB = (double *)malloc(N * sizeof(double)); //Vetores para armazenar os tempos de insero de cada valor
+    tempo_MAPA = (double *)malloc(N * sizeof(double));
+    int res; //Resposta se a insero ocorreu corretamente (1) ou no (0)
+    std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
+    std::cout<<std::endl;
+
+    //=============================Mapa============================================
+    std::map<int, int> Mapa; //Para comparar com a implementao de rvore RB
+    std::cout<<"Inserindo elementos no Mapa..."<<std::endl;
+    std::cout<<std::endl;
+    for(int i=0;i<N;i++){ //Cria um Mapa adicionando os elementos na seguncia: 0, 2, 3, 4...N-1
+        Mapa.insert(std::pair<int, int>(i, i));
+        }
+
+
+    std::cout<<"Buscando elementos e calculando tempo..."<<std::endl;
+    std::cout<<std::endl;
+    for(int j=0;j<num_rodadas;j++) //Fazer vrias rodadas para tentar evitar muitas distores
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        if(Mapa.find(j)!= Mapa.end())
+        {
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            encontrouMapa=1; //Seta pra 1 pra verificar no final se encontrou o elemento sem problemas
+        }
+        tempo_MAPA[j] = t;
+    }
+
+    for(int j=0;j<num_rodadas;j++) //Calcula o tempo total para encontrar o elemento em num_rodadas rodadas
+    {
+        somaMAPA = somaMAPA + tempo_MAPA[j];
+    }
+    free(tempo_MAPA); //Libera o vetor
+    std::cout << "Tempo medio para encontrar elemento no Mapa com " << N << " nos = " << somaMAPA/num_rodadas << " segundos" << std::endl; //Exibe na tela os valores
+    std::cout<<std::endl;
+    //=============================RB============================================
+    ArvRB *rb = cria_ArvRB(modo_alocacao);//Cria rvore RB
+    std::cout<<"Inserindo elementos na RB..."<<std::endl;
+    std::cout<<std::endl;
+    for(int i=0;i<N;i++) //Insere elementos na rvore
+    {
+        res = insere_ArvRB(rb,i,i);
+    }
+
+    std::cout<<"Buscando elementos e calculando tempo..."<<std::endl;
+    std::cout<<std::endl;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        if(consulta_ArvRB(rb,j)== 1) //Zero no encontrou, 1 encontrou
+        {
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+            t = tmr.elapsed();
+            encontrouRB=1; //Seta pra 1 pra verificar no final se encontrou o elemento sem problemas
+        }
+        tempo_RB[j] = t;
+    }
+
+    //Mesmas chaves, mas consultadas em lotes de TAM_LOTE com consultaLote_ArvRB (buscas intercaladas com prefetch)
+    //Mede o tempo de cada lote e divide pelo total de chaves no final
+    const int TAM_LOTE = 256; //Nosso caminho de leitura recebe as consultas em lotes de centenas
+    int chaves_lote[TAM_LOTE], resultados_lote[TAM_LOTE];
+    double somaLote = 0.0;
+    int encontrouLote = 1;
+    for(int j=0;j<num_rodadas;j+=TAM_LOTE)
+    {
+        int n = (num_rodadas - j < TAM_LOTE) ? num_rodadas - j : TAM_LOTE;
+        for(int i=0;i<n;i++)
+            chaves_lote[i] = j + i;
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = consultaLote_ArvRB(rb,chaves_lote,n,resultados_lote);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        somaLote = somaLote + tmr.elapsed();
+        if(res != n)
+            encontrouLote = 0; //Alguma chave do lote no foi encontrada
+    }
+
+    //Cpia congelada (vetor na ordem de Eytzinger, sem ponteiros), buscando as mesmas chaves uma a uma
+    tmr.reset();
+    struct ArvCongelada *congelada = congela_ArvRB(rb);
+    double tempo_congela = tmr.elapsed(); //Tempo para criar a cpia
+    double somaCongelada = 0.0;
+    int encontrouCongelada = 1;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        res = consulta_ArvCongelada(congelada,j);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        somaCongelada = somaCongelada + tmr.elapsed();
+        if(res != 1)
+            encontrouCongelada = 0;
+    }
+    libera_ArvCongelada(congelada);
+
+    libera_ArvRB(rb);
+
+    for(int j=0;j<num_rodadas;j++) //Calcula o tempo total para encontrar o elemento em num_rodadas rodadas
+    {
+        somaRB = somaRB + tempo_RB[j];
+    }
+    std::cout << "Tempo medio para encontrar elemento na RB com " << N << " nos = " << somaRB/num_rodadas << " segundos" << std::endl; //Exibe na tela
+    std::cout << "Tempo medio para encontrar elemento na RB (lotes de " << TAM_LOTE << ") com " << N << " nos = " << somaLote/num_rodadas << " segundos" << std::endl;
+    std::cout << "Tempo medio para encontrar elemento na RB congelada com " << N << " nos = " << somaCongelada/num_rodadas << " segundos (congelar: " << tempo_congela << " s)" << std::endl;
+    std::cout<<std::endl;
+    free(tempo_RB); //Libera o vetor
+
+    if((encontrouRB==0)||(encontrouMapa==0)||(encontrouLote==0)||(encontrouCongelada==0))
+        std::cout << "Elemento nao encontrado. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}
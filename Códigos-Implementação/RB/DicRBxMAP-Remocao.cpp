@@ -0,0 +1,103 @@
+#include <iostream>
+#include <chrono> //Medio de tempo de execuo de um trecho de cdigo
+#include <map> //Biblioteca padro para comparar com a implementao de uma rvore rubro-negra (o std::map tambm  uma rubro-negra clssica)
+
+//Usado para calcular o tempo de execuo de um trecho de cdigo
+class Timer
+{
+public:
+    Timer() : beg_(clock_::now()) {}
+    void reset() { beg_ = clock_::now(); }
+    double elapsed() const {
+        return std::chrono::duration_cast<second_>
+            (clock_::now() - beg_).count(); }
+
+private:
+    typedef std::chrono::high_resolution_clock clock_;
+    typedef std::chrono::duration<double, std::ratio<1> > second_;
+    std::chrono::time_point<clock_> beg_;
+};
+
+
+#include "ArvoreRB.h" //Implementao da rvore Rubro-Negra clssica (compartilhada pelos programas de teste)
+
+//Exemplo de uso
+int main(){
+    Timer tmr;
+    double t = tmr.elapsed(); //Tempo de execuo do trecho de cdigo em segundos (s)
+    int N = 4000000; //Nmero de ns da rvore/Mapa. Range 500.000-15.000.000
+    int num_rodadas = 500000; //Nmero de rodadas para pegar a mdia de tempos e diminuir distores
+    int modo_alocacao = ALOCA_MALLOC; //Alocao dos ns da rvore: ALOCA_MALLOC (um malloc por n) ou ALOCA_ARENA (blocos contguos)
+    double somaMAPA = 0.0, somaRB = 0.0; //Tempos para cada implementao
+    double *tempo_RB, *tempo_MAPA;
+    tempo_RB = (double *)malloc(N * sizeof(double)); //Vetores para armazenar os tempos de insero de cada valor
+    tempo_MAPA = (double *)malloc(N * sizeof(double));
+    int falhas = 0; //Inseres que no deram certo (resposta 0). Se houver alguma, os tempos no valem
+    std::cout<<"N = "<<N<<" - Numero de rodadas = "<<num_rodadas<<std::endl;
+    std::cout<<std::endl;
+
+    //=============================Mapa============================================
+    std::map<int, int> Mapa; //Para comparar com a implementao de rvore RB
+    std::cout<<"Inserindo elementos no Mapa..."<<std::endl;
+    std::cout<<std::endl;
+    for(int i=0;i<N;i++){ //Cria um Mapa adicionando os elementos na seguncia: 0, 2, 3, 4...N-1
+        Mapa.insert(std::pair<int, int>(i, i));
+        }
+
+
+    std::cout<<"Removendo elementos e calculando tempo..."<<std::endl;
+    std::cout<<std::endl;
+    for(int j=0;j<num_rodadas;j++) //Fazer vrias rodadas para tentar evitar muitas distores
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        Mapa.erase(j);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        t = tmr.elapsed();
+        tempo_MAPA[j] = t;
+    }
+
+    for(int j=0;j<num_rodadas;j++) //Calcula o tempo total para encontrar o elemento em num_rodadas rodadas
+    {
+        somaMAPA = somaMAPA + tempo_MAPA[j];
+    }
+    free(tempo_MAPA); //Libera o vetor
+    std::cout << "Tempo medio para remover elemento no Mapa com " << N << " nos = " << somaMAPA/num_rodadas << " segundos" << std::endl; //Exibe na tela os valores
+    std::cout<<std::endl;
+//=============================RB============================================
+    ArvRB *raiz = cria_ArvRB(modo_alocacao);//Cria rvore RB
+    std::cout<<"Inserindo elementos na RB..."<<std::endl;
+    std::cout<<std::endl;
+    for(int i=0;i<N;i++) //Insere elementos na rvore
+    {
+        if(insere_ArvRB(raiz,i,i) != 1)
+            falhas++;
+    }
+
+    std::cout<<"Removendo elementos e calculando tempo..."<<std::endl;
+    std::cout<<std::endl;
+    for(int j=0;j<num_rodadas;j++)
+    {
+        tmr.reset();
+        //======================Zera o contador. Cdigo a ser medido deve estar depois dessa linha
+        remove_ArvRB(raiz,j);
+        //======================Para o contador. Cdigo a ser medido deve estar antes dessa linha
+        t = tmr.elapsed();
+        tempo_RB[j] = t;
+    }
+
+    libera_ArvRB(raiz);
+
+    for(int j=0;j<num_rodadas;j++) //Calcula o tempo total para encontrar o elemento em num_rodadas rodadas
+    {
+        somaRB = somaRB + tempo_RB[j];
+    }
+    std::cout << "Tempo medio para remover elemento na RB com " << N << " nos = " << somaRB/num_rodadas << " segundos" << std::endl; //Exibe na tela
+    std::cout<<std::endl;
+    free(tempo_RB); //Libera o vetor
+
+    if(falhas > 0)
+        std::cout << "Alguma insercao falhou. Desconsiderar dados!!!" << std::endl;
+
+    return 0;
+}